@@ -497,6 +497,8 @@ if(FO_ANGELSCRIPT_SCRIPTING)
     add_library(AngelScript STATIC EXCLUDE_FROM_ALL
         "${FO_ANGELSCRIPT_EXT_DIR}/AngelScriptArray.cpp"
         "${FO_ANGELSCRIPT_EXT_DIR}/AngelScriptArray.h"
+        "${FO_ANGELSCRIPT_EXT_DIR}/AngelScriptCallSites.cpp"
+        "${FO_ANGELSCRIPT_EXT_DIR}/AngelScriptCallSites.h"
         "${FO_ANGELSCRIPT_EXT_DIR}/AngelScriptDict.cpp"
         "${FO_ANGELSCRIPT_EXT_DIR}/AngelScriptDict.h"
         "${FO_ANGELSCRIPT_EXT_DIR}/AngelScriptMath.cpp"
@@ -607,6 +609,7 @@ list(APPEND FO_COMMON_SOURCE
     "${FO_ENGINE_ROOT}/Source/Essentials/Logging.h"
     "${FO_ENGINE_ROOT}/Source/Essentials/CommonHelpers.h"
     "${FO_ENGINE_ROOT}/Source/Essentials/CommonHelpers.cpp"
+    "${FO_ENGINE_ROOT}/Source/Essentials/EpochContainers.h"
     "${FO_ENGINE_ROOT}/Source/Essentials/WinApi-Include.h"
     "${FO_ENGINE_ROOT}/Source/Essentials/WinApiUndef-Include.h"
     "${FO_ENGINE_ROOT}/Source/Common/Common.cpp"
@@ -631,6 +634,8 @@ list(APPEND FO_COMMON_SOURCE
     "${FO_ENGINE_ROOT}/Source/Common/FileSystem.h"
     "${FO_ENGINE_ROOT}/Source/Common/Geometry.cpp"
     "${FO_ENGINE_ROOT}/Source/Common/Geometry.h"
+    "${FO_ENGINE_ROOT}/Source/Common/HexChunkCounter.h"
+    "${FO_ENGINE_ROOT}/Source/Common/HexSpatialIndex.h"
     "${FO_ENGINE_ROOT}/Source/Common/LineTracer.cpp"
     "${FO_ENGINE_ROOT}/Source/Common/LineTracer.h"
     "${FO_ENGINE_ROOT}/Source/Common/MapLoader.cpp"
@@ -645,6 +650,10 @@ list(APPEND FO_COMMON_SOURCE
     "${FO_ENGINE_ROOT}/Source/Common/PropertiesSerializator.h"
     "${FO_ENGINE_ROOT}/Source/Common/ProtoManager.cpp"
     "${FO_ENGINE_ROOT}/Source/Common/ProtoManager.h"
+    "${FO_ENGINE_ROOT}/Source/Common/ScriptCoroutineScheduler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Common/ScriptCoroutineScheduler.h"
+    "${FO_ENGINE_ROOT}/Source/Common/ScriptProfiler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Common/ScriptProfiler.h"
     "${FO_ENGINE_ROOT}/Source/Common/ScriptSystem.cpp"
     "${FO_ENGINE_ROOT}/Source/Common/ScriptSystem.h"
     "${FO_ENGINE_ROOT}/Source/Common/Settings.cpp"
@@ -664,14 +673,21 @@ list(APPEND FO_COMMON_SOURCE
     "${CMAKE_CURRENT_BINARY_DIR}/GeneratedSource/GenericCode-Common.cpp")
 
 list(APPEND FO_SERVER_BASE_SOURCE
+    "${FO_ENGINE_ROOT}/Source/Server/BroadcastThrottler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/BroadcastThrottler.h"
     "${FO_ENGINE_ROOT}/Source/Server/Critter.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/Critter.h"
     "${FO_ENGINE_ROOT}/Source/Server/CritterManager.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/CritterManager.h"
     "${FO_ENGINE_ROOT}/Source/Server/DataBase.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/DataBase.h"
+    "${FO_ENGINE_ROOT}/Source/Server/EntityIndex.h"
     "${FO_ENGINE_ROOT}/Source/Server/EntityManager.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/EntityManager.h"
+    "${FO_ENGINE_ROOT}/Source/Server/EntityPaging.h"
+    "${FO_ENGINE_ROOT}/Source/Server/EntityProtoRegistry.h"
+    "${FO_ENGINE_ROOT}/Source/Server/EntityRange.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/EntityRange.h"
     "${FO_ENGINE_ROOT}/Source/Server/Item.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/Item.h"
     "${FO_ENGINE_ROOT}/Source/Server/ItemManager.cpp"
@@ -687,6 +703,7 @@ list(APPEND FO_SERVER_BASE_SOURCE
     "${FO_ENGINE_ROOT}/Source/Server/NetworkServer-Interthread.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/NetworkServer-WebSockets.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/NetworkServer.h"
+    "${FO_ENGINE_ROOT}/Source/Server/PathFinding.h"
     "${FO_ENGINE_ROOT}/Source/Server/Player.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/Player.h"
     "${FO_ENGINE_ROOT}/Source/Server/Server.cpp"
@@ -695,6 +712,8 @@ list(APPEND FO_SERVER_BASE_SOURCE
     "${FO_ENGINE_ROOT}/Source/Server/ServerConnection.h"
     "${FO_ENGINE_ROOT}/Source/Server/ServerEntity.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/ServerEntity.h"
+    "${FO_ENGINE_ROOT}/Source/Server/TickScheduler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/TickScheduler.h"
     "${FO_ENGINE_ROOT}/Source/Scripting/ServerEntityScriptMethods.cpp"
     "${FO_ENGINE_ROOT}/Source/Scripting/ServerGlobalScriptMethods.cpp"
     "${FO_ENGINE_ROOT}/Source/Scripting/ServerPlayerScriptMethods.cpp"
@@ -831,6 +850,8 @@ list(APPEND FO_BAKER_SOURCE
     "${FO_ENGINE_ROOT}/Source/Tools/ProtoTextBaker.cpp"
     "${FO_ENGINE_ROOT}/Source/Tools/RawCopyBaker.h"
     "${FO_ENGINE_ROOT}/Source/Tools/RawCopyBaker.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tools/ScriptCompilationCache.h"
+    "${FO_ENGINE_ROOT}/Source/Tools/ScriptCompilationCache.cpp"
     "${FO_ENGINE_ROOT}/Source/Tools/TextBaker.h"
     "${FO_ENGINE_ROOT}/Source/Tools/TextBaker.cpp"
     "${CMAKE_CURRENT_BINARY_DIR}/GeneratedSource/DataRegistration-Baker.cpp")
@@ -875,6 +896,7 @@ list(APPEND FO_SOURCE_META_FILES
     "${FO_ENGINE_ROOT}/Source/Client/MapSprite.h"
     "${FO_ENGINE_ROOT}/Source/Client/MapView.h"
     "${FO_ENGINE_ROOT}/Source/Server/Critter.h"
+    "${FO_ENGINE_ROOT}/Source/Server/EntityRange.h"
     "${FO_ENGINE_ROOT}/Source/Server/Item.h"
     "${FO_ENGINE_ROOT}/Source/Server/Location.h"
     "${FO_ENGINE_ROOT}/Source/Server/Map.h"
@@ -902,10 +924,32 @@ list(APPEND FO_SOURCE_META_FILES
     "${FO_ENGINE_ROOT}/Source/Scripting/CommonGlobalScriptMethods.cpp")
 
 list(APPEND FO_TESTS_SOURCE
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptArgArrays.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptCallSites.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptDict.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_AnyData.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_BroadcastThrottler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_ClientConnection.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_DataBasePrefetch.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_EntityIndex.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_EntityPaging.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_EntityProtoRegistry.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_EntityRange.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_EpochContainers.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_GenericUtils.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_Geometry.cpp"
-    "${FO_ENGINE_ROOT}/Source/Tests/Test_StringUtils.cpp")
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_HexChunkCounter.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_HexSpatialIndex.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_MemoryPool.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_PathFinding.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_PodPropertyAccess.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_ScriptCompilationCache.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_ScriptCoroutineScheduler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_ScriptProfiler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_StackTrace.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_StringUtils.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_TickScheduler.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_TwoDimensionalGrid.cpp")
 
 # Code generation
 include(FindPython3)
@@ -946,6 +946,7 @@ def parseTags():
                 isModifiableByClient = 'ModifiableByClient' in flags
                 isModifiableByAnyClient = 'ModifiableByAnyClient' in flags
                 isNullGetterForProto = 'NullGetterForProto' in flags
+                isIndexed = 'HashIndex' in flags or 'SortedIndex' in flags
                 isSynced = isCommon and isMutable and (isOwnerSync or isPublicSync)
                 
                 assert not (isOwnerSync or isPublicSync or isNoSync) or isCommon, name + ' - synced property must be common'
@@ -961,6 +962,9 @@ def parseTags():
                 assert not isVirtual or not isSynced, name + ' - virtual property can\'t be synced'
                 assert not isVirtual or not isPersistent, name + ' - virtual property can\'t be persistent'
                 assert not isNullGetterForProto or isVirtual, name + ' - null getter can\'t be on virtual property'
+                assert not ('HashIndex' in flags and 'SortedIndex' in flags), name + ' - multiple index types'
+                assert not isIndexed or not isVirtual, name + ' - virtual property can\'t be indexed'
+                assert not isIndexed or not isClientOnly, name + ' - client property can\'t be indexed'
                 
                 codeGenTags['Property'].append((entity, access, ptype, name, flags, comment))
                 
@@ -2724,8 +2728,8 @@ def genApiMarkdown():
             writeFile('* `' + metaTypeToUnifiedType(f[0]) + ' ' + f[1] + '`')
             writeComm(f[2], 0)
         for m in methods:
-            writeFile('* `' + metaTypeToUnifiedType(m[1]) + ' ' + m[0] + '()' + '`')
-            writeComm(m[2], 0)
+            writeFile('* `' + metaTypeToUnifiedType(m[1]) + ' ' + m[0] + '(' + ', '.join([metaTypeToUnifiedType(a[0]) + ' ' + a[1] for a in m[2]]) + ')' + '`')
+            writeComm(m[3], 0)
     for etTag in codeGenTags['ExportValueType']:
         name, ntype, flags, comm = etTag
         writeFile('### ' + name + ' value object')
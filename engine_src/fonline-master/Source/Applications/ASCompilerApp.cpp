@@ -41,9 +41,9 @@
 FO_USING_NAMESPACE();
 
 FO_BEGIN_NAMESPACE();
-extern auto Init_AngelScriptCompiler_ServerScriptSystem(const vector<File>&) -> vector<uint8>;
-extern auto Init_AngelScriptCompiler_ClientScriptSystem(const vector<File>&) -> vector<uint8>;
-extern auto Init_AngelScriptCompiler_MapperScriptSystem(const vector<File>&) -> vector<uint8>;
+extern auto Init_AngelScriptCompiler_ServerScriptSystem(const vector<File>&, vector<string>*) -> vector<uint8>;
+extern auto Init_AngelScriptCompiler_ClientScriptSystem(const vector<File>&, vector<string>*) -> vector<uint8>;
+extern auto Init_AngelScriptCompiler_MapperScriptSystem(const vector<File>&, vector<string>*) -> vector<uint8>;
 
 unordered_set<string> CompilerPassedMessages;
 FO_END_NAMESPACE();
@@ -97,7 +97,7 @@ int main(int argc, char** argv)
             WriteLog("Compile server scripts");
 
             try {
-                auto data = Init_AngelScriptCompiler_ServerScriptSystem(script_files);
+                auto data = Init_AngelScriptCompiler_ServerScriptSystem(script_files, nullptr);
                 write_file(data, "fos-bin-server");
             }
             catch (const std::exception& ex) {
@@ -111,7 +111,7 @@ int main(int argc, char** argv)
             WriteLog("Compile client scripts");
 
             try {
-                auto data = Init_AngelScriptCompiler_ClientScriptSystem(script_files);
+                auto data = Init_AngelScriptCompiler_ClientScriptSystem(script_files, nullptr);
                 write_file(data, "fos-bin-client");
             }
             catch (const std::exception& ex) {
@@ -125,7 +125,7 @@ int main(int argc, char** argv)
             WriteLog("Compile mapper scripts");
 
             try {
-                auto data = Init_AngelScriptCompiler_MapperScriptSystem(script_files);
+                auto data = Init_AngelScriptCompiler_MapperScriptSystem(script_files, nullptr);
                 write_file(data, "fos-bin-mapper");
             }
             catch (const std::exception& ex) {
@@ -52,6 +52,13 @@ ClientConnection::ClientConnection(ClientNetworkSettings& settings) :
     AddMessageHandler(NetMessage::HandshakeAnswer, [this] { Net_OnHandshakeAnswer(); });
 }
 
+ClientConnection::~ClientConnection()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    StopReceiveThread();
+}
+
 void ClientConnection::SetConnectHandler(ConnectCallback handler)
 {
     FO_STACK_TRACE_ENTRY();
@@ -159,6 +166,12 @@ void ClientConnection::ProcessConnection()
 
         if (_netConnection->IsConnected()) {
             Net_SendHandshake();
+
+#if !FO_WEB
+            if (_settings->NetReceiveThread) {
+                StartReceiveThread();
+            }
+#endif
         }
         else {
             Disconnect();
@@ -181,34 +194,41 @@ void ClientConnection::ProcessConnection()
     }
 
     // Receive and send data
-    if (ReceiveData()) {
-        while (_netIn.NeedProcess()) {
-            const auto msg = _netIn.ReadMsg();
+    ReceiveData();
+
+    // Messages left after budget exceeding will be processed at next frame
+    const auto process_deadline = _settings->NetMessagesProcessBudget > 0 ? nanotime::now() + std::chrono::milliseconds {_settings->NetMessagesProcessBudget} : nanotime::zero;
+
+    while (_netIn.NeedProcess()) {
+        const auto msg = _netIn.ReadMsg();
 
 #if FO_DEBUG
-            _msgHistory.insert(_msgHistory.begin(), msg);
+        _msgHistory.insert(_msgHistory.begin(), msg);
 #endif
 
-            if (_settings->DebugNet) {
-                _msgCount++;
-                WriteLog("{}) Input net message {}", _msgCount, msg);
-            }
+        if (_settings->DebugNet) {
+            _msgCount++;
+            WriteLog("{}) Input net message {}", _msgCount, msg);
+        }
 
-            const auto it = _handlers.find(msg);
+        const auto it = _handlers.find(msg);
 
-            if (it != _handlers.end()) {
-                if (it->second) {
-                    it->second();
-                }
-            }
-            else {
-                throw ClientConnectionException("No handler for message", msg);
+        if (it != _handlers.end()) {
+            if (it->second) {
+                it->second();
             }
+        }
+        else {
+            throw ClientConnectionException("No handler for message", msg);
+        }
 
-            // State may change during message processing
-            if (!_netConnection) {
-                return;
-            }
+        // State may change during message processing
+        if (!_netConnection) {
+            return;
+        }
+
+        if (process_deadline && nanotime::now() >= process_deadline) {
+            break;
         }
     }
 
@@ -222,7 +242,15 @@ void ClientConnection::ProcessConnection()
     SendData();
 
     // Handle disconnect
-    if (!_netConnection->IsConnected()) {
+    bool is_connected;
+
+    {
+        auto locker = std::unique_lock {_connectionLocker};
+
+        is_connected = _netConnection->IsConnected();
+    }
+
+    if (!is_connected) {
         Disconnect();
     }
 }
@@ -235,6 +263,8 @@ void ClientConnection::Disconnect()
         return;
     }
 
+    StopReceiveThread();
+
     _netConnection->Disconnect();
     _netConnection.reset();
 
@@ -263,6 +293,13 @@ void ClientConnection::SendData()
         if (_netOut.IsEmpty()) {
             break;
         }
+
+        auto locker = std::unique_lock {_connectionLocker, std::defer_lock};
+
+        if (_receiveThread) {
+            locker.lock();
+        }
+
         if (!_netConnection->CheckStatus(true)) {
             break;
         }
@@ -279,6 +316,10 @@ auto ClientConnection::ReceiveData() -> bool
 {
     FO_STACK_TRACE_ENTRY();
 
+    if (_receiveThread) {
+        return TakeReceivedData();
+    }
+
     if (_netConnection->CheckStatus(false)) {
         const auto recv_buf = _netConnection->ReceiveData();
         FO_RUNTIME_ASSERT(!recv_buf.empty());
@@ -303,6 +344,123 @@ auto ClientConnection::ReceiveData() -> bool
     return false;
 }
 
+void ClientConnection::StartReceiveThread()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(!_receiveThread);
+
+    _receiveThread = SafeAlloc::MakeUnique<WorkThread>("NetReceive");
+    _receiveThread->AddJob([this] { return ReceiveThreadJob(); });
+}
+
+void ClientConnection::StopReceiveThread()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_receiveThread) {
+        return;
+    }
+
+    // Receive job repeats itself, so drop it before thread finishing
+    _receiveThread->Clear();
+    _receiveThread.reset();
+
+    _receivedData.clear();
+    _receivedBytes = 0;
+    _receivedRealBytes = 0;
+    _receiveError = nullptr;
+}
+
+auto ClientConnection::ReceiveThreadJob() -> optional<timespan>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    span<const uint8> recv_buf;
+
+    try {
+        auto locker = std::unique_lock {_connectionLocker};
+
+        if (!_netConnection->CheckStatus(false)) {
+            if (!_netConnection->IsConnected()) {
+                return std::nullopt;
+            }
+
+            locker.unlock();
+
+            // Block on connection without locking, main thread keeps sending meanwhile
+            // Timeout bounds receive thread stopping time
+            _netConnection->WaitReceive(std::chrono::milliseconds {100});
+            return timespan::zero;
+        }
+
+        recv_buf = _netConnection->ReceiveData();
+        FO_RUNTIME_ASSERT(!recv_buf.empty());
+
+        // Connection buffer is reused only by this thread so data can be decompressed without lock
+        locker.unlock();
+
+        if (!_settings->DisableZlibCompression) {
+            _decompressor.Decompress(recv_buf, _receiveThreadBuf);
+        }
+        else {
+            _receiveThreadBuf.assign(recv_buf.begin(), recv_buf.end());
+        }
+    }
+    catch (...) {
+        auto locker = std::unique_lock {_receivedDataLocker};
+
+        _receiveError = std::current_exception();
+        return std::nullopt;
+    }
+
+    {
+        auto locker = std::unique_lock {_receivedDataLocker};
+
+        _receivedData.insert(_receivedData.end(), _receiveThreadBuf.begin(), _receiveThreadBuf.end());
+        _receivedBytes += recv_buf.size();
+        _receivedRealBytes += _receiveThreadBuf.size();
+    }
+
+    return timespan::zero;
+}
+
+auto ClientConnection::TakeReceivedData() -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::exception_ptr receive_error;
+
+    {
+        auto locker = std::unique_lock {_receivedDataLocker};
+
+        std::swap(_receivedData, _receivedDataSwap);
+        _bytesReceived += _receivedBytes;
+        _bytesRealReceived += _receivedRealBytes;
+        _receivedBytes = 0;
+        _receivedRealBytes = 0;
+
+        if (_receivedDataSwap.empty()) {
+            receive_error = _receiveError;
+        }
+    }
+
+    // Error raised only after all data received before it is taken
+    if (receive_error) {
+        std::rethrow_exception(receive_error);
+    }
+
+    if (_receivedDataSwap.empty()) {
+        return false;
+    }
+
+    _netIn.ShrinkReadBuf();
+    _netIn.AddData(_receivedDataSwap);
+    _receivedDataSwap.clear();
+
+    return true;
+}
+
 void ClientConnection::Net_SendHandshake()
 {
     FO_STACK_TRACE_ENTRY();
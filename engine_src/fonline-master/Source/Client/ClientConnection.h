@@ -40,6 +40,7 @@
 #include "NetBuffer.h"
 #include "NetworkClient.h"
 #include "Settings.h"
+#include "WorkThread.h"
 
 FO_BEGIN_NAMESPACE();
 
@@ -65,7 +66,7 @@ public:
     ClientConnection(ClientConnection&&) noexcept = delete;
     auto operator=(const ClientConnection&) = delete;
     auto operator=(ClientConnection&&) noexcept = delete;
-    ~ClientConnection() = default;
+    ~ClientConnection();
 
     [[nodiscard]] auto IsConnecting() const noexcept -> bool { return _netConnection && !_wasHandshake; }
     [[nodiscard]] auto IsConnected() const noexcept -> bool { return _netConnection && _wasHandshake; }
@@ -87,6 +88,10 @@ private:
     void ProcessConnection();
     auto ReceiveData() -> bool;
     void SendData();
+    void StartReceiveThread();
+    void StopReceiveThread();
+    auto ReceiveThreadJob() -> optional<timespan>;
+    auto TakeReceivedData() -> bool;
 
     void Net_SendHandshake();
     void Net_OnHandshakeAnswer();
@@ -113,6 +118,17 @@ private:
 #if FO_DEBUG
     vector<NetMessage> _msgHistory {};
 #endif
+
+    // Background receiving, connection access is guarded while receive thread is active
+    unique_ptr<WorkThread> _receiveThread {};
+    std::mutex _connectionLocker {};
+    vector<uint8> _receiveThreadBuf {};
+    vector<uint8> _receivedData {};
+    vector<uint8> _receivedDataSwap {};
+    size_t _receivedBytes {};
+    size_t _receivedRealBytes {};
+    std::exception_ptr _receiveError {};
+    std::mutex _receivedDataLocker {};
 };
 
 FO_END_NAMESPACE();
@@ -46,6 +46,7 @@ public:
     ~NetworkClientConnection_Interthread() override = default;
 
     auto CheckStatusImpl(bool for_write) -> bool override;
+    auto WaitReceiveImpl(timespan timeout) -> bool override;
     auto SendDataImpl(span<const uint8> buf) -> size_t override;
     auto ReceiveDataImpl(vector<uint8>& buf) -> size_t override;
     void DisconnectImpl() noexcept override;
@@ -54,6 +55,7 @@ private:
     InterthreadDataCallback _interthreadSend {};
     vector<uint8> _interthreadReceived {};
     std::mutex _interthreadReceivedLocker {};
+    std::condition_variable _interthreadReceivedSignal {};
     std::atomic_bool _interthreadRequestDisconnect {};
 };
 
@@ -74,14 +76,18 @@ NetworkClientConnection_Interthread::NetworkClientConnection_Interthread(ClientN
     const auto port = numeric_cast<uint16>(_settings->ServerPort);
 
     _interthreadSend = InterthreadListeners[port]([this](span<const uint8> buf) {
-        if (!buf.empty()) {
+        {
             auto locker = std::unique_lock {_interthreadReceivedLocker};
 
-            _interthreadReceived.insert(_interthreadReceived.end(), buf.begin(), buf.end());
-        }
-        else {
-            _interthreadRequestDisconnect = true;
+            if (!buf.empty()) {
+                _interthreadReceived.insert(_interthreadReceived.end(), buf.begin(), buf.end());
+            }
+            else {
+                _interthreadRequestDisconnect = true;
+            }
         }
+
+        _interthreadReceivedSignal.notify_one();
     });
 
     WriteLog("Connected to server via interthread communication");
@@ -104,6 +110,15 @@ auto NetworkClientConnection_Interthread::CheckStatusImpl(bool for_write) -> boo
     return for_write ? true : !_interthreadReceived.empty();
 }
 
+auto NetworkClientConnection_Interthread::WaitReceiveImpl(timespan timeout) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto locker = std::unique_lock {_interthreadReceivedLocker};
+
+    return _interthreadReceivedSignal.wait_for(locker, timeout.value(), [this] { return !_interthreadReceived.empty() || _interthreadRequestDisconnect || !_isConnected; });
+}
+
 auto NetworkClientConnection_Interthread::SendDataImpl(span<const uint8> buf) -> size_t
 {
     FO_STACK_TRACE_ENTRY();
@@ -148,6 +163,13 @@ void NetworkClientConnection_Interthread::DisconnectImpl() noexcept
     if (interthread_send) {
         safe_call([&] { interthread_send({}); });
     }
+
+    // Wake waiting receive, locking orders wakeup after its predicate check
+    {
+        auto locker = std::unique_lock {_interthreadReceivedLocker};
+    }
+
+    _interthreadReceivedSignal.notify_all();
 }
 
 FO_END_NAMESPACE();
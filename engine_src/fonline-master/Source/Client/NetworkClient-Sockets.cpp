@@ -72,6 +72,7 @@ public:
 
 protected:
     auto CheckStatusImpl(bool for_write) -> bool override;
+    auto WaitReceiveImpl(timespan timeout) -> bool override;
     auto SendDataImpl(span<const uint8> buf) -> size_t override;
     auto ReceiveDataImpl(vector<uint8>& buf) -> size_t override;
     void DisconnectImpl() noexcept override;
@@ -389,6 +390,23 @@ auto NetworkClientConnection_Sockets::CheckStatusImpl(bool for_write) -> bool
     }
 }
 
+auto NetworkClientConnection_Sockets::WaitReceiveImpl(timespan timeout) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto timeout_us = timeout.microseconds();
+
+    // ReSharper disable once CppLocalVariableMayBeConst
+    timeval tv = {.tv_sec = numeric_cast<decltype(tv.tv_sec)>(timeout_us / 1000000), .tv_usec = numeric_cast<decltype(tv.tv_usec)>(timeout_us % 1000000)};
+
+    fd_set sock_set;
+    FD_ZERO(&sock_set);
+    FD_SET(_netSock, &sock_set);
+
+    // Errors are reported as readiness to let status check handle them
+    return ::select(numeric_cast<int32>(_netSock) + 1, &sock_set, nullptr, nullptr, &tv) != 0;
+}
+
 auto NetworkClientConnection_Sockets::SendDataImpl(span<const uint8> buf) -> size_t
 {
     FO_STACK_TRACE_ENTRY();
@@ -487,9 +505,9 @@ void NetworkClientConnection_Sockets::DisconnectImpl() noexcept
 {
     FO_STACK_TRACE_ENTRY();
 
+    // Receive thread may wait on socket, so it is only shut down here and closed in destructor
     if (_netSock != INVALID_SOCKET) {
-        ::closesocket(_netSock);
-        _netSock = INVALID_SOCKET;
+        ::shutdown(_netSock, SD_BOTH);
     }
 }
 
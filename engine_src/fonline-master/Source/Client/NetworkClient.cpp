@@ -61,6 +61,18 @@ auto NetworkClientConnection::CheckStatus(bool for_write) -> bool
     }
 }
 
+auto NetworkClientConnection::WaitReceive(timespan timeout) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // May be called from other thread without connection locking, disconnect wakes it up and errors are handled by next status check
+    if (!_isConnected) {
+        return false;
+    }
+
+    return WaitReceiveImpl(timeout);
+}
+
 auto NetworkClientConnection::SendData(span<const uint8> buf) -> size_t
 {
     FO_STACK_TRACE_ENTRY();
@@ -101,20 +113,18 @@ void NetworkClientConnection::Disconnect() noexcept
 {
     FO_STACK_TRACE_ENTRY();
 
-    if (!_isConnecting && !_isConnected) {
+    const auto was_connecting = _isConnecting.exchange(false);
+    const auto was_connected = _isConnected.exchange(false);
+
+    if (!was_connecting && !was_connected) {
         return;
     }
 
-    if (_isConnecting) {
+    if (was_connecting) {
         WriteLog("Can't connect to the server");
-
-        _isConnecting = false;
     }
-
-    if (_isConnected) {
+    if (was_connected) {
         WriteLog("Disconnect from the server");
-
-        _isConnected = false;
     }
 
     DisconnectImpl();
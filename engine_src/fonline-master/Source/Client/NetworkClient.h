@@ -57,6 +57,7 @@ public:
     [[nodiscard]] auto GetBytesReceived() const noexcept -> size_t { return _bytesReceived; }
 
     auto CheckStatus(bool for_write) -> bool;
+    auto WaitReceive(timespan timeout) -> bool;
     auto SendData(span<const uint8> buf) -> size_t;
     auto ReceiveData() -> span<const uint8>;
     void Disconnect() noexcept;
@@ -66,13 +67,15 @@ public:
 
 protected:
     virtual auto CheckStatusImpl(bool for_write) -> bool = 0;
+    virtual auto WaitReceiveImpl(timespan timeout) -> bool = 0;
     virtual auto SendDataImpl(span<const uint8> buf) -> size_t = 0;
     virtual auto ReceiveDataImpl(vector<uint8>& buf) -> size_t = 0;
+    // Must wake waiting receive but keep connection resources alive until destruction
     virtual void DisconnectImpl() noexcept = 0;
 
     raw_ptr<ClientNetworkSettings> _settings;
-    bool _isConnecting {};
-    bool _isConnected {};
+    std::atomic_bool _isConnecting {};
+    std::atomic_bool _isConnected {};
 
 private:
     size_t _bytesSend {};
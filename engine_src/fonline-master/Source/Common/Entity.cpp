@@ -295,7 +295,7 @@ void Entity::SetValueAsAny(int32 prop_index, const any_t& value)
 
 auto Entity::GetInnerEntities(hstring entry) const noexcept -> const vector<refcount_ptr<Entity>>*
 {
-    FO_STACK_TRACE_ENTRY();
+    FO_HOT_STACK_TRACE_ENTRY();
 
     if (!_innerEntities) {
         return nullptr;
@@ -312,7 +312,7 @@ auto Entity::GetInnerEntities(hstring entry) const noexcept -> const vector<refc
 
 auto Entity::GetInnerEntities(hstring entry) noexcept -> vector<refcount_ptr<Entity>>*
 {
-    FO_STACK_TRACE_ENTRY();
+    FO_HOT_STACK_TRACE_ENTRY();
 
     if (!_innerEntities) {
         return nullptr;
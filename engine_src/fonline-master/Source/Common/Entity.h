@@ -159,6 +159,7 @@ public:
     [[nodiscard]] auto GetPropertiesForEdit() noexcept -> Properties& { return _props; }
     [[nodiscard]] auto IsDestroying() const noexcept -> bool { return _isDestroying; }
     [[nodiscard]] auto IsDestroyed() const noexcept -> bool { return _isDestroyed; }
+    [[nodiscard]] auto GetRefCount() const noexcept -> int32 { return _refCounter.load(std::memory_order_relaxed); }
     [[nodiscard]] auto GetValueAsInt(const Property* prop) const -> int32;
     [[nodiscard]] auto GetValueAsInt(int32 prop_index) const -> int32;
     [[nodiscard]] auto GetValueAsAny(const Property* prop) const -> any_t;
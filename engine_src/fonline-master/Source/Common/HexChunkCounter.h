@@ -0,0 +1,102 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "Geometry.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Count of marked hexes per square chunk, lets hex walks skip lookups in chunks without marks
+class HexChunkCounter final
+{
+public:
+    static constexpr int32 CHUNK_SIZE = 16;
+
+    HexChunkCounter() noexcept = default;
+    explicit HexChunkCounter(msize size) :
+        _size {size},
+        _chunksWidth {(size.width + CHUNK_SIZE - 1) / CHUNK_SIZE}
+    {
+        FO_RUNTIME_ASSERT(size.width > 0);
+        FO_RUNTIME_ASSERT(size.height > 0);
+
+        _counts.resize(numeric_cast<size_t>(_chunksWidth) * numeric_cast<size_t>((size.height + CHUNK_SIZE - 1) / CHUNK_SIZE));
+    }
+    HexChunkCounter(const HexChunkCounter&) = delete;
+    HexChunkCounter(HexChunkCounter&&) noexcept = default;
+    auto operator=(const HexChunkCounter&) = delete;
+    auto operator=(HexChunkCounter&&) noexcept -> HexChunkCounter& = default;
+    ~HexChunkCounter() = default;
+
+    [[nodiscard]] auto GetSize() const noexcept -> msize { return _size; }
+    [[nodiscard]] auto GetChunksCount() const noexcept -> size_t { return _counts.size(); }
+    [[nodiscard]] auto GetMemoryUsage() const noexcept -> size_t { return _counts.capacity() * sizeof(int32); }
+    [[nodiscard]] auto GetCount(mpos hex) const noexcept -> int32 { return _counts[GetChunkIndex(hex)]; }
+    [[nodiscard]] auto IsEmpty(mpos hex) const noexcept -> bool { return _counts[GetChunkIndex(hex)] == 0; }
+
+    void Add(mpos hex) noexcept { _counts[GetChunkIndex(hex)]++; }
+
+    void Remove(mpos hex)
+    {
+        auto& count = _counts[GetChunkIndex(hex)];
+        FO_RUNTIME_ASSERT(count > 0);
+        count--;
+    }
+
+    void Update(mpos hex, bool was_marked, bool marked)
+    {
+        if (marked != was_marked) {
+            if (marked) {
+                Add(hex);
+            }
+            else {
+                Remove(hex);
+            }
+        }
+    }
+
+private:
+    [[nodiscard]] auto GetChunkIndex(mpos hex) const noexcept -> size_t
+    {
+        return numeric_cast<size_t>(hex.y / CHUNK_SIZE) * numeric_cast<size_t>(_chunksWidth) + numeric_cast<size_t>(hex.x / CHUNK_SIZE);
+    }
+
+    msize _size {};
+    int32 _chunksWidth {};
+    vector<int32> _counts {};
+};
+
+FO_END_NAMESPACE();
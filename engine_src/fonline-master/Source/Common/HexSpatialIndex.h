@@ -0,0 +1,165 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "Geometry.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Entities bucketed by square chunks of hexes for area lookups
+// Hex of entity stored along with it, owner keeps it actual through Move
+template<typename T>
+class HexSpatialIndex final
+{
+public:
+    static constexpr int32 CHUNK_SIZE = 16;
+
+    explicit HexSpatialIndex(msize size) :
+        _size {size},
+        _chunksWidth {(size.width + CHUNK_SIZE - 1) / CHUNK_SIZE},
+        _chunksHeight {(size.height + CHUNK_SIZE - 1) / CHUNK_SIZE}
+    {
+        FO_RUNTIME_ASSERT(size.width > 0);
+        FO_RUNTIME_ASSERT(size.height > 0);
+
+        _chunks.resize(numeric_cast<size_t>(_chunksWidth) * numeric_cast<size_t>(_chunksHeight));
+    }
+    HexSpatialIndex(const HexSpatialIndex&) = delete;
+    HexSpatialIndex(HexSpatialIndex&&) noexcept = default;
+    auto operator=(const HexSpatialIndex&) = delete;
+    auto operator=(HexSpatialIndex&&) noexcept -> HexSpatialIndex& = default;
+    ~HexSpatialIndex() = default;
+
+    [[nodiscard]] auto GetSize() const noexcept -> msize { return _size; }
+    [[nodiscard]] auto GetEntitiesCount() const noexcept -> size_t { return _entitiesCount; }
+    [[nodiscard]] auto GetChunksCount() const noexcept -> size_t { return _chunks.size(); }
+
+    void Add(T* entity, mpos hex)
+    {
+        FO_RUNTIME_ASSERT(entity);
+        FO_RUNTIME_ASSERT(_size.is_valid_pos(hex));
+
+        GetChunk(hex).emplace_back(Entry {.Entity = entity, .Hex = hex});
+        _entitiesCount++;
+    }
+
+    void Remove(T* entity, mpos hex)
+    {
+        FO_RUNTIME_ASSERT(_size.is_valid_pos(hex));
+
+        auto& chunk = GetChunk(hex);
+        const auto it = std::ranges::find_if(chunk, [&](const Entry& entry) { return entry.Entity.get() == entity && entry.Hex == hex; });
+        FO_RUNTIME_ASSERT(it != chunk.end());
+
+        *it = chunk.back();
+        chunk.pop_back();
+        _entitiesCount--;
+    }
+
+    void Move(T* entity, mpos from_hex, mpos to_hex)
+    {
+        if (from_hex != to_hex) {
+            Remove(entity, from_hex);
+            Add(entity, to_hex);
+        }
+    }
+
+    void Clear() noexcept
+    {
+        for (auto& chunk : _chunks) {
+            chunk.clear();
+        }
+
+        _entitiesCount = 0;
+    }
+
+    // Callback receives entity and its hex, rect bounds are inclusive and clamped to grid
+    template<typename F>
+    void ForEachInRect(int32 from_x, int32 from_y, int32 to_x, int32 to_y, const F& callback)
+    {
+        from_x = std::max(from_x, 0);
+        from_y = std::max(from_y, 0);
+        to_x = std::min(to_x, _size.width - 1);
+        to_y = std::min(to_y, _size.height - 1);
+
+        if (from_x > to_x || from_y > to_y) {
+            return;
+        }
+
+        for (int32 cy = from_y / CHUNK_SIZE; cy <= to_y / CHUNK_SIZE; cy++) {
+            for (int32 cx = from_x / CHUNK_SIZE; cx <= to_x / CHUNK_SIZE; cx++) {
+                auto& chunk = _chunks[numeric_cast<size_t>(cy * _chunksWidth + cx)];
+
+                // Whole chunk inside rect, skip per entry bounds check
+                const auto inside = cx * CHUNK_SIZE >= from_x && cy * CHUNK_SIZE >= from_y && (cx + 1) * CHUNK_SIZE - 1 <= to_x && (cy + 1) * CHUNK_SIZE - 1 <= to_y;
+
+                for (auto& entry : chunk) {
+                    if (inside || (entry.Hex.x >= from_x && entry.Hex.x <= to_x && entry.Hex.y >= from_y && entry.Hex.y <= to_y)) {
+                        callback(entry.Entity.get(), entry.Hex);
+                    }
+                }
+            }
+        }
+    }
+
+    // Hex distance never less than coordinate difference, so radius bounding rect covers all candidates
+    template<typename F>
+    void ForEachInRadius(mpos hex, int32 radius, const F& callback)
+    {
+        ForEachInRect(hex.x - radius, hex.y - radius, hex.x + radius, hex.y + radius, [&](T* entity, mpos entity_hex) {
+            if (GeometryHelper::GetDistance(hex, entity_hex) <= radius) {
+                callback(entity, entity_hex);
+            }
+        });
+    }
+
+private:
+    struct Entry
+    {
+        raw_ptr<T> Entity {};
+        mpos Hex {};
+    };
+
+    [[nodiscard]] auto GetChunk(mpos hex) noexcept -> vector<Entry>& { return _chunks[numeric_cast<size_t>((hex.y / CHUNK_SIZE) * _chunksWidth + hex.x / CHUNK_SIZE)]; }
+
+    msize _size;
+    int32 _chunksWidth;
+    int32 _chunksHeight;
+    vector<vector<Entry>> _chunks {};
+    size_t _entitiesCount {};
+};
+
+FO_END_NAMESPACE();
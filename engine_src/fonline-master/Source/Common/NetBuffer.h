@@ -66,7 +66,7 @@ protected:
     auto EncryptKey(int32 move) noexcept -> uint8;
     void CopyBuf(const void* from, void* to, uint8 crypt_key, size_t len) const noexcept;
 
-    vector<uint8> _bufData {};
+    tagged_vector<uint8, MemoryCategory::NetBuffers> _bufData {};
     size_t _defaultBufLen {};
     size_t _bufEndPos {};
     bool _encryptActive {};
@@ -60,6 +60,7 @@ static constexpr CmdDef CMD_LIST[] = {
     {"run", CMD_RUNSCRIPT},
     {"regenmap", CMD_REGENMAP},
     {"log", CMD_LOG},
+    {"profiler", CMD_PROFILER},
 };
 
 auto PackNetCommand(string_view str, NetOutBuffer* pbuf, const LogCallback& logcb, HashResolver& hash_resolver) -> bool
@@ -282,6 +283,22 @@ auto PackNetCommand(string_view str, NetOutBuffer* pbuf, const LogCallback& logc
         buf.Write(flags);
         buf.EndMsg();
     } break;
+    case CMD_PROFILER: {
+        string action;
+        if (!(args_str >> action) || (action != "start" && action != "stop" && action != "reset" && action != "top" && action != "dump")) {
+            logcb("Invalid arguments. Example: profiler action [param]. Valid actions: 'start [interval_us]', 'stop', 'reset', 'top [count]', 'dump [name]'");
+            break;
+        }
+
+        string param;
+        args_str >> param;
+
+        buf.StartMsg(msg);
+        buf.Write(cmd);
+        buf.Write(action);
+        buf.Write(param);
+        buf.EndMsg();
+    } break;
     default:
         return false;
     }
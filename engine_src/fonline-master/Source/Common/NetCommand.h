@@ -55,6 +55,7 @@ static constexpr auto CMD_ADDLOCATION = 16;
 static constexpr auto CMD_RUNSCRIPT = 20;
 static constexpr auto CMD_REGENMAP = 25;
 static constexpr auto CMD_LOG = 37;
+static constexpr auto CMD_PROFILER = 38;
 
 using LogCallback = function<void(string_view)>;
 
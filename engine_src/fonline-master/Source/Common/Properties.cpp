@@ -140,10 +140,24 @@ void Properties::AllocData() noexcept
     FO_STRONG_ASSERT(!_podData);
     FO_STRONG_ASSERT(_registrator->_registeredProperties.size() > 1);
 
-    _podData = SafeAlloc::MakeUniqueArr<uint8>(_registrator->_wholePodDataSize);
+    // Same sized blobs of all entities of the type share one pool
+    auto& pod_data_pool = MemoryPool::GetForSize(_registrator->_wholePodDataSize, MemoryCategory::Properties);
+    _podData = std::unique_ptr<uint8[], MemoryPoolDeleter>(static_cast<uint8*>(pod_data_pool.Allocate()), MemoryPoolDeleter {.Pool = &pod_data_pool});
     MemFill(_podData.get(), 0, _registrator->_wholePodDataSize);
 
     _complexData = SafeAlloc::MakeUniqueArr<pair<unique_arr_ptr<uint8>, size_t>>(_registrator->_complexProperties.size());
+    _complexDataSize.Set(_registrator->_complexProperties.size() * sizeof(pair<unique_arr_ptr<uint8>, size_t>));
+}
+
+auto Properties::GetMemoryUsage() const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (!_podData) {
+        return sizeof(*this);
+    }
+
+    return sizeof(*this) + _registrator->_wholePodDataSize + _complexDataSize.Get();
 }
 
 auto Properties::Copy() const noexcept -> Properties
@@ -158,6 +172,7 @@ auto Properties::Copy() const noexcept -> Properties
         if (_complexData[i].first) {
             props._complexData[i].first = SafeAlloc::MakeUniqueArr<uint8>(_complexData[i].second);
             props._complexData[i].second = _complexData[i].second;
+            props._complexDataSize.Add(_complexData[i].second);
             MemCopy(props._complexData[i].first.get(), _complexData[i].first.get(), _complexData[i].second);
         }
     }
@@ -732,6 +747,9 @@ void Properties::SetRawData(const Property* prop, span<const uint8> raw_data) no
         auto& complex_data = _complexData[*prop->_complexDataIndex];
 
         if (raw_data.size() != complex_data.second) {
+            _complexDataSize.Sub(complex_data.second);
+            _complexDataSize.Add(raw_data.size());
+
             if (!raw_data.empty()) {
                 complex_data.first = SafeAlloc::MakeUniqueArr<uint8>(raw_data.size());
                 complex_data.second = raw_data.size();
@@ -1296,7 +1314,7 @@ void PropertyRegistrator::RegisterComponent(string_view name)
 
 auto PropertyRegistrator::GetPropertyByIndex(int32 property_index) const noexcept -> const Property*
 {
-    FO_STACK_TRACE_ENTRY();
+    FO_HOT_STACK_TRACE_ENTRY();
 
     // Skip None entry
     if (property_index >= 1 && static_cast<size_t>(property_index) < _registeredProperties.size()) {
@@ -1572,6 +1590,14 @@ void PropertyRegistrator::RegisterProperty(const span<const string_view>& flags)
             FO_RUNTIME_ASSERT(!prop->_isNullGetterForProto);
             prop->_isNullGetterForProto = true;
         }
+        else if (flags[i] == "HashIndex") {
+            FO_RUNTIME_ASSERT(!prop->_isHashIndexed);
+            prop->_isHashIndexed = true;
+        }
+        else if (flags[i] == "SortedIndex") {
+            FO_RUNTIME_ASSERT(!prop->_isSortedIndexed);
+            prop->_isSortedIndexed = true;
+        }
         else if (flags[i] == "SharedProperty") {
             // For internal use, skip
         }
@@ -1595,6 +1621,8 @@ void PropertyRegistrator::RegisterProperty(const span<const string_view>& flags)
     FO_RUNTIME_ASSERT(!prop->_isVirtual || !prop->_isSynced);
     FO_RUNTIME_ASSERT(!prop->_isVirtual || !prop->_isPersistent);
     FO_RUNTIME_ASSERT(!prop->_isNullGetterForProto || prop->_isVirtual);
+    FO_RUNTIME_ASSERT(!(prop->_isHashIndexed && prop->_isSortedIndexed));
+    FO_RUNTIME_ASSERT(!(prop->_isHashIndexed || prop->_isSortedIndexed) || (prop->_isPlainData && !prop->_isVirtual && !prop->_isClientOnly));
 
     const auto reg_index = numeric_cast<uint16>(_registeredProperties.size());
 
@@ -186,6 +186,9 @@ public:
     [[nodiscard]] auto IsPersistent() const noexcept -> bool { return _isPersistent; }
     [[nodiscard]] auto IsHistorical() const noexcept -> bool { return _isHistorical; }
     [[nodiscard]] auto IsNullGetterForProto() const noexcept -> bool { return _isNullGetterForProto; }
+    [[nodiscard]] auto IsHashIndexed() const noexcept -> bool { return _isHashIndexed; }
+    [[nodiscard]] auto IsSortedIndexed() const noexcept -> bool { return _isSortedIndexed; }
+    [[nodiscard]] auto IsIndexed() const noexcept -> bool { return _isHashIndexed || _isSortedIndexed; }
     [[nodiscard]] auto IsTemporary() const noexcept -> bool { return (_isMutable || _isCoreProperty) && !_isPersistent; }
 
     [[nodiscard]] auto GetGetter() const noexcept -> auto& { return _getter; }
@@ -247,6 +250,8 @@ private:
     bool _isModifiableByAnyClient {};
     bool _isHistorical {};
     bool _isNullGetterForProto {};
+    bool _isHashIndexed {};
+    bool _isSortedIndexed {};
     uint16 _regIndex {};
     optional<size_t> _podDataOffset {};
     optional<size_t> _complexDataIndex {};
@@ -271,6 +276,7 @@ public:
     [[nodiscard]] auto Copy() const noexcept -> Properties;
     [[nodiscard]] auto GetRawData(const Property* prop) const noexcept -> span<const uint8>;
     [[nodiscard]] auto GetRawDataSize(const Property* prop) const noexcept -> size_t;
+    [[nodiscard]] auto GetMemoryUsage() const noexcept -> size_t;
     [[nodiscard]] auto GetPlainDataValueAsInt(const Property* prop) const -> int32;
     [[nodiscard]] auto GetPlainDataValueAsAny(const Property* prop) const -> any_t;
     [[nodiscard]] auto GetValueAsInt(int32 property_index) const -> int32;
@@ -351,8 +357,9 @@ public:
 
 private:
     raw_ptr<const PropertyRegistrator> _registrator;
-    unique_arr_ptr<uint8> _podData {};
+    unique_pool_ptr _podData {};
     unique_arr_ptr<pair<unique_arr_ptr<uint8>, size_t>> _complexData {};
+    TaggedMemorySize<MemoryCategory::Properties> _complexDataSize {};
 
     mutable unique_ptr<vector<const uint8*>> _storeData {};
     mutable unique_ptr<vector<uint32>> _storeDataSizes {};
@@ -932,4 +939,74 @@ void Properties::SetValue(const Property* prop, const vector<T>& new_value)
     }
 }
 
+// Typed access to non virtual plain data property, script side type may be wider than stored one (enums are int32 in scripts)
+template<typename TValue, typename TScript = TValue>
+struct PodPropertyAccess
+{
+    using ValueType = TValue;
+    using ScriptType = TScript;
+
+    [[nodiscard]] static auto Get(const Properties& props, const Property* prop) noexcept -> TScript { return static_cast<TScript>(props.GetValueFast<TValue>(prop)); }
+    static void Set(Properties& props, const Property* prop, TScript value) { props.SetValue<TValue>(prop, static_cast<TValue>(value)); }
+};
+
+// Passes typed access of bool, number or enum property to func, other properties have no typed access
+template<typename Func>
+[[nodiscard]] auto ResolvePodPropertyAccess(const Property* prop, const Func& func) -> optional<decltype(func(PodPropertyAccess<int32> {}))>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (!prop->IsPlainData() || prop->IsVirtual() || prop->IsDisabled()) {
+        return std::nullopt;
+    }
+
+    const auto size = prop->GetBaseSize();
+
+    if (prop->IsBaseTypeEnum()) {
+        switch (size) {
+        case 1:
+            return func(PodPropertyAccess<uint8, int32> {});
+        case 2:
+            return func(PodPropertyAccess<uint16, int32> {});
+        case 4:
+            return func(PodPropertyAccess<int32> {});
+        default:
+            return std::nullopt;
+        }
+    }
+
+    if (!prop->IsBaseTypePrimitive()) {
+        return std::nullopt;
+    }
+
+    if (prop->IsBaseTypeBool()) {
+        return func(PodPropertyAccess<bool> {});
+    }
+    if (prop->IsBaseTypeSingleFloat()) {
+        return func(PodPropertyAccess<float32> {});
+    }
+    if (prop->IsBaseTypeDoubleFloat()) {
+        return func(PodPropertyAccess<float64> {});
+    }
+
+    if (prop->IsBaseTypeInt()) {
+        const auto is_signed = prop->IsBaseTypeSignedInt();
+
+        switch (size) {
+        case 1:
+            return is_signed ? func(PodPropertyAccess<int8> {}) : func(PodPropertyAccess<uint8> {});
+        case 2:
+            return is_signed ? func(PodPropertyAccess<int16> {}) : func(PodPropertyAccess<uint16> {});
+        case 4:
+            return is_signed ? func(PodPropertyAccess<int32> {}) : func(PodPropertyAccess<uint32> {});
+        case 8:
+            return is_signed ? func(PodPropertyAccess<int64> {}) : func(PodPropertyAccess<uint64> {});
+        default:
+            return std::nullopt;
+        }
+    }
+
+    return std::nullopt;
+}
+
 FO_END_NAMESPACE();
@@ -0,0 +1,392 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "ScriptCoroutineScheduler.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Min heap by deadline, equal deadlines keep suspend order
+static auto DeadlineGreater(const auto& a, const auto& b) noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return a.Deadline != b.Deadline ? a.Deadline > b.Deadline : a.Order > b.Order;
+}
+
+// Swap and pop removal, empty lists are dropped
+template<typename TLists, typename TPred>
+static void EraseFromList(TLists& lists, const typename TLists::key_type& key, const TPred& pred)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto it = lists.find(key);
+
+    if (it == lists.end()) {
+        return;
+    }
+
+    auto& list = it->second;
+
+    for (size_t i = 0; i < list.size(); i++) {
+        if (pred(list[i])) {
+            list[i] = list.back();
+            list.pop_back();
+            break;
+        }
+    }
+
+    if (list.empty()) {
+        lists.erase(it);
+    }
+}
+
+auto ScriptCoroutineScheduler::EventKeyHasher::operator()(const EventKey& key) const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto hash = FO_HASH_NAMESPACE hash<hstring> {}(key.Event);
+    return hash ^ (FO_HASH_NAMESPACE hash<Target> {}(key.EventTarget) + 0x9E3779B9 + (hash << 6) + (hash >> 2));
+}
+
+auto ScriptCoroutineScheduler::GetEventWaitersCount(hstring event, Target target) const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _eventWaiters.find(EventKey {.Event = event, .EventTarget = target});
+    return it != _eventWaiters.end() ? it->second.size() : 0;
+}
+
+auto ScriptCoroutineScheduler::GetTargetWaitersCount(Target target) const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _targetWaiters.find(target);
+    return it != _targetWaiters.end() ? it->second.size() : 0;
+}
+
+auto ScriptCoroutineScheduler::GetOwnerWaitsCount(Owner owner) const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _ownerWaits.find(owner);
+    return it != _ownerWaits.end() ? it->second.size() : 0;
+}
+
+auto ScriptCoroutineScheduler::GetParkedWaitersCount(ParkKey key) const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _parkedWaiters.find(key);
+    return it != _parkedWaiters.end() ? it->second.size() : 0;
+}
+
+auto ScriptCoroutineScheduler::BeginWait(Coroutine co, optional<EventKey> event, Owner owner, optional<nanotime> deadline) -> uint64
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(co);
+    FO_RUNTIME_ASSERT(!_waits.contains(co));
+
+    const auto generation = ++_generationCounter;
+    _waits.emplace(co, WaitState {.Generation = generation, .Event = event, .WaitOwner = owner, .HasDeadline = deadline.has_value()});
+
+    if (event.has_value()) {
+        _eventWaiters[*event].emplace_back(EventWaiter {.Co = co, .Generation = generation});
+
+        if (event->EventTarget != nullptr) {
+            _targetWaiters[event->EventTarget].emplace_back(co);
+        }
+    }
+
+    if (owner != nullptr) {
+        _ownerWaits[owner].emplace_back(co);
+    }
+
+    if (deadline.has_value()) {
+        _deadlines.emplace_back(DeadlineEntry {.Deadline = *deadline, .Order = ++_orderCounter, .Co = co, .Generation = generation});
+        std::ranges::push_heap(_deadlines, [](const DeadlineEntry& a, const DeadlineEntry& b) { return DeadlineGreater(a, b); });
+        _liveDeadlines++;
+    }
+
+    return generation;
+}
+
+auto ScriptCoroutineScheduler::EndWait(Coroutine co, optional<uint64> generation) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _waits.find(co);
+
+    if (it == _waits.end() || (generation.has_value() && it->second.Generation != *generation)) {
+        return false;
+    }
+
+    const auto wait = it->second;
+    _waits.erase(it);
+
+    if (wait.Parked.has_value()) {
+        EraseFromList(_parkedWaiters, *wait.Parked, [co](Coroutine waiter) { return waiter == co; });
+    }
+    else if (wait.Event.has_value()) {
+        EraseFromList(_eventWaiters, *wait.Event, [co](const EventWaiter& waiter) { return waiter.Co == co; });
+
+        if (wait.Event->EventTarget != nullptr) {
+            EraseFromList(_targetWaiters, wait.Event->EventTarget, [co](Coroutine waiter) { return waiter == co; });
+        }
+    }
+
+    if (wait.WaitOwner != nullptr) {
+        EraseFromList(_ownerWaits, wait.WaitOwner, [co](Coroutine waiter) { return waiter == co; });
+    }
+
+    // Heap entry is left in place and becomes stale
+    if (wait.HasDeadline) {
+        FO_RUNTIME_ASSERT(_liveDeadlines != 0);
+        _liveDeadlines--;
+    }
+
+    return true;
+}
+
+auto ScriptCoroutineScheduler::WakeWaits(const vector<Coroutine>& waits, WakeReason reason) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    size_t woken = 0;
+
+    for (const auto co : waits) {
+        if (EndWait(co, std::nullopt)) {
+            _signaled.emplace_back(Wakeup {.Co = co, .Reason = reason});
+            woken++;
+        }
+    }
+
+    CompactDeadlines();
+    return woken;
+}
+
+void ScriptCoroutineScheduler::CompactDeadlines()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto stale_deadlines = _deadlines.size() - _liveDeadlines;
+
+    if (_deadlines.size() < MIN_DEADLINES_TO_COMPACT || stale_deadlines <= _liveDeadlines) {
+        return;
+    }
+
+    std::erase_if(_deadlines, [this](const DeadlineEntry& entry) {
+        const auto it = _waits.find(entry.Co);
+        return it == _waits.end() || it->second.Generation != entry.Generation;
+    });
+
+    FO_RUNTIME_ASSERT(_deadlines.size() == _liveDeadlines);
+    std::ranges::make_heap(_deadlines, [](const DeadlineEntry& a, const DeadlineEntry& b) { return DeadlineGreater(a, b); });
+}
+
+void ScriptCoroutineScheduler::SuspendUntil(Coroutine co, nanotime deadline, Owner owner)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    BeginWait(co, std::nullopt, owner, deadline);
+}
+
+void ScriptCoroutineScheduler::SuspendOnEvent(Coroutine co, hstring event, optional<nanotime> deadline, Owner owner, Target target)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    BeginWait(co, EventKey {.Event = event, .EventTarget = target}, owner, deadline);
+}
+
+auto ScriptCoroutineScheduler::NotifyEvent(hstring event, Target target) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _eventWaiters.find(EventKey {.Event = event, .EventTarget = target});
+
+    if (it == _eventWaiters.end()) {
+        return 0;
+    }
+
+    const auto waiters = std::move(it->second);
+    _eventWaiters.erase(it);
+
+    size_t woken = 0;
+
+    for (const auto& waiter : waiters) {
+        if (EndWait(waiter.Co, waiter.Generation)) {
+            _signaled.emplace_back(Wakeup {.Co = waiter.Co, .Reason = WakeReason::Event});
+            woken++;
+        }
+    }
+
+    CompactDeadlines();
+    return woken;
+}
+
+auto ScriptCoroutineScheduler::NotifyTarget(Target target) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _targetWaiters.find(target);
+
+    if (it == _targetWaiters.end()) {
+        return 0;
+    }
+
+    const auto waiters = std::move(it->second);
+    _targetWaiters.erase(it);
+
+    return WakeWaits(waiters, WakeReason::Event);
+}
+
+auto ScriptCoroutineScheduler::CancelOwner(Owner owner) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _ownerWaits.find(owner);
+
+    if (it == _ownerWaits.end()) {
+        return 0;
+    }
+
+    const auto waits = std::move(it->second);
+    _ownerWaits.erase(it);
+
+    return WakeWaits(waits, WakeReason::OwnerDestroyed);
+}
+
+auto ScriptCoroutineScheduler::ParkTarget(Target target, ParkKey key) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(target);
+
+    const auto it = _targetWaiters.find(target);
+
+    if (it == _targetWaiters.end()) {
+        return 0;
+    }
+
+    const auto waiters = std::move(it->second);
+    _targetWaiters.erase(it);
+
+    // Waits keep their deadlines, only event lookup by target is suspended
+    auto& parked = _parkedWaiters[key];
+
+    for (const auto co : waiters) {
+        auto& wait = _waits.at(co);
+        FO_RUNTIME_ASSERT(wait.Event.has_value() && wait.Event->EventTarget == target);
+
+        EraseFromList(_eventWaiters, *wait.Event, [co](const EventWaiter& waiter) { return waiter.Co == co; });
+        wait.Event->EventTarget = nullptr;
+        wait.Parked = key;
+        parked.emplace_back(co);
+    }
+
+    return waiters.size();
+}
+
+auto ScriptCoroutineScheduler::UnparkTarget(ParkKey key, Target target) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(target);
+
+    const auto it = _parkedWaiters.find(key);
+
+    if (it == _parkedWaiters.end()) {
+        return 0;
+    }
+
+    const auto waiters = std::move(it->second);
+    _parkedWaiters.erase(it);
+
+    for (const auto co : waiters) {
+        auto& wait = _waits.at(co);
+        FO_RUNTIME_ASSERT(wait.Event.has_value() && wait.Parked == key);
+
+        wait.Event->EventTarget = target;
+        wait.Parked.reset();
+        _eventWaiters[*wait.Event].emplace_back(EventWaiter {.Co = co, .Generation = wait.Generation});
+        _targetWaiters[target].emplace_back(co);
+    }
+
+    return waiters.size();
+}
+
+void ScriptCoroutineScheduler::Cancel(Coroutine co)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (EndWait(co, std::nullopt)) {
+        CompactDeadlines();
+    }
+
+    std::erase_if(_signaled, [co](const Wakeup& wakeup) { return wakeup.Co == co; });
+}
+
+void ScriptCoroutineScheduler::CollectWakeups(nanotime now, vector<Wakeup>& wakeups)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    wakeups.insert(wakeups.end(), _signaled.begin(), _signaled.end());
+    _signaled.clear();
+
+    while (!_deadlines.empty() && _deadlines.front().Deadline <= now) {
+        std::ranges::pop_heap(_deadlines, [](const DeadlineEntry& a, const DeadlineEntry& b) { return DeadlineGreater(a, b); });
+        const auto entry = _deadlines.back();
+        _deadlines.pop_back();
+
+        if (EndWait(entry.Co, entry.Generation)) {
+            wakeups.emplace_back(Wakeup {.Co = entry.Co, .Reason = WakeReason::Timeout});
+        }
+    }
+}
+
+void ScriptCoroutineScheduler::Clear() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _waits.clear();
+    _deadlines.clear();
+    _liveDeadlines = 0;
+    _eventWaiters.clear();
+    _targetWaiters.clear();
+    _ownerWaits.clear();
+    _parkedWaiters.clear();
+    _signaled.clear();
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,150 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Wait bookkeeping for suspended script coroutines (e.g. AngelScript contexts)
+// Timed waits sit in deadline heap, event waits in per event lists
+// Event may be scoped to target (entity the event is about), coroutine may be bound to owner (entity it runs for)
+// Waiters of target released from memory without destruction (unloaded) are parked by stable key until target is back
+// Stale heap entries (woken by other reason, cancelled) are skipped lazily by generation check and compacted when outnumber live ones
+class ScriptCoroutineScheduler final
+{
+public:
+    using Coroutine = const void*;
+    using Target = const void*;
+    using Owner = const void*;
+    using ParkKey = uint64;
+
+    enum class WakeReason : uint8
+    {
+        Timeout,
+        Event,
+        OwnerDestroyed,
+    };
+
+    struct Wakeup
+    {
+        Coroutine Co {};
+        WakeReason Reason {};
+    };
+
+    static constexpr size_t MIN_DEADLINES_TO_COMPACT = 64;
+
+    ScriptCoroutineScheduler() = default;
+    ScriptCoroutineScheduler(const ScriptCoroutineScheduler&) = delete;
+    ScriptCoroutineScheduler(ScriptCoroutineScheduler&&) noexcept = delete;
+    auto operator=(const ScriptCoroutineScheduler&) = delete;
+    auto operator=(ScriptCoroutineScheduler&&) noexcept = delete;
+    ~ScriptCoroutineScheduler() = default;
+
+    [[nodiscard]] auto GetSuspendedCount() const noexcept -> size_t { return _waits.size(); }
+    [[nodiscard]] auto IsSuspended(Coroutine co) const -> bool { return _waits.contains(co); }
+    [[nodiscard]] auto GetEventWaitersCount(hstring event, Target target = nullptr) const -> size_t;
+    [[nodiscard]] auto GetTargetWaitersCount(Target target) const -> size_t;
+    [[nodiscard]] auto GetOwnerWaitsCount(Owner owner) const -> size_t;
+    [[nodiscard]] auto GetParkedWaitersCount(ParkKey key) const -> size_t;
+    [[nodiscard]] auto GetDeadlinesCount() const noexcept -> size_t { return _deadlines.size(); }
+    [[nodiscard]] auto HasPendingWakeups(nanotime now) const noexcept -> bool { return !_signaled.empty() || (!_deadlines.empty() && _deadlines.front().Deadline <= now); }
+
+    void SuspendUntil(Coroutine co, nanotime deadline, Owner owner = nullptr);
+    void SuspendOnEvent(Coroutine co, hstring event, optional<nanotime> deadline, Owner owner = nullptr, Target target = nullptr);
+    auto NotifyEvent(hstring event, Target target = nullptr) -> size_t;
+    auto NotifyTarget(Target target) -> size_t;
+    auto CancelOwner(Owner owner) -> size_t;
+    auto ParkTarget(Target target, ParkKey key) -> size_t;
+    auto UnparkTarget(ParkKey key, Target target) -> size_t;
+    void Cancel(Coroutine co);
+    void CollectWakeups(nanotime now, vector<Wakeup>& wakeups);
+    void Clear() noexcept;
+
+private:
+    struct EventKey
+    {
+        auto operator==(const EventKey& other) const noexcept -> bool = default;
+
+        hstring Event {};
+        Target EventTarget {};
+    };
+
+    struct EventKeyHasher
+    {
+        auto operator()(const EventKey& key) const noexcept -> size_t;
+    };
+
+    struct WaitState
+    {
+        uint64 Generation {};
+        optional<EventKey> Event {};
+        Owner WaitOwner {};
+        bool HasDeadline {};
+        optional<ParkKey> Parked {};
+    };
+
+    struct DeadlineEntry
+    {
+        nanotime Deadline {};
+        uint64 Order {};
+        Coroutine Co {};
+        uint64 Generation {};
+    };
+
+    struct EventWaiter
+    {
+        Coroutine Co {};
+        uint64 Generation {};
+    };
+
+    auto BeginWait(Coroutine co, optional<EventKey> event, Owner owner, optional<nanotime> deadline) -> uint64;
+    auto EndWait(Coroutine co, optional<uint64> generation) -> bool;
+    auto WakeWaits(const vector<Coroutine>& waits, WakeReason reason) -> size_t;
+    void CompactDeadlines();
+
+    unordered_map<Coroutine, WaitState> _waits {};
+    vector<DeadlineEntry> _deadlines {};
+    size_t _liveDeadlines {};
+    unordered_map<EventKey, vector<EventWaiter>, EventKeyHasher> _eventWaiters {};
+    unordered_map<Target, vector<Coroutine>> _targetWaiters {};
+    unordered_map<Owner, vector<Coroutine>> _ownerWaits {};
+    unordered_map<ParkKey, vector<Coroutine>> _parkedWaiters {};
+    vector<Wakeup> _signaled {};
+    uint64 _generationCounter {};
+    uint64 _orderCounter {};
+};
+
+FO_END_NAMESPACE();
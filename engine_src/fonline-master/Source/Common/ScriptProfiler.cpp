@@ -0,0 +1,284 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "ScriptProfiler.h"
+
+FO_BEGIN_NAMESPACE();
+
+ScriptProfiler::~ScriptProfiler()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _timer.reset();
+}
+
+void ScriptProfiler::Start(timespan sample_interval)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(sample_interval > timespan::zero);
+
+    Stop();
+
+    _sampleInterval = sample_interval;
+    _pendingSamples = 0;
+    _enabled = true;
+
+    _timer = SafeAlloc::MakeUnique<WorkThread>("ScriptProfiler");
+    _timer->AddJob([this]() -> optional<timespan> {
+        // Count only ticks that hit script execution, idle time is not sampled
+        if (_activeExecutions.load(std::memory_order_relaxed) > 0) {
+            _pendingSamples.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return _sampleInterval;
+    });
+}
+
+void ScriptProfiler::Stop()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _enabled = false;
+    _timer.reset();
+    _pendingSamples = 0;
+}
+
+void ScriptProfiler::Reset()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::scoped_lock locker(_dataLocker);
+
+    _funcIndices.clear();
+    _funcStats.clear();
+    _stacks.clear();
+    _samplesCount = 0;
+    _droppedSamples = 0;
+}
+
+void ScriptProfiler::BeginExecution() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    _activeExecutions.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ScriptProfiler::EndExecution() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Ticks left after last safe point have no stack to attribute to
+    if (_activeExecutions.fetch_sub(1, std::memory_order_relaxed) == 1) {
+        _droppedSamples.fetch_add(_pendingSamples.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+auto ScriptProfiler::StackHasher::operator()(const vector<int32>& stack) const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    size_t hash = stack.size();
+
+    for (const auto index : stack) {
+        hash ^= std::hash<int32> {}(index) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+    }
+
+    return hash;
+}
+
+auto ScriptProfiler::ResolveFuncIndex(const void* func, const function<string(const void*)>& resolve_name) -> int32
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _funcIndices.find(func);
+
+    if (it != _funcIndices.end()) {
+        return it->second;
+    }
+
+    const auto index = numeric_cast<int32>(_funcStats.size());
+    _funcStats.emplace_back(FuncStats {.Name = resolve_name(func)});
+    _funcIndices.emplace(func, index);
+    return index;
+}
+
+void ScriptProfiler::AddSample(span<const void* const> call_stack, uint32 weight, const function<string(const void*)>& resolve_name)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (call_stack.empty() || weight == 0) {
+        return;
+    }
+
+    std::scoped_lock locker(_dataLocker);
+
+    _stackBuf.clear();
+
+    for (const auto* func : call_stack) {
+        _stackBuf.emplace_back(ResolveFuncIndex(func, resolve_name));
+    }
+
+    _funcStats[_stackBuf.back()].SelfSamples += weight;
+
+    // Recursive functions counted once per sample in total time
+    for (size_t i = 0; i < _stackBuf.size(); i++) {
+        if (std::find(_stackBuf.begin(), _stackBuf.begin() + numeric_cast<ptrdiff_t>(i), _stackBuf[i]) == _stackBuf.begin() + numeric_cast<ptrdiff_t>(i)) {
+            _funcStats[_stackBuf[i]].TotalSamples += weight;
+        }
+    }
+
+    _stacks[_stackBuf] += weight;
+    _samplesCount += weight;
+}
+
+auto ScriptProfiler::GetSamplesCount() const -> uint64
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::scoped_lock locker(_dataLocker);
+
+    return _samplesCount;
+}
+
+auto ScriptProfiler::GetFuncStats() const -> vector<FuncStats>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::scoped_lock locker(_dataLocker);
+
+    return _funcStats;
+}
+
+auto ScriptProfiler::GetFoldedStacks() const -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::scoped_lock locker(_dataLocker);
+
+    // Format of flamegraph.pl/inferno/speedscope: root;...;leaf count
+    vector<string> lines;
+    lines.reserve(_stacks.size());
+
+    for (const auto& [stack, count] : _stacks) {
+        string line;
+
+        for (const auto index : stack) {
+            if (!line.empty()) {
+                line += ';';
+            }
+
+            for (const auto ch : _funcStats[index].Name) {
+                line += ch == ';' ? ':' : ch;
+            }
+        }
+
+        line += strex(" {}\n", count);
+        lines.emplace_back(std::move(line));
+    }
+
+    std::ranges::sort(lines);
+
+    string result;
+
+    for (const auto& line : lines) {
+        result += line;
+    }
+
+    return result;
+}
+
+auto ScriptProfiler::MakeDumpPath(string_view name) -> optional<string>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (name.empty()) {
+        name = "ScriptProfile";
+    }
+
+    if (name.length() > MAX_DUMP_NAME_LENGTH || name.front() == '.' || name.find("..") != string_view::npos) {
+        return std::nullopt;
+    }
+
+    const auto is_allowed_char = [](char ch) { return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == '-' || ch == '.'; };
+
+    if (!std::ranges::all_of(name, is_allowed_char)) {
+        return std::nullopt;
+    }
+
+    string file_name {name};
+
+    if (!file_name.ends_with(".folded")) {
+        file_name += ".folded";
+    }
+
+    return strex(DUMP_DIR).combine_path(file_name).str();
+}
+
+auto ScriptProfiler::GetTopFunctions(size_t count) const -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::scoped_lock locker(_dataLocker);
+
+    vector<const FuncStats*> sorted_stats;
+    sorted_stats.reserve(_funcStats.size());
+
+    for (const auto& stats : _funcStats) {
+        sorted_stats.emplace_back(&stats);
+    }
+
+    std::ranges::sort(sorted_stats, [](const FuncStats* a, const FuncStats* b) { return a->SelfSamples != b->SelfSamples ? a->SelfSamples > b->SelfSamples : a->TotalSamples > b->TotalSamples; });
+
+    const auto interval_us = static_cast<float64>(_sampleInterval.microseconds());
+    const auto all_samples = static_cast<float64>(std::max(_samplesCount, static_cast<uint64>(1)));
+
+    string result;
+    result += strex("Samples: {}, interval: {}, dropped: {}\n", _samplesCount, _sampleInterval, _droppedSamples.load());
+    result += "  Self%  Total%    Self ms   Total ms  Function\n";
+
+    for (size_t i = 0; i < std::min(count, sorted_stats.size()); i++) {
+        const auto& stats = *sorted_stats[i];
+        const auto self_samples = static_cast<float64>(stats.SelfSamples);
+        const auto total_samples = static_cast<float64>(stats.TotalSamples);
+
+        result += strex("{:>7.2f} {:>7.2f} {:>10.2f} {:>10.2f}  {}\n", //
+            self_samples * 100.0 / all_samples, total_samples * 100.0 / all_samples, //
+            self_samples * interval_us / 1000.0, total_samples * interval_us / 1000.0, stats.Name);
+    }
+
+    return result;
+}
+
+FO_END_NAMESPACE();
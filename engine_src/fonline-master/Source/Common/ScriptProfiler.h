@@ -0,0 +1,109 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+#include "WorkThread.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Sampling profiler for script code
+// Timer thread only counts ticks while scripts are running, backend consumes them
+// at its safe points (function entries, loop back edges) and reports current call stack
+class ScriptProfiler final
+{
+public:
+    struct FuncStats
+    {
+        string Name {};
+        uint64 SelfSamples {};
+        uint64 TotalSamples {};
+    };
+
+    // Dumps are written only to this dir, under plain file names
+    static constexpr string_view DUMP_DIR = "Profiler";
+    static constexpr size_t MAX_DUMP_NAME_LENGTH = 64;
+
+    [[nodiscard]] static auto MakeDumpPath(string_view name) -> optional<string>;
+
+    ScriptProfiler() = default;
+    ScriptProfiler(const ScriptProfiler&) = delete;
+    ScriptProfiler(ScriptProfiler&&) noexcept = delete;
+    auto operator=(const ScriptProfiler&) = delete;
+    auto operator=(ScriptProfiler&&) noexcept = delete;
+    ~ScriptProfiler();
+
+    [[nodiscard]] auto IsEnabled() const noexcept -> bool { return _enabled.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto GetSampleInterval() const noexcept -> timespan { return _sampleInterval; }
+    [[nodiscard]] auto GetSamplesCount() const -> uint64;
+    [[nodiscard]] auto GetFuncStats() const -> vector<FuncStats>;
+    [[nodiscard]] auto GetFoldedStacks() const -> string;
+    [[nodiscard]] auto GetTopFunctions(size_t count) const -> string;
+
+    void Start(timespan sample_interval);
+    void Stop();
+    void Reset();
+
+    // Called by backend from script thread
+    void BeginExecution() noexcept;
+    void EndExecution() noexcept;
+    [[nodiscard]] auto ConsumePendingSamples() noexcept -> uint32 { return _pendingSamples.load(std::memory_order_relaxed) != 0 ? _pendingSamples.exchange(0, std::memory_order_relaxed) : 0; }
+    void AddSample(span<const void* const> call_stack, uint32 weight, const function<string(const void*)>& resolve_name);
+
+private:
+    struct StackHasher
+    {
+        auto operator()(const vector<int32>& stack) const noexcept -> size_t;
+    };
+
+    auto ResolveFuncIndex(const void* func, const function<string(const void*)>& resolve_name) -> int32;
+
+    std::atomic_bool _enabled {};
+    std::atomic_int32_t _activeExecutions {};
+    std::atomic_uint32_t _pendingSamples {};
+    timespan _sampleInterval {};
+    unique_ptr<WorkThread> _timer {};
+
+    mutable std::mutex _dataLocker {};
+    unordered_map<const void*, int32> _funcIndices {};
+    vector<FuncStats> _funcStats {};
+    unordered_map<vector<int32>, uint64, StackHasher> _stacks {};
+    vector<int32> _stackBuf {};
+    uint64 _samplesCount {};
+    std::atomic_uint64_t _droppedSamples {};
+};
+
+FO_END_NAMESPACE();
@@ -186,6 +186,69 @@ void ScriptSystem::Process()
     }
 }
 
+auto ScriptSystem::NotifyEvent(hstring event, const Entity* target) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_NON_CONST_METHOD_HINT();
+
+    size_t woken = 0;
+
+    for (auto& backend : _backends) {
+        if (backend) {
+            woken += backend->NotifyEvent(event, target);
+        }
+    }
+
+    return woken;
+}
+
+void ScriptSystem::HandleEntityDestroyed(const Entity* entity)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_NON_CONST_METHOD_HINT();
+
+    for (auto& backend : _backends) {
+        if (backend) {
+            backend->HandleEntityDestroyed(entity);
+        }
+    }
+}
+
+void ScriptSystem::HandleEntityUnloaded(const Entity* entity, ident_t id)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_NON_CONST_METHOD_HINT();
+
+    for (auto& backend : _backends) {
+        if (backend) {
+            backend->HandleEntityUnloaded(entity, id);
+        }
+    }
+}
+
+void ScriptSystem::HandleEntityLoaded(const Entity* entity, ident_t id)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_NON_CONST_METHOD_HINT();
+
+    for (auto& backend : _backends) {
+        if (backend) {
+            backend->HandleEntityLoaded(entity, id);
+        }
+    }
+}
+
+auto ScriptSystem::HasBoundWaits(const Entity* entity) const -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return std::ranges::any_of(_backends, [entity](const auto& backend) { return backend && backend->HasBoundWaits(entity); });
+}
+
 auto ScriptHelpers::GetIntConvertibleEntityProperty(const BaseEngine* engine, string_view type_name, int32 prop_index) -> const Property*
 {
     FO_STACK_TRACE_ENTRY();
@@ -36,6 +36,7 @@
 #include "Common.h"
 
 #include "Entity.h"
+#include "ScriptProfiler.h"
 
 FO_BEGIN_NAMESPACE();
 
@@ -174,6 +175,7 @@ struct ScriptFuncDesc
     string Declaration {};
     shared_ptr<ScriptTypeInfo> RetType {};
     vector<shared_ptr<ScriptTypeInfo>> ArgsType {};
+    vector<void*> ArgsBackendType {}; // Backend type handles resolved once at bind time (e.g. array type info)
     bool CallSupported {};
     function<bool(initializer_list<void*>, void*) /*noexcept*/> Call {};
     bool Delegate {};
@@ -223,6 +225,12 @@ class ScriptSystemBackend
 {
 public:
     virtual ~ScriptSystemBackend() = default;
+
+    virtual auto NotifyEvent(hstring /*event*/, const Entity* /*target*/) -> size_t { return 0; }
+    virtual void HandleEntityDestroyed(const Entity* /*entity*/) { }
+    virtual void HandleEntityUnloaded(const Entity* /*entity*/, ident_t /*id*/) { }
+    virtual void HandleEntityLoaded(const Entity* /*entity*/, ident_t /*id*/) { }
+    [[nodiscard]] virtual auto HasBoundWaits(const Entity* /*entity*/) const -> bool { return false; }
 };
 
 class ScriptSystem
@@ -239,6 +247,15 @@ public:
     void HandleRemoteCall(uint32 rpc_num, Entity* entity);
     void Process();
 
+    // Wakes script coroutines waiting for event, target is entity the event is about or null for global events
+    auto NotifyEvent(hstring event, const Entity* target) -> size_t;
+    // Wakes coroutines waiting on entity and drops ones bound to it
+    void HandleEntityDestroyed(const Entity* entity);
+    // Drops coroutines bound to entity released from memory, waiters on it are kept until entity with same id is loaded
+    void HandleEntityUnloaded(const Entity* entity, ident_t id);
+    void HandleEntityLoaded(const Entity* entity, ident_t id);
+    [[nodiscard]] auto HasBoundWaits(const Entity* entity) const -> bool;
+
     void RegisterBackend(size_t index, shared_ptr<ScriptSystemBackend> backend);
 
     template<typename T>
@@ -328,6 +345,8 @@ public:
 
     [[nodiscard]] auto ResolveEngineType(std::type_index ti) const -> shared_ptr<ScriptTypeInfo>;
     [[nodiscard]] auto GetEngineTypeMap() const -> const unordered_map<string, shared_ptr<ScriptTypeInfo>>& { return _engineToScriptType; }
+    [[nodiscard]] auto GetProfiler() noexcept -> ScriptProfiler& { return _profiler; }
+    [[nodiscard]] auto GetProfiler() const noexcept -> const ScriptProfiler& { return _profiler; }
 
     template<typename T>
     void MapEnginePlainType(string_view type_name)
@@ -387,6 +406,7 @@ private:
     unordered_multimap<hstring, ScriptFuncDesc> _funcMap {};
     vector<pair<raw_ptr<ScriptFuncDesc>, int32>> _initFunc {};
     unordered_map<uint32, function<void(Entity*)>> _rpcReceivers {};
+    ScriptProfiler _profiler {};
     bool _nonConstHelper {};
 };
 
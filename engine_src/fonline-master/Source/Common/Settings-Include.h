@@ -46,6 +46,8 @@ FIXED_SETTING(string, GameVersion, "0.0.0"); // Game version, used in logs and w
 FIXED_SETTING(string, GitBranch, ""); // Git branch name (if present)
 FIXED_SETTING(string, UnpackagedSubConfig); // Config applied in unpackaged builds
 FIXED_SETTING(int32, ScriptOverrunReportTime); // Time in milliseconds to report script overrun, 0 to disable
+FIXED_SETTING(bool, ScriptRecycleArgArrays, true); // Reuse temporary array arguments passed from engine to scripts
+FIXED_SETTING(int32, ScriptProfilerSampleInterval, 1000); // Default sampling interval of script profiler in microseconds
 FIXED_SETTING(bool, DebugBuild); // If true, debug build is used, otherwise release build (read only)
 FIXED_SETTING(bool, Packaged); // If yes, then the packaging was done (read only)
 SETTING_GROUP_END();
@@ -101,6 +103,8 @@ VARIABLE_SETTING(string, ProxyPass, ""); // Proxy password
 VARIABLE_SETTING(int32, Ping); // Network ping (read only)
 VARIABLE_SETTING(bool, DebugNet, false); // If true, network debugging is enabled
 FIXED_SETTING(bool, BypassCompatibilityCheck, false); // If true, compatibility check is bypassed
+FIXED_SETTING(bool, NetReceiveThread, false); // If true, network data receiving and decompression are done in a separate thread (ignored in web build)
+FIXED_SETTING(int32, NetMessagesProcessBudget, 0); // Time budget in milliseconds for incoming net messages processing per frame (0 - unlimited)
 SETTING_GROUP_END();
 
 ///@ ExportSettings Client
@@ -304,10 +308,21 @@ FIXED_SETTING(int32, LockMaxWaitTime, 100); // Maximum lock wait time in millise
 FIXED_SETTING(int32, DataBaseCommitPeriod, 10); // Database commit period in seconds
 FIXED_SETTING(int32, DataBaseMaxCommitJobs, 100); // Maximum database commit jobs
 FIXED_SETTING(int32, LoopAverageTimeInterval, 1000); // Loop average time interval in milliseconds
+FIXED_SETTING(int32, ServerTickBudget, 0); // Loop time budget in milliseconds after which deferrable jobs and moving item visibility are postponed to next loops (0 - unlimited)
+FIXED_SETTING(int32, ServerJobMaxDeferTicks, 10); // Maximum number of loops deferrable job may be postponed in a row
+FIXED_SETTING(int32, TimeEventDeferrableRepeat, 0); // Repeating time events with repeat period in milliseconds not less than this value are processed by deferrable job (0 - never defer)
+FIXED_SETTING(int32, LoginMaxInFlight, 32); // Maximum number of logins waiting for player data from database at once (0 - login synchronously)
+FIXED_SETTING(int32, LoginMaxQueued, 1000); // Maximum number of logins in queue including ones in flight, further logins are rejected (0 - unlimited)
+FIXED_SETTING(int32, ServerJobOverrunReportPeriod, 10000); // Minimum period in milliseconds between overrun reports of same job (0 to disable reporting)
 FIXED_SETTING(bool, WriteHealthFile, false); // If true, health file is written
-FIXED_SETTING(bool, ProtoMapStaticGrid, false); // If true, proto map static grid is enabled
-FIXED_SETTING(bool, MapInstanceStaticGrid, false); // If true, map instance static grid is enabled
+FIXED_SETTING(bool, ProtoMapStaticGrid, false); // If true, proto map grid pages allocated upfront
+FIXED_SETTING(bool, MapInstanceStaticGrid, false); // If true, map instance grid pages allocated upfront
+FIXED_SETTING(int32, WorldPagingIdleTime, 0); // Time in seconds after which location without players, time events and script handles is unloaded from memory until accessed again (0 to disable)
+FIXED_SETTING(int32, WorldPagingCheckPeriod, 1000); // Period in milliseconds of idle locations check
+FIXED_SETTING(int32, HealthInfoMemoryTop, 0); // Count of entity types and maps with most memory usage shown in health info (0 to disable, walks all entities)
 FIXED_SETTING(int64, EntityStartId, 10000000001); // Entity start ID
+FIXED_SETTING(vector<int32>, BroadcastThrottleDistances); // Observer distances in hexes from which critter moving, dir and property updates are throttled (ascending, empty to disable)
+FIXED_SETTING(vector<int32>, BroadcastThrottlePeriods); // Minimum period in milliseconds between throttled updates for each distance from BroadcastThrottleDistances
 SETTING_GROUP_END();
 
 #undef FIXED_SETTING
@@ -176,7 +176,7 @@ void TimeEventManager::AddEntityTimeEventPolling(Entity* entity)
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    _timeEventEntities.emplace(entity);
+    _timeEventEntities.emplace(entity, entity);
 }
 
 void TimeEventManager::RemoveEntityTimeEventPolling(Entity* entity)
@@ -186,34 +186,87 @@ void TimeEventManager::RemoveEntityTimeEventPolling(Entity* entity)
     _timeEventEntities.erase(entity);
 }
 
-void TimeEventManager::ProcessTimeEvents()
+auto TimeEventManager::IsDeferrableTimeEvent(const Entity::TimeEventData* te) const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return _deferrableRepeatTime > timespan::zero && te->RepeatDuration >= _deferrableRepeatTime;
+}
+
+void TimeEventManager::ProcessTimeEvents(TimeEventsPass pass)
 {
     FO_STACK_TRACE_ENTRY();
 
-    for (auto& entity : copy_hold_ref(_timeEventEntities)) {
+    // Only urgent pass visits all entities, deferrable one continues with entities it has collected
+    if (pass == TimeEventsPass::Deferrable) {
+        ProcessDeferredTimeEvents();
+        return;
+    }
+
+    for (auto* entity : _timeEventEntities.iterate()) {
         if (entity->IsDestroyed()) {
-            RemoveEntityTimeEventPolling(entity.get());
+            RemoveEntityTimeEventPolling(entity);
+            continue;
+        }
+
+        const auto has_deferred = ProcessEntityTimeEvents(entity, pass);
+
+        if (entity->IsDestroyed() || !entity->HasTimeEvents()) {
+            RemoveEntityTimeEventPolling(entity);
+            continue;
+        }
+
+        if (has_deferred && _deferredEntitiesSet.emplace(entity).second) {
+            _deferredEntities.emplace_back(entity);
+        }
+    }
+}
+
+void TimeEventManager::ProcessDeferredTimeEvents()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_deferredEntities.empty()) {
+        return;
+    }
+
+    // Swap out to allow collecting from nested passes
+    vector<const Entity*> entities;
+    entities.swap(_deferredEntities);
+    _deferredEntitiesSet.clear();
+
+    for (const auto* key : entities) {
+        auto* entity = _timeEventEntities.find(key);
+
+        // Entity stopped polling since collected
+        if (entity == nullptr) {
             continue;
         }
 
-        ProcessEntityTimeEvents(entity.get());
+        refcount_ptr entity_holder = entity;
+
+        if (!entity->IsDestroyed()) {
+            ProcessEntityTimeEvents(entity, TimeEventsPass::Deferrable);
+        }
 
         if (entity->IsDestroyed() || !entity->HasTimeEvents()) {
-            RemoveEntityTimeEventPolling(entity.get());
+            RemoveEntityTimeEventPolling(entity);
         }
     }
 }
 
-void TimeEventManager::ProcessEntityTimeEvents(Entity* entity)
+auto TimeEventManager::ProcessEntityTimeEvents(Entity* entity, TimeEventsPass pass) -> bool
 {
     FO_STACK_TRACE_ENTRY();
 
     auto& timeEvents = entity->GetRawTimeEvents();
 
     if (!timeEvents || timeEvents->empty()) {
-        return;
+        return false;
     }
 
+    bool has_deferred = false;
+
     const auto time = _gameTime->GetFrameTime();
 
     for (size_t i = 0; i < timeEvents->size(); i++) {
@@ -223,11 +276,15 @@ void TimeEventManager::ProcessEntityTimeEvents(Entity* entity)
         if (te->FireTime > time) {
             continue;
         }
+        if (pass != TimeEventsPass::All && IsDeferrableTimeEvent(te.get()) != (pass == TimeEventsPass::Deferrable)) {
+            has_deferred = has_deferred || pass == TimeEventsPass::Urgent;
+            continue;
+        }
 
         const bool result = FireTimeEvent(entity, te);
 
         if (entity->IsDestroyed()) {
-            return;
+            return false;
         }
 
         if (te->Id == 0) {
@@ -257,6 +314,8 @@ void TimeEventManager::ProcessEntityTimeEvents(Entity* entity)
             i--;
         }
     }
+
+    return has_deferred;
 }
 
 auto TimeEventManager::FireTimeEvent(Entity* entity, shared_ptr<Entity::TimeEventData> te) -> bool // NOLINT(performance-unnecessary-value-param)
@@ -310,6 +369,11 @@ auto TimeEventManager::FireTimeEvent(Entity* entity, shared_ptr<Entity::TimeEven
         WriteLog("Time event {} stopped due to exception", te->FuncName);
     }
 
+    // Scripts may wait for time event by its function name
+    if (!not_found) {
+        _scriptSys->NotifyEvent(te->FuncName, entity->IsGlobal() ? nullptr : entity);
+    }
+
     return !not_found && call_result;
 }
 
@@ -42,6 +42,14 @@ FO_BEGIN_NAMESPACE();
 
 FO_DECLARE_EXCEPTION(TimeEventException);
 
+// Long repeating events tolerate late firing, so they may be processed in separate deferrable pass
+enum class TimeEventsPass : uint8
+{
+    All,
+    Urgent,
+    Deferrable,
+};
+
 class TimeEventManager
 {
 public:
@@ -56,24 +64,31 @@ public:
 
     [[nodiscard]] auto GetCurTimeEvent() -> pair<Entity*, const Entity::TimeEventData*> { return {_curTimeEventEntity.get(), _curTimeEvent.get()}; }
     [[nodiscard]] auto CountTimeEvent(Entity* entity, hstring func_name, uint32 id) const -> size_t;
+    [[nodiscard]] auto IsDeferrableTimeEvent(const Entity::TimeEventData* te) const noexcept -> bool;
+
+    void SetDeferrableRepeatTime(timespan repeat_time) noexcept { _deferrableRepeatTime = repeat_time; }
 
     auto StartTimeEvent(Entity* entity, hstring func_name, timespan delay, timespan repeat, vector<any_t> data) -> uint32;
     void ModifyTimeEvent(Entity* entity, hstring func_name, uint32 id, optional<timespan> repeat, optional<vector<any_t>> data);
     void StopTimeEvent(Entity* entity, hstring func_name, uint32 id);
-    void ProcessTimeEvents();
+    void ProcessTimeEvents(TimeEventsPass pass = TimeEventsPass::All);
 
 private:
     void AddEntityTimeEventPolling(Entity* entity);
     void RemoveEntityTimeEventPolling(Entity* entity);
-    void ProcessEntityTimeEvents(Entity* entity);
+    auto ProcessEntityTimeEvents(Entity* entity, TimeEventsPass pass) -> bool;
+    void ProcessDeferredTimeEvents();
     auto FireTimeEvent(Entity* entity, shared_ptr<Entity::TimeEventData> te) -> bool;
 
     raw_ptr<GameTimer> _gameTime;
     raw_ptr<ScriptSystem> _scriptSys;
-    unordered_set<refcount_ptr<Entity>> _timeEventEntities {};
+    epoch_map<const Entity*, Entity, refcount_ptr<Entity>> _timeEventEntities {};
+    vector<const Entity*> _deferredEntities {};
+    unordered_set<const Entity*> _deferredEntitiesSet {};
     raw_ptr<Entity> _curTimeEventEntity {};
     raw_ptr<const Entity::TimeEventData> _curTimeEvent {};
     uint32 _timeEventCounter {};
+    timespan _deferrableRepeatTime {};
     any_t _emptyAnyValue {};
     bool _nonConstHelper {};
 };
@@ -67,32 +67,41 @@ protected:
     TSize _size {};
 };
 
+// Cells stored in square pages allocated on first write, reads of untouched pages give shared empty cell
+// Class is final, so calls through concrete type pointer are not virtual
 template<typename TCell, pos_type TPos, size_type TSize>
 class DynamicTwoDimensionalGrid final : public TwoDimensionalGrid<TCell, TPos, TSize>
 {
     using base = TwoDimensionalGrid<TCell, TPos, TSize>;
 
 public:
+    static constexpr int32 PAGE_SIDE = 16;
+
     explicit DynamicTwoDimensionalGrid(TSize size) noexcept :
         base(size)
     {
         FO_STACK_TRACE_ENTRY();
+
+        _pagesWidth = static_cast<size_t>((base::_size.width + PAGE_SIDE - 1) / PAGE_SIDE);
+        _pages.resize(_pagesWidth * static_cast<size_t>((base::_size.height + PAGE_SIDE - 1) / PAGE_SIDE));
     }
 
+    [[nodiscard]] auto GetAllocatedPagesCount() const noexcept -> size_t { return static_cast<size_t>(std::ranges::count_if(_pages, [](auto&& page) { return page != nullptr; })); }
+    [[nodiscard]] auto GetMemoryUsage() const noexcept -> size_t { return sizeof(*this) + _pages.capacity() * sizeof(unique_ptr<Page>) + GetAllocatedPagesCount() * sizeof(Page); }
+
     [[nodiscard]] auto GetCellForReading(TPos pos) const noexcept -> const TCell& override
     {
         FO_NO_STACK_TRACE_ENTRY();
 
         FO_RUNTIME_VERIFY(base::_size.is_valid_pos(pos), _emptyCell);
 
-        const auto it = _cells.find(pos);
+        const auto& page = _pages[GetPageIndex(pos)];
 
-        if (it == _cells.end()) {
+        if (!page) {
             return _emptyCell;
         }
-        else {
-            return it->second;
-        }
+
+        return page->Cells[GetPageCellIndex(pos)];
     }
 
     [[nodiscard]] auto GetCellForWriting(TPos pos) -> TCell& override
@@ -101,13 +110,24 @@ public:
 
         FO_RUNTIME_ASSERT(base::_size.is_valid_pos(pos));
 
-        const auto it = _cells.find(pos);
+        auto& page = _pages[GetPageIndex(pos)];
 
-        if (it == _cells.end()) {
-            return _cells.emplace(pos, TCell {}).first->second;
+        if (!page) {
+            page = SafeAlloc::MakeUnique<Page>();
         }
-        else {
-            return it->second;
+
+        return page->Cells[GetPageCellIndex(pos)];
+    }
+
+    // Dense grids skip first write allocations
+    void Preallocate()
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        for (auto& page : _pages) {
+            if (!page) {
+                page = SafeAlloc::MakeUnique<Page>();
+            }
         }
     }
 
@@ -118,26 +138,41 @@ public:
         FO_RUNTIME_ASSERT(size.width >= 0);
         FO_RUNTIME_ASSERT(size.height >= 0);
 
-        const auto prev_width = base::_size.width;
-        const auto prev_height = base::_size.height;
+        const auto prev_size = base::_size;
+        const auto prev_pages_width = _pagesWidth;
+        auto prev_pages = std::move(_pages);
 
         base::_size = size;
+        _pagesWidth = static_cast<size_t>((base::_size.width + PAGE_SIDE - 1) / PAGE_SIDE);
+        _pages.clear();
+        _pages.resize(_pagesWidth * static_cast<size_t>((base::_size.height + PAGE_SIDE - 1) / PAGE_SIDE));
 
-        for (int64 y = 0; y < std::max(prev_height, base::_size.height); y++) {
-            for (int64 x = 0; x < std::max(prev_width, base::_size.width); x++) {
-                if (x >= base::_size.width && y >= base::_size.height && x < prev_width && y < prev_height) {
-                    const auto it = _cells.find(TPos {numeric_cast<decltype(std::declval<TPos>().x)>(x), numeric_cast<decltype(std::declval<TPos>().y)>(y)});
+        const auto keep_width = std::min(numeric_cast<int64>(prev_size.width), numeric_cast<int64>(base::_size.width));
+        const auto keep_height = std::min(numeric_cast<int64>(prev_size.height), numeric_cast<int64>(base::_size.height));
+
+        for (int64 y = 0; y < keep_height; y++) {
+            for (int64 x = 0; x < keep_width; x++) {
+                const auto& prev_page = prev_pages[static_cast<size_t>(y / PAGE_SIDE) * prev_pages_width + static_cast<size_t>(x / PAGE_SIDE)];
 
-                    if (it != _cells.end()) {
-                        _cells.erase(it);
-                    }
+                if (prev_page) {
+                    const auto pos = TPos {numeric_cast<decltype(std::declval<TPos>().x)>(x), numeric_cast<decltype(std::declval<TPos>().y)>(y)};
+                    GetCellForWriting(pos) = std::move(prev_page->Cells[GetPageCellIndex(pos)]);
                 }
             }
         }
     }
 
 private:
-    unordered_map<TPos, TCell> _cells {};
+    struct Page final : TaggedAllocation<Page, MemoryCategory::HexFields>
+    {
+        array<TCell, static_cast<size_t>(PAGE_SIDE * PAGE_SIDE)> Cells {};
+    };
+
+    [[nodiscard]] auto GetPageIndex(TPos pos) const noexcept -> size_t { return static_cast<size_t>(pos.y / PAGE_SIDE) * _pagesWidth + static_cast<size_t>(pos.x / PAGE_SIDE); }
+    [[nodiscard]] static auto GetPageCellIndex(TPos pos) noexcept -> size_t { return static_cast<size_t>(pos.y % PAGE_SIDE) * PAGE_SIDE + static_cast<size_t>(pos.x % PAGE_SIDE); }
+
+    size_t _pagesWidth {};
+    tagged_vector<unique_ptr<Page>, MemoryCategory::HexFields> _pages {};
     const TCell _emptyCell {};
 };
 
@@ -69,6 +69,14 @@ using small_vector = gch::small_vector<T, InlineCapacity, SafeAllocator<T>>;
 template<typename T>
 using vector = std::vector<T, SafeAllocator<T>>;
 
+// Containers with memory accounted in category
+template<typename T, MemoryCategory Category>
+using tagged_vector = std::vector<T, TaggedAllocator<T, Category>>;
+template<typename K, typename V, MemoryCategory Category, typename H = FO_HASH_NAMESPACE hash<K>>
+using tagged_unordered_map = ankerl::unordered_dense::segmented_map<K, V, H, std::equal_to<>, TaggedAllocator<pair<K, V>, Category>>;
+template<typename K, MemoryCategory Category, typename H = FO_HASH_NAMESPACE hash<K>>
+using tagged_unordered_set = ankerl::unordered_dense::segmented_set<K, H, std::equal_to<>, TaggedAllocator<K, Category>>;
+
 // Template helpers
 template<typename T>
 concept is_vector_collection = is_specialization<T, std::vector>::value || has_member<T, &T::inlined> /*small_vector test*/;
@@ -0,0 +1,257 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "BasicCore.h"
+#include "Containers.h"
+#include "ExceptionHadling.h"
+#include "SmartPointers.h"
+#include "StackTrace.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Keyed registry of ref counted objects which may be iterated in place while iteration body adds or removes entries
+// Non-owning by default (P = raw_ptr), owner must erase entry before object destruction
+// Removal during iteration only marks entry, marked entries are skipped and never dereferenced
+// Currently visited object is held by iterator, so iteration body may destroy it
+// Entries added during iteration are visited only by next iterations
+template<typename K, typename T, typename P = raw_ptr<T>>
+class epoch_map final
+{
+    struct entry
+    {
+        K Key;
+        P Value;
+        bool Removed;
+    };
+
+public:
+    class iterator final
+    {
+    public:
+        iterator(epoch_map* owner, size_t index, size_t end_index) noexcept :
+            _owner {owner},
+            _index {index},
+            _endIndex {end_index}
+        {
+            SkipRemoved();
+        }
+
+        [[nodiscard]] auto operator*() const noexcept -> T* { return _owner->_entries[_index].Value.get(); }
+        [[nodiscard]] auto operator==(const iterator& other) const noexcept -> bool { return _index == other._index; }
+        [[nodiscard]] auto operator!=(const iterator& other) const noexcept -> bool { return _index != other._index; }
+
+        auto operator++() noexcept -> iterator&
+        {
+            _index++;
+            SkipRemoved();
+            return *this;
+        }
+
+    private:
+        void SkipRemoved() noexcept
+        {
+            while (_index < _endIndex && _owner->_entries[_index].Removed) {
+                _index++;
+            }
+
+            if (_index < _endIndex) {
+                _current = _owner->_entries[_index].Value.get();
+            }
+            else {
+                _current = nullptr;
+            }
+        }
+
+        epoch_map* _owner;
+        size_t _index;
+        size_t _endIndex;
+        refcount_ptr<T> _current {};
+    };
+
+    class iteration final
+    {
+    public:
+        explicit iteration(epoch_map& owner) noexcept :
+            _owner {&owner},
+            _endIndex {owner._entries.size()}
+        {
+            _owner->_epoch++;
+        }
+
+        iteration(const iteration&) = delete;
+        iteration(iteration&&) noexcept = delete;
+        auto operator=(const iteration&) = delete;
+        auto operator=(iteration&&) noexcept = delete;
+
+        ~iteration()
+        {
+            if (--_owner->_epoch == 0) {
+                _owner->Collect();
+            }
+        }
+
+        [[nodiscard]] auto begin() noexcept -> iterator { return iterator(_owner, 0, _endIndex); }
+        [[nodiscard]] auto end() noexcept -> iterator { return iterator(_owner, _endIndex, _endIndex); }
+
+    private:
+        epoch_map* _owner;
+        size_t _endIndex;
+    };
+
+    epoch_map() = default;
+    epoch_map(const epoch_map&) = delete;
+    epoch_map(epoch_map&&) noexcept = delete;
+    auto operator=(const epoch_map&) = delete;
+    auto operator=(epoch_map&&) noexcept = delete;
+    ~epoch_map() = default;
+
+    [[nodiscard]] auto size() const noexcept -> size_t { return _index.size(); }
+    [[nodiscard]] auto empty() const noexcept -> bool { return _index.empty(); }
+    [[nodiscard]] auto contains(const K& key) const noexcept -> bool { return _index.count(key) != 0; }
+    [[nodiscard]] auto is_iterating() const noexcept -> bool { return _epoch != 0; }
+    [[nodiscard]] auto removed_count() const noexcept -> size_t { return _removedCount; }
+
+    [[nodiscard]] auto find(const K& key) const noexcept -> const T*
+    {
+        const auto it = _index.find(key);
+        return it != _index.end() ? _entries[it->second].Value.get() : nullptr;
+    }
+
+    [[nodiscard]] auto find(const K& key) noexcept -> T*
+    {
+        const auto it = _index.find(key);
+        return it != _index.end() ? _entries[it->second].Value.get() : nullptr;
+    }
+
+    [[nodiscard]] auto iterate() noexcept -> iteration { return iteration(*this); }
+
+    [[nodiscard]] auto values() -> vector<T*>
+    {
+        vector<T*> result;
+        result.reserve(_index.size());
+
+        for (auto& e : _entries) {
+            if (!e.Removed) {
+                result.emplace_back(e.Value.get());
+            }
+        }
+
+        return result;
+    }
+
+    auto emplace(const K& key, T* value) -> bool
+    {
+        FO_RUNTIME_ASSERT(value);
+
+        const auto [it, inserted] = _index.emplace(key, _entries.size());
+
+        if (!inserted) {
+            return false;
+        }
+
+        _entries.emplace_back(entry {.Key = key, .Value = value, .Removed = false});
+        return true;
+    }
+
+    auto erase(const K& key) noexcept -> bool
+    {
+        const auto it = _index.find(key);
+
+        if (it == _index.end()) {
+            return false;
+        }
+
+        const auto index = it->second;
+        _index.erase(it);
+
+        if (_epoch != 0) {
+            _entries[index].Removed = true;
+            _removedCount++;
+        }
+        else {
+            if (index != _entries.size() - 1) {
+                _entries[index] = std::move(_entries.back());
+                _index[_entries[index].Key] = index;
+            }
+
+            _entries.pop_back();
+        }
+
+        return true;
+    }
+
+    void clear()
+    {
+        FO_RUNTIME_ASSERT(_epoch == 0);
+
+        _index.clear();
+        _entries.clear();
+        _removedCount = 0;
+    }
+
+private:
+    void Collect() noexcept
+    {
+        if (_removedCount == 0) {
+            return;
+        }
+
+        // Keep order of alive entries, removed ones are moved to tail and released at once
+        size_t alive_count = 0;
+
+        for (size_t i = 0; i < _entries.size(); i++) {
+            if (_entries[i].Removed) {
+                continue;
+            }
+
+            if (alive_count != i) {
+                std::swap(_entries[alive_count], _entries[i]);
+                _index[_entries[alive_count].Key] = alive_count;
+            }
+
+            alive_count++;
+        }
+
+        _removedCount = 0;
+        _entries.erase(_entries.begin() + static_cast<ptrdiff_t>(alive_count), _entries.end());
+    }
+
+    unordered_map<K, size_t> _index {};
+    vector<entry> _entries {};
+    size_t _removedCount {};
+    size_t _epoch {};
+};
+
+FO_END_NAMESPACE();
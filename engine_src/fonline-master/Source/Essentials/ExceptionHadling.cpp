@@ -320,8 +320,8 @@ extern auto FormatStackTrace(const StackTraceData& st) -> string
 
     ss << "Stack trace (most recent call first):\n";
 
-    for (size_t i = std::min(st.CallsCount, STACK_TRACE_MAX_SIZE); i > 0; i--) {
-        const auto& entry = st.CallTree[i - 1];
+    for (size_t i = 0; i < st.GetStoredCount(); i++) {
+        const auto* entry = st.GetStoredEntry(i);
         ss << "- " << entry->function << " (" << strex(entry->file).extract_file_name().strv() << " line " << entry->line << ")\n";
     }
 
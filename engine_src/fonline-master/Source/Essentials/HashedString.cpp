@@ -74,7 +74,11 @@ auto HashStorage::ToHashedString(string_view s) -> hstring
 
         hstring::entry entry = {.Hash = hash_value, .Str = string(s)};
         const auto [it, inserted] = _hashStorage.emplace(hash_value, std::move(entry));
-        ignore_unused(inserted); // Do not assert because somebody else can insert it already
+
+        // Do not assert because somebody else can insert it already
+        if (inserted) {
+            ReportMemoryAlloc(MemoryCategory::Hashes, it->second.Str.capacity());
+        }
 
         return hstring(&it->second);
     }
@@ -113,7 +113,7 @@ public:
     auto ResolveHash(hstring::hash_t h, bool* failed) const noexcept -> hstring override;
 
 private:
-    unordered_map<hstring::hash_t, hstring::entry> _hashStorage {};
+    tagged_unordered_map<hstring::hash_t, hstring::entry, MemoryCategory::Hashes> _hashStorage {};
     mutable std::shared_mutex _hashStorageLocker {};
 };
 
@@ -479,4 +479,186 @@ extern void ReportAndExit(string_view message) noexcept
     ExitApp(false);
 }
 
+static std::array<std::atomic_size_t, static_cast<size_t>(MemoryCategory::Count)> MemoryCategoryBytes {};
+
+extern void ReportMemoryAlloc(MemoryCategory category, size_t size) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    MemoryCategoryBytes[static_cast<size_t>(category)].fetch_add(size, std::memory_order_relaxed);
+}
+
+extern void ReportMemoryFree(MemoryCategory category, size_t size) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    MemoryCategoryBytes[static_cast<size_t>(category)].fetch_sub(size, std::memory_order_relaxed);
+}
+
+extern auto GetMemoryCategoryBytes(MemoryCategory category) noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return MemoryCategoryBytes[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+}
+
+extern auto GetMemoryCategoryName(MemoryCategory category) noexcept -> string_view
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (category) {
+    case MemoryCategory::Entities:
+        return "Entities";
+    case MemoryCategory::Properties:
+        return "Properties";
+    case MemoryCategory::HexFields:
+        return "HexFields";
+    case MemoryCategory::Visibility:
+        return "Visibility";
+    case MemoryCategory::NetBuffers:
+        return "NetBuffers";
+    case MemoryCategory::DataBase:
+        return "DataBase";
+    case MemoryCategory::Scripts:
+        return "Scripts";
+    case MemoryCategory::Hashes:
+        return "Hashes";
+    case MemoryCategory::Count:
+        break;
+    }
+
+    return "Unknown";
+}
+
+static constexpr auto AlignPoolSize(size_t size) noexcept -> size_t
+{
+    return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+MemoryPool::MemoryPool(size_t block_size, size_t blocks_per_slab, optional<MemoryCategory> category) noexcept :
+    _blockSize {AlignPoolSize(std::max(block_size, sizeof(FreeBlock)))},
+    _blocksPerSlab {std::max(blocks_per_slab, static_cast<size_t>(1))},
+    _category {category}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+MemoryPool::~MemoryPool()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Keep memory of alive blocks valid, they are released later than pool
+    if (_usedBlocks != 0) {
+        return;
+    }
+
+    while (_slabs != nullptr) {
+        auto* slab = _slabs;
+        _slabs = slab->Next;
+        SafeAllocator<uint8>().deallocate(reinterpret_cast<uint8*>(slab), 0);
+    }
+
+    if (_category.has_value()) {
+        ReportMemoryFree(_category.value(), _slabsCount * (AlignPoolSize(sizeof(SlabHeader)) + _blockSize * _blocksPerSlab));
+    }
+}
+
+auto MemoryPool::GetForSize(size_t size, optional<MemoryCategory> category) noexcept -> MemoryPool&
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Never deleted, blocks may outlive static objects destruction
+    static auto* pools_locker = SafeAlloc::MakeRaw<std::mutex>();
+    static auto* pools = SafeAlloc::MakeRaw<std::map<pair<size_t, int32>, MemoryPool*>>();
+
+    const auto block_size = AlignPoolSize(std::max(size, sizeof(FreeBlock)));
+    const auto category_key = category.has_value() ? static_cast<int32>(category.value()) : -1;
+
+    std::unique_lock locker(*pools_locker);
+
+    auto*& pool = (*pools)[{block_size, category_key}];
+
+    if (pool == nullptr) {
+        pool = SafeAlloc::MakeRaw<MemoryPool>(block_size, DEFAULT_BLOCKS_PER_SLAB, category);
+    }
+
+    return *pool;
+}
+
+auto MemoryPool::GetUsedBlocks() const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    std::unique_lock locker(_locker);
+
+    return _usedBlocks;
+}
+
+auto MemoryPool::GetReservedBlocks() const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    std::unique_lock locker(_locker);
+
+    return _slabsCount * _blocksPerSlab;
+}
+
+auto MemoryPool::GetSlabsCount() const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    std::unique_lock locker(_locker);
+
+    return _slabsCount;
+}
+
+auto MemoryPool::Allocate() noexcept -> void*
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    std::unique_lock locker(_locker);
+
+    if (_freeBlocks == nullptr) {
+        // Operator new memory is aligned for any object, header takes first aligned slot
+        constexpr auto header_size = AlignPoolSize(sizeof(SlabHeader));
+        const auto slab_size = header_size + _blockSize * _blocksPerSlab;
+        auto* slab_data = SafeAllocator<uint8>().allocate(slab_size);
+
+        if (_category.has_value()) {
+            ReportMemoryAlloc(_category.value(), slab_size);
+        }
+
+        auto* slab = reinterpret_cast<SlabHeader*>(slab_data);
+        slab->Next = _slabs;
+        _slabs = slab;
+        _slabsCount++;
+
+        auto* blocks = slab_data + header_size;
+
+        for (size_t i = _blocksPerSlab; i > 0; i--) {
+            auto* block = reinterpret_cast<FreeBlock*>(blocks + (i - 1) * _blockSize);
+            block->Next = _freeBlocks;
+            _freeBlocks = block;
+        }
+    }
+
+    auto* block = _freeBlocks;
+    _freeBlocks = block->Next;
+    _usedBlocks++;
+
+    return block;
+}
+
+void MemoryPool::Free(void* ptr) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    std::unique_lock locker(_locker);
+
+    auto* block = static_cast<FreeBlock*>(ptr);
+    block->Next = _freeBlocks;
+    _freeBlocks = block;
+    _usedBlocks--;
+}
+
 FO_END_NAMESPACE();
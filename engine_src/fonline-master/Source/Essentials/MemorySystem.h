@@ -51,6 +51,25 @@ extern void SetBadAllocCallback(BadAllocCallback callback) noexcept;
 extern void ReportBadAlloc(string_view message, string_view type_str, size_t count, size_t size) noexcept;
 [[noreturn]] extern void ReportAndExit(string_view message) noexcept;
 
+// Live bytes accounting of memory owners of interest
+enum class MemoryCategory : uint8
+{
+    Entities,
+    Properties,
+    HexFields,
+    Visibility,
+    NetBuffers,
+    DataBase,
+    Scripts,
+    Hashes,
+    Count,
+};
+
+extern void ReportMemoryAlloc(MemoryCategory category, size_t size) noexcept;
+extern void ReportMemoryFree(MemoryCategory category, size_t size) noexcept;
+extern auto GetMemoryCategoryBytes(MemoryCategory category) noexcept -> size_t;
+extern auto GetMemoryCategoryName(MemoryCategory category) noexcept -> string_view;
+
 template<typename T>
 class SafeAllocator
 {
@@ -104,6 +123,92 @@ public:
     }
 };
 
+// Safe allocator which also accounts allocated bytes in specified category
+template<typename T, MemoryCategory Category>
+class TaggedAllocator
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = TaggedAllocator<U, Category>;
+    };
+
+    TaggedAllocator() noexcept = default;
+    template<typename U>
+    // ReSharper disable once CppNonExplicitConvertingConstructor
+    constexpr TaggedAllocator(const TaggedAllocator<U, Category>& other) noexcept
+    {
+        (void)other;
+    }
+    template<typename U>
+    [[nodiscard]] auto operator==(const TaggedAllocator<U, Category>& other) const noexcept -> bool
+    {
+        (void)other;
+        return true;
+    }
+
+    // ReSharper disable once CppInconsistentNaming
+    [[nodiscard]] auto allocate(size_t count) const noexcept -> T*
+    {
+        auto* ptr = SafeAllocator<T>().allocate(count);
+        ReportMemoryAlloc(Category, sizeof(T) * count);
+        return ptr;
+    }
+
+    // ReSharper disable once CppInconsistentNaming
+    void deallocate(T* ptr, size_t count) const noexcept
+    {
+        ReportMemoryFree(Category, sizeof(T) * count);
+        SafeAllocator<T>().deallocate(ptr, count);
+    }
+};
+
+// Size of memory owned through untagged allocations, accounted until destruction
+template<MemoryCategory Category>
+class TaggedMemorySize
+{
+public:
+    TaggedMemorySize() noexcept = default;
+    TaggedMemorySize(const TaggedMemorySize&) = delete;
+    TaggedMemorySize(TaggedMemorySize&& other) noexcept :
+        _size {std::exchange(other._size, 0)}
+    {
+    }
+    auto operator=(const TaggedMemorySize&) = delete;
+    auto operator=(TaggedMemorySize&& other) noexcept -> TaggedMemorySize&
+    {
+        if (this != &other) {
+            Set(0);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+    ~TaggedMemorySize() { Set(0); }
+
+    [[nodiscard]] auto Get() const noexcept -> size_t { return _size; }
+
+    void Set(size_t size) noexcept
+    {
+        if (size > _size) {
+            ReportMemoryAlloc(Category, size - _size);
+        }
+        else if (size < _size) {
+            ReportMemoryFree(Category, _size - size);
+        }
+
+        _size = size;
+    }
+
+    void Add(size_t size) noexcept { Set(_size + size); }
+    void Sub(size_t size) noexcept { Set(_size - std::min(size, _size)); }
+
+private:
+    size_t _size {};
+};
+
 class SafeAlloc
 {
 public:
@@ -217,6 +322,118 @@ public:
     }
 };
 
+// Slab allocator of fixed size blocks for frequently created and destroyed objects
+// Slabs are kept for reuse until pool destruction, freed blocks are handed out first
+class MemoryPool final
+{
+public:
+    static constexpr size_t DEFAULT_BLOCKS_PER_SLAB = 64;
+
+    MemoryPool() = delete;
+    explicit MemoryPool(size_t block_size, size_t blocks_per_slab = DEFAULT_BLOCKS_PER_SLAB, optional<MemoryCategory> category = std::nullopt) noexcept;
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool(MemoryPool&&) noexcept = delete;
+    auto operator=(const MemoryPool&) = delete;
+    auto operator=(MemoryPool&&) noexcept = delete;
+    ~MemoryPool();
+
+    // Shared pool for blocks of some size, lives until process exit
+    [[nodiscard]] static auto GetForSize(size_t size, optional<MemoryCategory> category = std::nullopt) noexcept -> MemoryPool&;
+
+    [[nodiscard]] auto GetBlockSize() const noexcept -> size_t { return _blockSize; }
+    [[nodiscard]] auto GetCategory() const noexcept -> optional<MemoryCategory> { return _category; }
+    [[nodiscard]] auto GetUsedBlocks() const noexcept -> size_t;
+    [[nodiscard]] auto GetReservedBlocks() const noexcept -> size_t;
+    [[nodiscard]] auto GetSlabsCount() const noexcept -> size_t;
+
+    [[nodiscard]] auto Allocate() noexcept -> void*;
+    void Free(void* ptr) noexcept;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct SlabHeader
+    {
+        SlabHeader* Next;
+    };
+
+    const size_t _blockSize;
+    const size_t _blocksPerSlab;
+    const optional<MemoryCategory> _category;
+    mutable std::mutex _locker {};
+    FreeBlock* _freeBlocks {};
+    SlabHeader* _slabs {};
+    size_t _slabsCount {};
+    size_t _usedBlocks {};
+};
+
+// Returns memory pool blocks back on destruction
+struct MemoryPoolDeleter
+{
+    MemoryPool* Pool {};
+
+    void operator()(uint8* ptr) const noexcept { Pool->Free(ptr); }
+};
+
+using unique_pool_ptr = propagate_const<std::unique_ptr<uint8[], MemoryPoolDeleter>>;
+
+// Class allocations served from own type pool, derived class must be final
+template<typename T>
+class PooledAllocation
+{
+public:
+    [[nodiscard]] static auto GetMemoryPool() noexcept -> MemoryPool&
+    {
+        // Never deleted, instances may outlive static objects destruction
+        static auto* pool = SafeAlloc::MakeRaw<MemoryPool>(sizeof(T), MemoryPool::DEFAULT_BLOCKS_PER_SLAB, MemoryCategory::Entities);
+        return *pool;
+    }
+
+    [[nodiscard]] static auto operator new(size_t size) noexcept -> void*
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+
+        if (size != sizeof(T)) {
+            ReportAndExit("Pooled allocation size mismatch");
+        }
+
+        return GetMemoryPool().Allocate();
+    }
+
+    [[nodiscard]] static auto operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept -> void* { return operator new(size); }
+    static void operator delete(void* ptr) noexcept
+    {
+        if (ptr != nullptr) {
+            GetMemoryPool().Free(ptr);
+        }
+    }
+    static void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept { operator delete(ptr); }
+};
+
+// Class allocations accounted in specified category
+template<typename T, MemoryCategory Category>
+class TaggedAllocation
+{
+public:
+    [[nodiscard]] static auto operator new(size_t size) noexcept -> void*
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+
+        return TaggedAllocator<uint8, Category>().allocate(size);
+    }
+
+    [[nodiscard]] static auto operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept -> void* { return operator new(size); }
+    static void operator delete(void* ptr, size_t size) noexcept
+    {
+        if (ptr != nullptr) {
+            TaggedAllocator<uint8, Category>().deallocate(static_cast<uint8*>(ptr), size);
+        }
+    }
+};
+
 // Memory low level management
 extern auto MemMalloc(size_t size) noexcept -> void*;
 extern auto MemCalloc(size_t num, size_t size) noexcept -> void*;
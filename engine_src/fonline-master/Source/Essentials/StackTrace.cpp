@@ -36,14 +36,14 @@
 
 FO_BEGIN_NAMESPACE();
 
-static thread_local StackTraceData StackTrace;
+thread_local constinit StackTraceData ThreadStackTrace;
 
 extern void PushStackTrace(const SourceLocationData& loc) noexcept
 {
     FO_NO_STACK_TRACE_ENTRY();
 
 #if !FO_NO_MANUAL_STACK_TRACE
-    auto& st = StackTrace;
+    auto& st = ThreadStackTrace;
 
     if (st.CallsCount < STACK_TRACE_MAX_SIZE) {
         st.CallTree[st.CallsCount] = &loc;
@@ -58,7 +58,7 @@ extern void PopStackTrace() noexcept
     FO_NO_STACK_TRACE_ENTRY();
 
 #if !FO_NO_MANUAL_STACK_TRACE
-    auto& st = StackTrace;
+    auto& st = ThreadStackTrace;
 
     if (st.CallsCount > 0) {
         st.CallsCount--;
@@ -70,7 +70,7 @@ auto GetStackTrace() noexcept -> const StackTraceData&
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    return StackTrace;
+    return ThreadStackTrace;
 }
 
 extern auto GetStackTraceEntry(size_t deep) noexcept -> const SourceLocationData*
@@ -78,7 +78,7 @@ extern auto GetStackTraceEntry(size_t deep) noexcept -> const SourceLocationData
     FO_NO_STACK_TRACE_ENTRY();
 
 #if !FO_NO_MANUAL_STACK_TRACE
-    const auto& st = StackTrace;
+    const auto& st = ThreadStackTrace;
 
     if (deep < st.CallsCount && st.CallsCount - 1 - deep < STACK_TRACE_MAX_SIZE) {
         return st.CallTree[st.CallsCount - 1 - deep];
@@ -101,8 +101,8 @@ extern void SafeWriteStackTrace(const StackTraceData& st) noexcept
 
     char itoa_buf[64] = {};
 
-    for (size_t i = std::min(st.CallsCount, STACK_TRACE_MAX_SIZE); i > 0; i--) {
-        const auto& entry = st.CallTree[i - 1];
+    for (size_t i = 0; i < st.GetStoredCount(); i++) {
+        const auto* entry = st.GetStoredEntry(i);
         string_view file_name = entry->file;
 
         if (const auto pos = file_name.find_last_of("/\\"); pos != string_view::npos) {
@@ -55,6 +55,11 @@ using SourceLocationData = tracy::SourceLocationData;
 #define FO_STACK_TRACE_ENTRY() ZoneScoped
 #define FO_STACK_TRACE_ENTRY_NAMED(name) ZoneScopedN(name)
 #endif
+#if !FO_NO_MANUAL_STACK_TRACE && FO_COMPACT_STACK_TRACE
+#define FO_HOT_STACK_TRACE_ENTRY() ZoneScoped
+#else
+#define FO_HOT_STACK_TRACE_ENTRY() FO_STACK_TRACE_ENTRY()
+#endif
 #define FO_NO_STACK_TRACE_ENTRY()
 
 #else
@@ -77,25 +82,60 @@ struct SourceLocationData // Same as tracy::SourceLocationData
 #define FO_STACK_TRACE_ENTRY()
 #define FO_STACK_TRACE_ENTRY_NAMED(name)
 #endif
+#if !FO_NO_MANUAL_STACK_TRACE && FO_COMPACT_STACK_TRACE
+#define FO_HOT_STACK_TRACE_ENTRY()
+#else
+#define FO_HOT_STACK_TRACE_ENTRY() FO_STACK_TRACE_ENTRY()
+#endif
 #define FO_NO_STACK_TRACE_ENTRY()
 #endif
 
+// Calls deeper than max size are only counted, stored entries stay valid after returning from them
+// Locations are plain pointers to static data, names resolved only when trace is formatted
+
 struct StackTraceData
 {
     size_t CallsCount = {};
     array<const SourceLocationData*, STACK_TRACE_MAX_SIZE> CallTree = {};
+
+    [[nodiscard]] auto GetStoredCount() const noexcept -> size_t { return std::min(CallsCount, STACK_TRACE_MAX_SIZE); }
+    [[nodiscard]] auto GetStoredEntry(size_t index) const noexcept -> const SourceLocationData* { return CallTree[GetStoredCount() - 1 - index]; }
 };
 
+extern thread_local constinit StackTraceData ThreadStackTrace;
+
 extern void PushStackTrace(const SourceLocationData& loc) noexcept;
 extern void PopStackTrace() noexcept;
 extern auto GetStackTrace() noexcept -> const StackTraceData&;
 extern auto GetStackTraceEntry(size_t deep) noexcept -> const SourceLocationData*;
 extern void SafeWriteStackTrace(const StackTraceData& st) noexcept;
 
+// Inlined variant for compact mode, pop is unchecked so entries must be balanced
+FO_FORCE_INLINE void PushStackTraceCompact(const SourceLocationData& loc) noexcept
+{
+    auto& st = ThreadStackTrace;
+
+    if (st.CallsCount < STACK_TRACE_MAX_SIZE) {
+        st.CallTree[st.CallsCount] = &loc;
+    }
+
+    st.CallsCount++;
+}
+
+FO_FORCE_INLINE void PopStackTraceCompact() noexcept
+{
+    ThreadStackTrace.CallsCount--;
+}
+
 struct StackTraceScopeEntry
 {
+#if FO_COMPACT_STACK_TRACE
+    FO_FORCE_INLINE explicit StackTraceScopeEntry(const SourceLocationData& loc) noexcept { PushStackTraceCompact(loc); }
+    FO_FORCE_INLINE ~StackTraceScopeEntry() noexcept { PopStackTraceCompact(); }
+#else
     FO_FORCE_INLINE explicit StackTraceScopeEntry(const SourceLocationData& loc) noexcept { PushStackTrace(loc); }
     FO_FORCE_INLINE ~StackTraceScopeEntry() noexcept { PopStackTrace(); }
+#endif
 
     StackTraceScopeEntry(const StackTraceScopeEntry&) = delete;
     StackTraceScopeEntry(StackTraceScopeEntry&&) noexcept = delete;
@@ -1485,6 +1485,69 @@ static auto CScriptArray_Equals(ScriptArray& arr, const ScriptArray* other) -> b
     return arr == *other;
 }
 
+ScriptArrayPool::~ScriptArrayPool()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    Clear();
+}
+
+auto ScriptArrayPool::GetFreeCount(AngelScript::asITypeInfo* ti) const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto it = _freeArrays.find(ti);
+    return it != _freeArrays.end() ? it->second.size() : 0;
+}
+
+auto ScriptArrayPool::Request(AngelScript::asITypeInfo* ti) -> ScriptArray*
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (const auto it = _freeArrays.find(ti); it != _freeArrays.end() && !it->second.empty()) {
+        auto* arr = it->second.back();
+        it->second.pop_back();
+        return arr;
+    }
+
+    return ScriptArray::Create(ti);
+}
+
+void ScriptArrayPool::Return(ScriptArray* arr, bool recycle)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(arr);
+
+    // Reuse only arrays that nobody else holds and garbage collector doesn't know about
+    auto* ti = arr->GetArrayObjectType();
+
+    if (recycle && arr->GetRefCount() == 1 && (ti->GetFlags() & AngelScript::asOBJ_GC) == 0) {
+        auto& free_arrays = _freeArrays[ti];
+
+        if (free_arrays.size() < MAX_FREE_ARRAYS_PER_TYPE) {
+            arr->Resize(0);
+            free_arrays.emplace_back(arr);
+            return;
+        }
+    }
+
+    arr->Release();
+}
+
+void ScriptArrayPool::Clear() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    for (auto& free_arrays : _freeArrays | std::views::values) {
+        for (auto* arr : free_arrays) {
+            arr->Release();
+        }
+    }
+
+    _freeArrays.clear();
+}
+
 void RegisterAngelScriptArray(AngelScript::asIScriptEngine* engine)
 {
     FO_STACK_TRACE_ENTRY();
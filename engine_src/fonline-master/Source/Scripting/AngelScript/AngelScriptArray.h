@@ -131,6 +131,29 @@ private:
     mutable bool _gcFlag {};
 };
 
+// Keeps emptied temporary arrays (like engine to script call arguments) for reuse
+class ScriptArrayPool final
+{
+public:
+    static constexpr size_t MAX_FREE_ARRAYS_PER_TYPE = 4;
+
+    ScriptArrayPool() = default;
+    ScriptArrayPool(const ScriptArrayPool&) = delete;
+    ScriptArrayPool(ScriptArrayPool&&) noexcept = delete;
+    auto operator=(const ScriptArrayPool&) = delete;
+    auto operator=(ScriptArrayPool&&) noexcept = delete;
+    ~ScriptArrayPool();
+
+    [[nodiscard]] auto GetFreeCount(AngelScript::asITypeInfo* ti) const noexcept -> size_t;
+
+    auto Request(AngelScript::asITypeInfo* ti) -> ScriptArray*;
+    void Return(ScriptArray* arr, bool recycle);
+    void Clear() noexcept;
+
+private:
+    unordered_map<AngelScript::asITypeInfo*, vector<ScriptArray*>> _freeArrays {};
+};
+
 void RegisterAngelScriptArray(AngelScript::asIScriptEngine* engine);
 
 FO_END_NAMESPACE();
@@ -0,0 +1,154 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "AngelScriptCallSites.h"
+
+#include <as_context.h>
+#include <as_scriptengine.h>
+#include <as_scriptfunction.h>
+
+FO_BEGIN_NAMESPACE();
+
+static constexpr AngelScript::asPWORD AS_FUNC_CALL_SITES = 1020;
+
+struct ScriptCallSitesData
+{
+    std::atomic<size_t> FunctionsCount {};
+};
+FO_GLOBAL_DATA(ScriptCallSitesData, ScriptCallSites);
+
+static void CleanupFunctionCallSites(AngelScript::asIScriptFunction* func)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto* func_impl = static_cast<AngelScript::asCScriptFunction*>(func);
+
+    if (func_impl->Ext != nullptr) {
+        delete func_impl->Ext;
+        func_impl->Ext = nullptr;
+        ScriptCallSites->FunctionsCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void PrepareScriptCallSites(AngelScript::asIScriptEngine* as_engine)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    using namespace AngelScript;
+
+    auto* engine_impl = static_cast<asCScriptEngine*>(as_engine);
+
+    // Call sites live as long as their function
+    as_engine->SetFunctionUserDataCleanupCallback(CleanupFunctionCallSites, AS_FUNC_CALL_SITES);
+
+    for (asUINT i = 0; i < engine_impl->scriptFunctions.GetLength(); i++) {
+        auto* func = engine_impl->scriptFunctions[i];
+
+        if (func == nullptr || func->Ext != nullptr) {
+            continue;
+        }
+
+        auto& func_data = *SafeAlloc::MakeRaw<ASFunctionExtendedData>();
+        func->Ext = &func_data;
+        func->SetUserData(&func_data, AS_FUNC_CALL_SITES);
+        ScriptCallSites->FunctionsCount.fetch_add(1, std::memory_order_relaxed);
+
+        if (func->scriptData == nullptr) {
+            continue;
+        }
+
+        // Context program pointer points to next instruction when script call begins
+        const auto& byte_code = func->scriptData->byteCode;
+
+        for (asUINT pos = 0; pos < byte_code.GetLength();) {
+            const auto op = static_cast<asEBCInstr>(*reinterpret_cast<const asBYTE*>(&byte_code[pos]));
+            pos += numeric_cast<asUINT>(asBCTypeSize[asBCInfo[op].type]);
+
+            if (op == asBC_CALL || op == asBC_CALLINTF || op == asBC_CALLBND || op == asBC_CallPtr || op == asBC_ALLOC) {
+                func_data.CallSiteOffsets.emplace_back(numeric_cast<uint32>(pos));
+            }
+        }
+
+        func_data.CallSites = SafeAlloc::MakeUniqueArr<ScriptCallSiteSlot>(func_data.CallSiteOffsets.size());
+    }
+}
+
+auto GetScriptCallSitesCount() noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return ScriptCallSites->FunctionsCount.load(std::memory_order_relaxed);
+}
+
+auto FindScriptCallSite(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, size_t program_pos) noexcept -> ScriptCallSiteSlot*
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    using namespace AngelScript;
+
+    // Context execution entry passes called function itself as position
+    if (program_pos == reinterpret_cast<size_t>(func)) {
+        auto* func_data = static_cast<asCScriptFunction*>(func)->Ext;
+        return func_data != nullptr ? &func_data->EntryCall : nullptr;
+    }
+
+    const auto* caller = static_cast<asCContext*>(ctx)->m_currentFunction;
+
+    if (caller == nullptr || caller->Ext == nullptr || caller->scriptData == nullptr) {
+        return nullptr;
+    }
+
+    const auto* byte_code = caller->scriptData->byteCode.AddressOf();
+    const auto offset = static_cast<uint32>(reinterpret_cast<const asDWORD*>(program_pos) - byte_code);
+    const auto& offsets = caller->Ext->CallSiteOffsets;
+    const auto it = std::ranges::lower_bound(offsets, offset);
+
+    if (it == offsets.end() || *it != offset) {
+        return nullptr;
+    }
+
+    return &caller->Ext->CallSites[static_cast<size_t>(it - offsets.begin())];
+}
+
+FO_END_NAMESPACE();
+
+ASFunctionExtendedData::~ASFunctionExtendedData()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    delete EntryCall.load();
+
+    for (size_t i = 0; i < CallSiteOffsets.size(); i++) {
+        delete CallSites[i].load();
+    }
+}
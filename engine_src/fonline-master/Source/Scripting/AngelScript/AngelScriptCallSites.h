@@ -0,0 +1,104 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include <angelscript.h>
+
+FO_BEGIN_NAMESPACE();
+
+struct StackTraceEntryStorage
+{
+    static constexpr size_t STACK_TRACE_FUNC_BUF_SIZE = 64;
+    static constexpr size_t STACK_TRACE_FILE_BUF_SIZE = 128;
+
+    array<char, STACK_TRACE_FUNC_BUF_SIZE> FuncBuf {};
+    size_t FuncBufLen {};
+    array<char, STACK_TRACE_FILE_BUF_SIZE> FileBuf {};
+    size_t FileBufLen {};
+
+    SourceLocationData SrcLoc {};
+};
+
+using ScriptCallSiteSlot = std::atomic<StackTraceEntryStorage*>;
+
+// Builds call site tables of all loaded script functions, call after module load
+void PrepareScriptCallSites(AngelScript::asIScriptEngine* as_engine);
+
+// Functions with call site tables, tables are freed together with their function
+[[nodiscard]] auto GetScriptCallSitesCount() noexcept -> size_t;
+
+// Slot of function entry or call site inside caller function, null for functions compiled after preparing
+[[nodiscard]] auto FindScriptCallSite(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, size_t program_pos) noexcept -> ScriptCallSiteSlot*;
+
+// Storage is filled once per slot, concurrent first calls may fill twice but only one result is kept
+template<typename T>
+[[nodiscard]] auto ResolveScriptCallSite(ScriptCallSiteSlot& slot, const T& fill) -> StackTraceEntryStorage*
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    auto* storage = slot.load(std::memory_order_acquire);
+
+    if (storage == nullptr) {
+        auto* new_storage = SafeAlloc::MakeRaw<StackTraceEntryStorage>();
+        fill(*new_storage);
+
+        if (slot.compare_exchange_strong(storage, new_storage, std::memory_order_acq_rel)) {
+            storage = new_storage;
+        }
+        else {
+            delete new_storage;
+        }
+    }
+
+    return storage;
+}
+
+FO_END_NAMESPACE();
+
+// Call sites of script function, attached to function by AngelScript patch
+struct ASFunctionExtendedData
+{
+    ASFunctionExtendedData() = default;
+    ASFunctionExtendedData(const ASFunctionExtendedData&) = delete;
+    ASFunctionExtendedData(ASFunctionExtendedData&&) noexcept = delete;
+    auto operator=(const ASFunctionExtendedData&) = delete;
+    auto operator=(ASFunctionExtendedData&&) noexcept = delete;
+    ~ASFunctionExtendedData();
+
+    FO_NAMESPACE ScriptCallSiteSlot EntryCall {};
+    FO_NAMESPACE vector<FO_NAMESPACE uint32> CallSiteOffsets {}; // Sorted offsets of instructions after calls
+    FO_NAMESPACE unique_arr_ptr<FO_NAMESPACE ScriptCallSiteSlot> CallSites {};
+};
@@ -170,6 +170,8 @@ ScriptDict::ScriptDict(AngelScript::asITypeInfo* ti) :
     _valueTypeId {_typeInfo->GetSubTypeId(1)},
     _keyTypeData {PrecacheSubTypeData(_keyTypeId, _typeInfo->GetSubType(0))},
     _valueTypeData {PrecacheSubTypeData(_valueTypeId, _typeInfo->GetSubType(1))},
+    _keyHashKind {ResolveKeyHashKind()},
+    _keySize {ResolveKeySize()},
     _data {ScriptDictComparator(this)}
 {
     FO_NO_STACK_TRACE_ENTRY();
@@ -185,6 +187,8 @@ ScriptDict::ScriptDict(AngelScript::asITypeInfo* ti, void* init_list) :
     _valueTypeId {_typeInfo->GetSubTypeId(1)},
     _keyTypeData {PrecacheSubTypeData(_keyTypeId, _typeInfo->GetSubType(0))},
     _valueTypeData {PrecacheSubTypeData(_valueTypeId, _typeInfo->GetSubType(1))},
+    _keyHashKind {ResolveKeyHashKind()},
+    _keySize {ResolveKeySize()},
     _data {ScriptDictComparator(this)}
 {
     FO_NO_STACK_TRACE_ENTRY();
@@ -257,6 +261,8 @@ ScriptDict::ScriptDict(const ScriptDict& other) :
     _valueTypeId {_typeInfo->GetSubTypeId(1)},
     _keyTypeData {PrecacheSubTypeData(_keyTypeId, _typeInfo->GetSubType(0))},
     _valueTypeData {PrecacheSubTypeData(_valueTypeId, _typeInfo->GetSubType(1))},
+    _keyHashKind {ResolveKeyHashKind()},
+    _keySize {ResolveKeySize()},
     _data {ScriptDictComparator(this)}
 {
     FO_NO_STACK_TRACE_ENTRY();
@@ -265,8 +271,8 @@ ScriptDict::ScriptDict(const ScriptDict& other) :
         _typeInfo->GetEngine()->NotifyGarbageCollectorOfNewObject(this, _typeInfo.get());
     }
 
-    for (const auto& kv : other._data) {
-        Set(kv.first, kv.second);
+    for (const auto& [key, value] : other.GetEntries()) {
+        Set(key, value);
     }
 }
 
@@ -281,8 +287,8 @@ auto ScriptDict::operator=(const ScriptDict& other) -> ScriptDict&
     if (&other != this) {
         Clear();
 
-        for (const auto& kv : other._data) {
-            Set(kv.first, kv.second);
+        for (const auto& [key, value] : other.GetEntries()) {
+            Set(key, value);
         }
     }
 
@@ -404,35 +410,340 @@ auto ScriptDict::PrecacheSubTypeData(int32 type_id, AngelScript::asITypeInfo* ti
     return sub_type_data;
 }
 
+auto ScriptDict::ResolveKeyHashKind() const -> KeyHashKind
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (_keyTypeId == AngelScript::asTYPEID_VOID) {
+        return KeyHashKind::None;
+    }
+
+    if ((_keyTypeId & AngelScript::asTYPEID_MASK_OBJECT) == 0) {
+        return KeyHashKind::Primitive;
+    }
+
+    if ((_keyTypeId & AngelScript::asTYPEID_OBJHANDLE) != 0) {
+        return KeyHashKind::None;
+    }
+
+    const auto* key_type = _typeInfo->GetSubType(0);
+    const string_view key_type_name = key_type != nullptr ? key_type->GetName() : "";
+
+    if (key_type_name == "string") {
+        return KeyHashKind::String;
+    }
+    if (key_type_name == "hstring") {
+        return KeyHashKind::HashedString;
+    }
+    if (key_type_name == "ident" && key_type->GetSize() == sizeof(int64)) {
+        return KeyHashKind::Ident;
+    }
+
+    return KeyHashKind::None;
+}
+
+auto ScriptDict::ResolveKeySize() const -> int32
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (_keyHashKind == KeyHashKind::Primitive) {
+        return _typeInfo->GetEngine()->GetSizeOfPrimitiveType(_keyTypeId);
+    }
+    if (_keyHashKind == KeyHashKind::Ident) {
+        return sizeof(int64);
+    }
+
+    return 0;
+}
+
+static auto MixKeyHash(uint64 value) noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return static_cast<size_t>(value);
+}
+
+auto ScriptDict::HashKey(const void* key) const -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (_keyHashKind) {
+    case KeyHashKind::Primitive:
+    case KeyHashKind::Ident: {
+        uint64 value = 0;
+
+        // Positive and negative zero are equal keys
+        if (_keyTypeId == AngelScript::asTYPEID_FLOAT) {
+            if (*static_cast<const float32*>(key) != 0.0f) {
+                MemCopy(&value, key, sizeof(float32));
+            }
+        }
+        else if (_keyTypeId == AngelScript::asTYPEID_DOUBLE) {
+            if (*static_cast<const float64*>(key) != 0.0) {
+                MemCopy(&value, key, sizeof(float64));
+            }
+        }
+        else {
+            MemCopy(&value, key, numeric_cast<size_t>(_keySize));
+        }
+
+        return MixKeyHash(value);
+    }
+    case KeyHashKind::String: {
+        const auto& str = *static_cast<const string*>(key);
+        return static_cast<size_t>(Hashing::MurmurHash2_64(str.data(), str.length()));
+    }
+    case KeyHashKind::HashedString:
+        return MixKeyHash(static_cast<const hstring*>(key)->as_hash());
+    case KeyHashKind::None:
+        break;
+    }
+
+    FO_UNREACHABLE_PLACE();
+}
+
+auto ScriptDict::KeysEqual(const void* a, const void* b) const -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (_keyHashKind) {
+    case KeyHashKind::Primitive:
+    case KeyHashKind::Ident:
+        // Same equivalence as tree comparator, exact and without epsilon
+        if (_keyTypeId == AngelScript::asTYPEID_FLOAT) {
+            const auto fa = *static_cast<const float32*>(a);
+            const auto fb = *static_cast<const float32*>(b);
+            return !(fa < fb) && !(fb < fa);
+        }
+        if (_keyTypeId == AngelScript::asTYPEID_DOUBLE) {
+            const auto da = *static_cast<const float64*>(a);
+            const auto db = *static_cast<const float64*>(b);
+            return !(da < db) && !(db < da);
+        }
+        return MemCompare(a, b, numeric_cast<size_t>(_keySize));
+    case KeyHashKind::String:
+        return *static_cast<const string*>(a) == *static_cast<const string*>(b);
+    case KeyHashKind::HashedString:
+        return *static_cast<const hstring*>(a) == *static_cast<const hstring*>(b);
+    case KeyHashKind::None:
+        break;
+    }
+
+    FO_UNREACHABLE_PLACE();
+}
+
+auto ScriptDict::KeyLess(const void* a, const void* b) const -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Same order as opCmp of key types, to keep iteration order of tree
+    switch (_keyHashKind) {
+    case KeyHashKind::Primitive:
+        return Less(_keyTypeId, _keyTypeData.get(), _typeInfo->GetEngine(), a, b);
+    case KeyHashKind::Ident:
+        return *static_cast<const int64*>(a) < *static_cast<const int64*>(b);
+    case KeyHashKind::String:
+        return *static_cast<const string*>(a) < *static_cast<const string*>(b);
+    case KeyHashKind::HashedString:
+        return *static_cast<const hstring*>(a) < *static_cast<const hstring*>(b);
+    case KeyHashKind::None:
+        break;
+    }
+
+    return Less(_keyTypeId, _keyTypeData.get(), _typeInfo->GetEngine(), a, b);
+}
+
+auto ScriptDict::FindHashSlot(const void* key, size_t hash) const -> optional<size_t>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (_hashSlots.empty()) {
+        return std::nullopt;
+    }
+
+    const auto mask = _hashSlots.size() - 1;
+
+    for (auto index = hash & mask;; index = (index + 1) & mask) {
+        const auto& slot = _hashSlots[index];
+
+        if (slot.Key == nullptr) {
+            return std::nullopt;
+        }
+        if (slot.Hash == hash && KeysEqual(slot.Key, key)) {
+            return index;
+        }
+    }
+}
+
+auto ScriptDict::FindValueRef(const void* key) -> void**
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (IsHashed()) {
+        const auto index = FindHashSlot(key, HashKey(key));
+        return index.has_value() ? &_hashSlots[*index].Value : nullptr;
+    }
+
+    const auto it = _data.find(const_cast<void*>(key));
+    return it != _data.end() ? &it->second : nullptr;
+}
+
+void ScriptDict::InsertEntry(void* key, void* value)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    _entriesValid = false;
+
+    if (!IsHashed()) {
+        _data.emplace(key, value);
+        return;
+    }
+
+    // Keep load factor under 3/4
+    if ((_hashedCount + 1) * 4 > _hashSlots.size() * 3) {
+        RehashSlots(std::max(MIN_HASH_SLOTS, _hashSlots.size() * 2));
+    }
+
+    const auto hash = HashKey(key);
+    const auto mask = _hashSlots.size() - 1;
+    auto index = hash & mask;
+
+    while (_hashSlots[index].Key != nullptr) {
+        index = (index + 1) & mask;
+    }
+
+    _hashSlots[index] = HashSlot {.Key = key, .Value = value, .Hash = hash};
+    _hashedCount++;
+}
+
+void ScriptDict::EraseHashSlot(size_t index)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    _entriesValid = false;
+
+    // Backward shift deletion, no tombstones
+    const auto mask = _hashSlots.size() - 1;
+
+    for (auto next = (index + 1) & mask; _hashSlots[next].Key != nullptr; next = (next + 1) & mask) {
+        const auto ideal = _hashSlots[next].Hash & mask;
+        const auto can_move = index <= next ? ideal <= index || ideal > next : ideal <= index && ideal > next;
+
+        if (can_move) {
+            _hashSlots[index] = _hashSlots[next];
+            index = next;
+        }
+    }
+
+    _hashSlots[index] = HashSlot {};
+    _hashedCount--;
+}
+
+void ScriptDict::RehashSlots(size_t slots_count)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(std::has_single_bit(slots_count));
+
+    auto prev_slots = std::move(_hashSlots);
+    _hashSlots.clear();
+    _hashSlots.resize(slots_count);
+
+    const auto mask = slots_count - 1;
+
+    for (const auto& slot : prev_slots) {
+        if (slot.Key != nullptr) {
+            auto index = slot.Hash & mask;
+
+            while (_hashSlots[index].Key != nullptr) {
+                index = (index + 1) & mask;
+            }
+
+            _hashSlots[index] = slot;
+        }
+    }
+}
+
+void ScriptDict::UpdateCachedEntry(const void* key, void* value)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (!_entriesValid) {
+        return;
+    }
+
+    // Key set is unchanged, so sorted entries stay valid and only value pointer moves
+    const auto it = std::ranges::lower_bound(_entries, key, [this](const void* a, const void* b) { return KeyLess(a, b); }, [](const pair<void*, void*>& entry) -> const void* { return entry.first; });
+    FO_RUNTIME_ASSERT(it != _entries.end());
+    it->second = value;
+}
+
+auto ScriptDict::GetEntries() const -> const vector<pair<void*, void*>>&
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (!_entriesValid) {
+        _entries.clear();
+
+        if (IsHashed()) {
+            _entries.reserve(_hashedCount);
+
+            for (const auto& slot : _hashSlots) {
+                if (slot.Key != nullptr) {
+                    _entries.emplace_back(slot.Key, slot.Value);
+                }
+            }
+
+            std::ranges::sort(_entries, [this](const pair<void*, void*>& a, const pair<void*, void*>& b) { return KeyLess(a.first, b.first); });
+        }
+        else {
+            _entries.reserve(_data.size());
+
+            for (const auto& [key, value] : _data) {
+                _entries.emplace_back(key, value);
+            }
+        }
+
+        _entriesValid = true;
+    }
+
+    return _entries;
+}
+
 auto ScriptDict::IsEmpty() const -> bool
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    return _data.empty();
+    return GetSize() == 0;
 }
 
 auto ScriptDict::GetSize() const -> int32
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    return numeric_cast<int32>(_data.size());
+    return numeric_cast<int32>(IsHashed() ? _hashedCount : _data.size());
 }
 
 void ScriptDict::Set(void* key, void* value)
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    const auto it = _data.find(key);
+    auto* value_ref = FindValueRef(key);
 
-    if (it == _data.end()) {
+    if (value_ref == nullptr) {
         key = CopyObject(_typeInfo.get(), 0, key);
         value = CopyObject(_typeInfo.get(), 1, value);
-        _data.emplace(key, value);
+        InsertEntry(key, value);
     }
     else {
-        DestroyObject(_typeInfo.get(), 1, it->second);
-        value = CopyObject(_typeInfo.get(), 1, value);
-        it->second = value;
+        DestroyObject(_typeInfo.get(), 1, *value_ref);
+        *value_ref = CopyObject(_typeInfo.get(), 1, value);
+        UpdateCachedEntry(key, *value_ref);
     }
 }
 
@@ -440,12 +751,10 @@ void ScriptDict::SetIfNotExist(void* key, void* value)
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    const auto it = _data.find(key);
-
-    if (it == _data.end()) {
+    if (FindValueRef(key) == nullptr) {
         key = CopyObject(_typeInfo.get(), 0, key);
         value = CopyObject(_typeInfo.get(), 1, value);
-        _data.emplace(key, value);
+        InsertEntry(key, value);
     }
 }
 
@@ -453,12 +762,28 @@ auto ScriptDict::Remove(void* key) -> bool
 {
     FO_NO_STACK_TRACE_ENTRY();
 
+    if (IsHashed()) {
+        const auto index = FindHashSlot(key, HashKey(key));
+
+        if (index.has_value()) {
+            auto* stored_key = _hashSlots[*index].Key;
+            auto* stored_value = _hashSlots[*index].Value;
+            EraseHashSlot(*index);
+            DestroyObject(_typeInfo.get(), 0, stored_key);
+            DestroyObject(_typeInfo.get(), 1, stored_value);
+            return true;
+        }
+
+        return false;
+    }
+
     const auto it = _data.find(key);
 
     if (it != _data.end()) {
         DestroyObject(_typeInfo.get(), 0, it->first);
         DestroyObject(_typeInfo.get(), 1, it->second);
         _data.erase(it);
+        _entriesValid = false;
         return true;
     }
 
@@ -471,11 +796,34 @@ auto ScriptDict::RemoveValues(void* value) -> int32
 
     int32 result = 0;
 
+    if (IsHashed()) {
+        vector<void*> keys_to_remove;
+
+        for (const auto& slot : _hashSlots) {
+            if (slot.Key != nullptr && Equals(_valueTypeId, _valueTypeData.get(), _typeInfo->GetEngine(), slot.Value, value)) {
+                keys_to_remove.emplace_back(slot.Key);
+            }
+        }
+
+        for (auto* key : keys_to_remove) {
+            const auto index = FindHashSlot(key, HashKey(key));
+            FO_RUNTIME_ASSERT(index.has_value());
+            auto* stored_value = _hashSlots[*index].Value;
+            EraseHashSlot(*index);
+            DestroyObject(_typeInfo.get(), 0, key);
+            DestroyObject(_typeInfo.get(), 1, stored_value);
+            result++;
+        }
+
+        return result;
+    }
+
     for (auto it = _data.begin(); it != _data.end();) {
         if (Equals(_valueTypeId, _valueTypeData.get(), _typeInfo->GetEngine(), it->second, value)) {
             DestroyObject(_typeInfo.get(), 0, it->first);
             DestroyObject(_typeInfo.get(), 1, it->second);
             it = _data.erase(it);
+            _entriesValid = false;
             result++;
         }
         else {
@@ -490,95 +838,94 @@ void ScriptDict::Clear()
 {
     FO_NO_STACK_TRACE_ENTRY();
 
+    for (const auto& slot : _hashSlots) {
+        if (slot.Key != nullptr) {
+            DestroyObject(_typeInfo.get(), 0, slot.Key);
+            DestroyObject(_typeInfo.get(), 1, slot.Value);
+        }
+    }
+
     for (const auto& kv : _data) {
         DestroyObject(_typeInfo.get(), 0, kv.first);
         DestroyObject(_typeInfo.get(), 1, kv.second);
     }
 
+    _hashSlots.clear();
+    _hashedCount = 0;
     _data.clear();
+    _entries.clear();
+    _entriesValid = false;
 }
 
 auto ScriptDict::Get(void* key) -> void*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    const auto it = _data.find(key);
+    auto* value_ref = FindValueRef(key);
 
-    if (it == _data.end()) {
+    if (value_ref == nullptr) {
         throw ScriptException("Key not found");
     }
 
-    return it->second;
+    return *value_ref;
 }
 
 void* ScriptDict::GetOrCreate(void* key)
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    const auto it = _data.find(key);
+    auto* value_ref = FindValueRef(key);
 
-    if (it == _data.end()) {
+    if (value_ref == nullptr) {
         key = CopyObject(_typeInfo.get(), 0, key);
         void* value = CreateObject(_typeInfo.get(), 1);
-        _data.emplace(key, value);
+        InsertEntry(key, value);
         return value;
     }
 
-    return it->second;
+    return *value_ref;
 }
 
 auto ScriptDict::GetDefault(void* key, void* def_val) -> void*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    const auto it = _data.find(key);
+    auto* value_ref = FindValueRef(key);
 
-    if (it == _data.end()) {
+    if (value_ref == nullptr) {
         return def_val;
     }
 
-    return it->second;
+    return *value_ref;
 }
 
 auto ScriptDict::GetKey(int32 index) -> void*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (index < 0 || index >= numeric_cast<int32>(_data.size())) {
+    if (index < 0 || index >= GetSize()) {
         throw ScriptException("Index out of bounds");
     }
 
-    auto it = _data.begin();
-
-    for (int32 i = 0; i < index; i++) {
-        ++it;
-    }
-
-    return it->first;
+    return GetEntries()[index].first;
 }
 
 auto ScriptDict::GetValue(int32 index) -> void*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (index < 0 || index >= numeric_cast<int32>(_data.size())) {
+    if (index < 0 || index >= GetSize()) {
         throw ScriptException("Index out of bounds");
     }
 
-    auto it = _data.begin();
-
-    for (int32 i = 0; i < index; i++) {
-        ++it;
-    }
-
-    return it->second;
+    return GetEntries()[index].second;
 }
 
 auto ScriptDict::Exists(void* key) const -> bool
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    return _data.count(key) != 0;
+    return const_cast<ScriptDict*>(this)->FindValueRef(key) != nullptr;
 }
 
 auto ScriptDict::operator==(const ScriptDict& other) const -> bool
@@ -595,19 +942,16 @@ auto ScriptDict::operator==(const ScriptDict& other) const -> bool
         return false;
     }
 
-    auto it1 = _data.begin();
-    auto it2 = other._data.begin();
+    const auto& entries1 = GetEntries();
+    const auto& entries2 = other.GetEntries();
 
-    for (size_t i = 0; i > _data.size(); i++) {
-        if (!Equals(_keyTypeId, _keyTypeData.get(), _typeInfo->GetEngine(), it1->first, it2->first)) {
+    for (size_t i = 0; i < entries1.size(); i++) {
+        if (!Equals(_keyTypeId, _keyTypeData.get(), _typeInfo->GetEngine(), entries1[i].first, entries2[i].first)) {
             return false;
         }
-        if (!Equals(_valueTypeId, _valueTypeData.get(), _typeInfo->GetEngine(), it1->second, it2->second)) {
+        if (!Equals(_valueTypeId, _valueTypeData.get(), _typeInfo->GetEngine(), entries1[i].second, entries2[i].second)) {
             return false;
         }
-
-        ++it1;
-        ++it2;
     }
 
     return true;
@@ -661,6 +1005,17 @@ void ScriptDict::EnumReferences(AngelScript::asIScriptEngine* engine) const
     const bool values_handle = (_valueTypeId & AngelScript::asTYPEID_MASK_OBJECT) != 0;
 
     if (keys_handle || values_handle) {
+        for (const auto& slot : _hashSlots) {
+            if (slot.Key != nullptr) {
+                if (keys_handle) {
+                    engine->GCEnumCallback(slot.Key);
+                }
+                if (values_handle) {
+                    engine->GCEnumCallback(slot.Value);
+                }
+            }
+        }
+
         for (const auto& kv : _data) {
             if (keys_handle) {
                 engine->GCEnumCallback(kv.first);
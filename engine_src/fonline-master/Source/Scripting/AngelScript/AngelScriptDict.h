@@ -72,7 +72,8 @@ public:
     auto GetDictObjectType() -> AngelScript::asITypeInfo* { return _typeInfo.get(); }
     auto GetDictObjectType() const -> const AngelScript::asITypeInfo* { return _typeInfo.get(); }
     auto GetDictTypeId() const -> int32 { return _typeInfo->GetTypeId(); }
-    auto GetMap() const -> const map<void*, void*, ScriptDictComparator>& { return _data; }
+    auto GetEntries() const -> const vector<pair<void*, void*>>&;
+    auto IsHashed() const -> bool { return _keyHashKind != KeyHashKind::None; }
     auto IsEmpty() const -> bool;
     auto GetSize() const -> int32;
     auto Get(void* key) -> void*;
@@ -95,19 +96,55 @@ public:
     void ReleaseAllHandles(AngelScript::asIScriptEngine* engine);
 
 private:
+    // Hashable keys are stored in open addressing table, other keys in tree ordered by opCmp
+    enum class KeyHashKind : uint8
+    {
+        None,
+        Primitive,
+        String,
+        HashedString,
+        Ident,
+    };
+
+    struct HashSlot
+    {
+        void* Key {};
+        void* Value {};
+        size_t Hash {};
+    };
+
+    static constexpr size_t MIN_HASH_SLOTS = 16;
+
     explicit ScriptDict(AngelScript::asITypeInfo* ti);
     explicit ScriptDict(AngelScript::asITypeInfo* ti, void* init_list);
     explicit ScriptDict(const ScriptDict& other);
     ~ScriptDict();
 
     auto PrecacheSubTypeData(int32 type_id, AngelScript::asITypeInfo* ti) const -> ScriptDictTypeData*;
+    auto ResolveKeyHashKind() const -> KeyHashKind;
+    auto ResolveKeySize() const -> int32;
+    auto HashKey(const void* key) const -> size_t;
+    auto KeysEqual(const void* a, const void* b) const -> bool;
+    auto KeyLess(const void* a, const void* b) const -> bool;
+    auto FindHashSlot(const void* key, size_t hash) const -> optional<size_t>;
+    auto FindValueRef(const void* key) -> void**;
+    void InsertEntry(void* key, void* value);
+    void EraseHashSlot(size_t index);
+    void RehashSlots(size_t slots_count);
+    void UpdateCachedEntry(const void* key, void* value);
 
     refcount_ptr<AngelScript::asITypeInfo> _typeInfo;
     int32 _keyTypeId;
     int32 _valueTypeId;
     raw_ptr<ScriptDictTypeData> _keyTypeData;
     raw_ptr<ScriptDictTypeData> _valueTypeData;
+    KeyHashKind _keyHashKind;
+    int32 _keySize;
     map<void*, void*, ScriptDictComparator> _data;
+    vector<HashSlot> _hashSlots {};
+    size_t _hashedCount {};
+    mutable vector<pair<void*, void*>> _entries {};
+    mutable bool _entriesValid {};
     mutable int32 _refCount {1};
     mutable bool _gcFlag {};
 };
@@ -66,9 +66,11 @@
 #include "FileSystem.h"
 #include "Geometry.h"
 #include "Properties.h"
+#include "ScriptCoroutineScheduler.h"
 #include "ScriptSystem.h"
 
 #include "AngelScriptArray.h"
+#include "AngelScriptCallSites.h"
 #include "AngelScriptDict.h"
 #include "AngelScriptMath.h"
 #include "AngelScriptReflection.h"
@@ -207,6 +209,19 @@ static void ThrowInitException(int32 line, int32 result)
 
 #define PASS_AS_PVOID(ptr) const_cast<void*>(static_cast<const void*>(ptr))
 
+#ifndef AS_MAX_PORTABILITY
+// Typed plain data property access object, script calls its methods natively (asCALL_THISCALL_OBJFIRST)
+struct PodPropertyAccessor
+{
+    template<typename T, typename TValue, typename TScript>
+    auto Get(const T* entity) const -> TScript;
+    template<typename T, typename TValue, typename TScript>
+    void Set(T* entity, TScript value) const;
+
+    raw_ptr<const Property> Prop {};
+};
+#endif
+
 #if !COMPILER_MODE
 #define PTR_OR_DUMMY(ptr) PASS_AS_PVOID(&(ptr))
 #else
@@ -215,16 +230,26 @@ static void ThrowInitException(int32 line, int32 result)
 
 struct AngelscriptAllocator
 {
+    // Size is kept in front of block to account freed memory
+    static constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
     static auto Alloc(size_t size) -> void*
     {
-        constexpr SafeAllocator<uint8> allocator;
-        return allocator.allocate(size);
+        constexpr TaggedAllocator<uint8, MemoryCategory::Scripts> allocator;
+        auto* ptr = allocator.allocate(HEADER_SIZE + size);
+        *reinterpret_cast<size_t*>(ptr) = size;
+        return ptr + HEADER_SIZE;
     }
 
     static void Free(void* ptr)
     {
-        constexpr SafeAllocator<uint8> allocator;
-        allocator.deallocate(static_cast<uint8*>(ptr), 0);
+        if (ptr == nullptr) {
+            return;
+        }
+
+        constexpr TaggedAllocator<uint8, MemoryCategory::Scripts> allocator;
+        auto* block = static_cast<uint8*>(ptr) - HEADER_SIZE;
+        allocator.deallocate(block, HEADER_SIZE + *reinterpret_cast<const size_t*>(block));
     }
 
     AngelscriptAllocator()
@@ -245,8 +270,8 @@ struct ASContextExtendedData
     size_t ExecutionCalls {};
     FO_NAMESPACE string Info {};
     FO_NAMESPACE raw_ptr<asIScriptContext> Parent {};
-    FO_NAMESPACE nanotime SuspendEndTime {};
     FO_NAMESPACE raw_ptr<FO_NAMESPACE Entity> ValidCheck {};
+    bool ProfilerAttached {};
 #if FO_TRACY
     FO_NAMESPACE vector<TracyCZoneCtx> TracyExecutionCalls {};
 #endif
@@ -256,6 +281,7 @@ FO_BEGIN_NAMESPACE();
 static void AngelScriptBeginCall(asIScriptContext* ctx, asIScriptFunction* func, size_t program_pos);
 static void AngelScriptEndCall(asIScriptContext* ctx);
 static void AngelScriptException(asIScriptContext* ctx, void* param);
+static void AngelScriptProfilerSample(asIScriptContext* ctx, void* param);
 
 class SCRIPT_BACKEND_CLASS : public ScriptSystemBackend
 {
@@ -272,6 +298,8 @@ public:
     {
         Engine = nullptr;
 
+        ArgArrays.Clear();
+
         if (ASEngine != nullptr) {
             ASEngine->ShutDownAndRelease();
         }
@@ -343,8 +371,9 @@ public:
         auto& ctx_ext = GET_CONTEXT_EXT(ctx);
         ctx_ext.Parent = nullptr;
         ctx_ext.Info.clear();
-        ctx_ext.SuspendEndTime = {};
         ctx_ext.ValidCheck = nullptr;
+
+        Coroutines.Cancel(ctx);
     }
 
     auto PrepareContext(asIScriptFunction* func) -> asIScriptContext*
@@ -381,7 +410,31 @@ public:
             ctx_ext.TracyExecutionCalls.clear();
 #endif
 
+            // Line callback is the sampling point, attached only while profiler is running
+            auto& profiler = Engine->ScriptSys.GetProfiler();
+            const auto profiling = profiler.IsEnabled();
+
+            if (profiling != ctx_ext.ProfilerAttached) {
+                if (profiling) {
+                    const auto r = ctx->SetLineCallback(asFUNCTION(AngelScriptProfilerSample), &profiler, asCALL_CDECL);
+                    FO_RUNTIME_ASSERT(r >= 0);
+                }
+                else {
+                    ctx->ClearLineCallback();
+                }
+
+                ctx_ext.ProfilerAttached = profiling;
+            }
+
+            if (profiling) {
+                profiler.BeginExecution();
+            }
+
             auto after_execution = ScopeCallback([&]() noexcept {
+                if (profiling) {
+                    profiler.EndExecution();
+                }
+
                 ctx_ext.ExecutionActive = false;
                 while (ctx_ext.ExecutionCalls > 0) {
                     ctx_ext.ExecutionCalls--;
@@ -452,28 +505,27 @@ public:
     {
         FO_STACK_TRACE_ENTRY();
 
-        if (BusyContexts.empty()) {
+        // Only woken contexts are touched, sleeping ones cost nothing per tick
+        const auto time = Engine->GameTime.GetFrameTime();
+
+        if (!Coroutines.HasPendingWakeups(time)) {
             return;
         }
 
-        vector<asIScriptContext*> resume_contexts;
-        vector<asIScriptContext*> finish_contexts;
-        const auto time = Engine->GameTime.GetFrameTime();
+        auto wakeups = std::move(CoroutineWakeups);
+        wakeups.clear();
+        Coroutines.CollectWakeups(time, wakeups);
 
-        for (auto* ctx : BusyContexts) {
+        for (const auto& wakeup : wakeups) {
+            auto* ctx = static_cast<asIScriptContext*>(const_cast<void*>(wakeup.Co));
             const auto& ctx_ext = GET_CONTEXT_EXT(ctx);
 
-            if ((ctx->GetState() == asEXECUTION_PREPARED || ctx->GetState() == asEXECUTION_SUSPENDED) && time >= ctx_ext.SuspendEndTime) {
-                if (ctx_ext.ValidCheck != nullptr && ctx_ext.ValidCheck->IsDestroyed()) {
-                    finish_contexts.emplace_back(ctx);
-                }
-                else {
-                    resume_contexts.emplace_back(ctx);
-                }
+            // Bound entity may be already freed after owner destroy wakeup, so don't touch it
+            if (wakeup.Reason == ScriptCoroutineScheduler::WakeReason::OwnerDestroyed || (ctx_ext.ValidCheck != nullptr && ctx_ext.ValidCheck->IsDestroyed())) {
+                ReturnContext(ctx);
+                continue;
             }
-        }
 
-        for (auto* ctx : resume_contexts) {
             try {
                 if (RunContext(ctx, true)) {
                     ReturnContext(ctx);
@@ -484,9 +536,47 @@ public:
             }
         }
 
-        for (auto* ctx : finish_contexts) {
-            ReturnContext(ctx);
-        }
+        // Keep buffer capacity for next ticks
+        wakeups.clear();
+        CoroutineWakeups = std::move(wakeups);
+    }
+
+    auto NotifyEvent(hstring event, const Entity* target) -> size_t override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        return Coroutines.NotifyEvent(event, target);
+    }
+
+    void HandleEntityDestroyed(const Entity* entity) override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        // Bound contexts first, so they are finished instead of resumed with dead entity
+        Coroutines.CancelOwner(entity);
+        Coroutines.NotifyTarget(entity);
+    }
+
+    void HandleEntityUnloaded(const Entity* entity, ident_t id) override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        Coroutines.CancelOwner(entity);
+        Coroutines.ParkTarget(entity, id.underlying_value());
+    }
+
+    void HandleEntityLoaded(const Entity* entity, ident_t id) override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        Coroutines.UnparkTarget(id.underlying_value(), entity);
+    }
+
+    [[nodiscard]] auto HasBoundWaits(const Entity* entity) const -> bool override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        return Coroutines.GetOwnerWaitsCount(entity) != 0;
     }
 
     raw_ptr<BaseEngine> Engine {};
@@ -497,23 +587,16 @@ public:
     raw_ptr<asIScriptContext> CurrentCtx {};
     vector<asIScriptContext*> FreeContexts {};
     vector<asIScriptContext*> BusyContexts {};
+    ScriptCoroutineScheduler Coroutines {};
+    vector<ScriptCoroutineScheduler::Wakeup> CoroutineWakeups {};
     StackTraceData ExceptionStackTrace {};
     unordered_set<hstring> HashedStrings {};
     unordered_map<asIScriptFunction*, ScriptFuncDesc> FuncMap {};
     list<function<void*()>> Getters {};
-};
-
-struct StackTraceEntryStorage
-{
-    static constexpr size_t STACK_TRACE_FUNC_BUF_SIZE = 64;
-    static constexpr size_t STACK_TRACE_FILE_BUF_SIZE = 128;
-
-    array<char, STACK_TRACE_FUNC_BUF_SIZE> FuncBuf {};
-    size_t FuncBufLen {};
-    array<char, STACK_TRACE_FILE_BUF_SIZE> FileBuf {};
-    size_t FileBufLen {};
-
-    SourceLocationData SrcLoc {};
+#if !COMPILER_MODE && !defined(AS_MAX_PORTABILITY)
+    list<PodPropertyAccessor> PodPropertyAccessors {};
+#endif
+    ScriptArrayPool ArgArrays {};
 };
 
 struct FO_CONCAT(AngelScriptStackTraceData_, SCRIPT_BACKEND_CLASS)
@@ -526,6 +609,31 @@ struct FO_CONCAT(AngelScriptStackTraceData_, SCRIPT_BACKEND_CLASS)
 };
 FO_GLOBAL_DATA(FO_CONCAT(AngelScriptStackTraceData_, SCRIPT_BACKEND_CLASS), AngelScriptStackTrace);
 
+static void FillStackTraceEntry(StackTraceEntryStorage& storage, asIScriptContext* ctx, asIScriptFunction* func)
+{
+    int32 ctx_line = ctx->GetLineNumber();
+
+    auto* lnt = static_cast<Preprocessor::LineNumberTranslator*>(ctx->GetEngine()->GetUserData(5));
+    const auto& orig_file = Preprocessor::ResolveOriginalFile(ctx_line, lnt);
+    const auto orig_line = numeric_cast<uint32>(Preprocessor::ResolveOriginalLine(ctx_line, lnt));
+
+    const auto* func_decl = func->GetDeclaration(true);
+
+    const auto safe_copy = [](auto& to, size_t& len, string_view from) {
+        len = std::min(from.length(), to.size() - 1);
+        MemCopy(to.data(), from.data(), len);
+        to[len] = 0;
+    };
+
+    safe_copy(storage.FuncBuf, storage.FuncBufLen, func_decl);
+    safe_copy(storage.FileBuf, storage.FileBufLen, orig_file);
+
+    storage.SrcLoc.name = nullptr;
+    storage.SrcLoc.function = storage.FuncBuf.data();
+    storage.SrcLoc.file = storage.FileBuf.data();
+    storage.SrcLoc.line = orig_line;
+}
+
 static void AngelScriptBeginCall(asIScriptContext* ctx, asIScriptFunction* func, size_t program_pos)
 {
     auto& ctx_ext = GET_CONTEXT_EXT(ctx);
@@ -534,9 +642,13 @@ static void AngelScriptBeginCall(asIScriptContext* ctx, asIScriptFunction* func,
         return;
     }
 
-    StackTraceEntryStorage* storage = nullptr;
+    StackTraceEntryStorage* storage;
 
-    {
+    // Call sites prepared on module load are resolved without locks
+    if (auto* slot = FindScriptCallSite(ctx, func, program_pos); slot != nullptr) {
+        storage = ResolveScriptCallSite(*slot, [&](StackTraceEntryStorage& new_storage) { FillStackTraceEntry(new_storage, ctx, func); });
+    }
+    else {
 #if SERVER_SCRIPTING
         std::scoped_lock lock {AngelScriptStackTrace->ScriptCallCacheEntriesLocker};
 #endif
@@ -546,56 +658,19 @@ static void AngelScriptBeginCall(asIScriptContext* ctx, asIScriptFunction* func,
         if (it != AngelScriptStackTrace->ScriptCallCacheEntries.end()) {
             storage = &it->second;
         }
-    }
-
-    if (storage == nullptr) {
-        int32 ctx_line = ctx->GetLineNumber();
-
-        auto* lnt = static_cast<Preprocessor::LineNumberTranslator*>(ctx->GetEngine()->GetUserData(5));
-        const auto& orig_file = Preprocessor::ResolveOriginalFile(ctx_line, lnt);
-        const auto orig_line = numeric_cast<uint32>(Preprocessor::ResolveOriginalLine(ctx_line, lnt));
-
-        const auto* func_decl = func->GetDeclaration(true);
-
-        {
-#if SERVER_SCRIPTING
-            std::scoped_lock lock {AngelScriptStackTrace->ScriptCallCacheEntriesLocker};
-#endif
-
+        else {
             storage = &AngelScriptStackTrace->ScriptCallCacheEntries.emplace(program_pos, StackTraceEntryStorage {}).first->second;
-
-            const auto safe_copy = [](auto& to, size_t& len, string_view from) {
-                len = std::min(from.length(), to.size() - 1);
-                MemCopy(to.data(), from.data(), len);
-                to[len] = 0;
-            };
-
-            safe_copy(storage->FuncBuf, storage->FuncBufLen, func_decl);
-            safe_copy(storage->FileBuf, storage->FileBufLen, orig_file);
-
-            storage->SrcLoc.name = nullptr;
-            storage->SrcLoc.function = storage->FuncBuf.data();
-            storage->SrcLoc.file = storage->FileBuf.data();
-            storage->SrcLoc.line = orig_line;
+            FillStackTraceEntry(*storage, ctx, func);
         }
-
-        PushStackTrace(storage->SrcLoc);
-
-#if FO_TRACY
-        const auto tracy_srcloc = ___tracy_alloc_srcloc(storage->SrcLoc.line, storage->FileBuf.data(), storage->FileBufLen, storage->FuncBuf.data(), storage->FuncBufLen, 0);
-        const auto tracy_ctx = ___tracy_emit_zone_begin_alloc(tracy_srcloc, 1);
-        ctx_ext.TracyExecutionCalls.emplace_back(tracy_ctx);
-#endif
     }
-    else {
-        PushStackTrace(storage->SrcLoc);
+
+    PushStackTrace(storage->SrcLoc);
 
 #if FO_TRACY
-        const auto tracy_srcloc = ___tracy_alloc_srcloc(storage->SrcLoc.line, storage->FileBuf.data(), storage->FileBufLen, storage->FuncBuf.data(), storage->FuncBufLen, 0);
-        const auto tracy_ctx = ___tracy_emit_zone_begin_alloc(tracy_srcloc, 1);
-        ctx_ext.TracyExecutionCalls.emplace_back(tracy_ctx);
+    const auto tracy_srcloc = ___tracy_alloc_srcloc(storage->SrcLoc.line, storage->FileBuf.data(), storage->FileBufLen, storage->FuncBuf.data(), storage->FuncBufLen, 0);
+    const auto tracy_ctx = ___tracy_emit_zone_begin_alloc(tracy_srcloc, 1);
+    ctx_ext.TracyExecutionCalls.emplace_back(tracy_ctx);
 #endif
-    }
 
     ctx_ext.ExecutionCalls++;
 }
@@ -664,6 +739,39 @@ static void AngelScriptException(asIScriptContext* ctx, void* param)
     }
 }
 
+static void AngelScriptProfilerSample(asIScriptContext* ctx, void* param)
+{
+    auto* profiler = static_cast<ScriptProfiler*>(param);
+    const auto samples = profiler->ConsumePendingSamples();
+
+    if (samples == 0) {
+        return;
+    }
+
+    // Nested executions (script -> engine -> script) continue stack of parent context
+    small_vector<asIScriptContext*, 4> contexts;
+
+    for (auto* cur_ctx = ctx; cur_ctx != nullptr;) {
+        contexts.emplace_back(cur_ctx);
+        auto& cur_ctx_ext = GET_CONTEXT_EXT(cur_ctx);
+        cur_ctx = cur_ctx_ext.Parent.get();
+    }
+
+    small_vector<const void*, 32> call_stack;
+
+    for (auto it = contexts.rbegin(); it != contexts.rend(); ++it) {
+        auto* cur_ctx = *it;
+
+        for (auto level = numeric_cast<int32>(cur_ctx->GetCallstackSize()) - 1; level >= 0; level--) {
+            if (const auto* func = cur_ctx->GetFunction(numeric_cast<asUINT>(level)); func != nullptr) {
+                call_stack.emplace_back(func);
+            }
+        }
+    }
+
+    safe_call([&] { profiler->AddSample({call_stack.data(), call_stack.size()}, samples, [](const void* func) -> string { return static_cast<const asIScriptFunction*>(func)->GetDeclaration(true, true); }); });
+}
+
 #else
 class SCRIPT_BACKEND_CLASS : public ScriptSystemBackend
 {
@@ -671,6 +779,7 @@ public:
     void Init(BaseEngine* engine, ScriptSystem& script_sys, const vector<File>* script_files, const FileSystem* resources);
 
     vector<uint8> CompiledScriptData {};
+    vector<string> IncludedFiles {};
 };
 #endif
 
@@ -794,7 +903,7 @@ template<typename T, typename U, typename T2 = T, typename U2 = U>
 
     map<T, U> map;
 
-    for (auto&& [pkey, pvalue] : as_dict->GetMap()) {
+    for (auto&& [pkey, pvalue] : as_dict->GetEntries()) {
         const auto& key = *static_cast<T2*>(pkey);
         const auto& value = *static_cast<U2*>(pvalue);
         map.emplace(static_cast<T>(key), static_cast<U>(value));
@@ -987,6 +1096,25 @@ template<typename T, typename U, typename T2 = T, typename U2 = U>
     return result;
 }
 
+[[maybe_unused]] static void ResolveASArgsBackendType(const asIScriptFunction* func, ScriptFuncDesc& func_desc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(func);
+
+    func_desc.ArgsBackendType.clear();
+    func_desc.ArgsBackendType.reserve(func->GetParamCount());
+
+    int32 as_result;
+
+    for (asUINT p = 0; p < func->GetParamCount(); p++) {
+        int32 param_type_id;
+        AS_VERIFY(func->GetParam(p, &param_type_id));
+
+        func_desc.ArgsBackendType.emplace_back((param_type_id & asTYPEID_MASK_OBJECT) != 0 ? func->GetEngine()->GetTypeInfoById(param_type_id) : nullptr);
+    }
+}
+
 #if !COMPILER_MODE
 static auto AngelScriptFuncCall(SCRIPT_BACKEND_CLASS* script_backend, ScriptFuncDesc* func_desc, asIScriptFunction* func, initializer_list<void*> args, void* ret) noexcept -> bool
 {
@@ -1008,8 +1136,18 @@ static auto AngelScriptFuncCall(SCRIPT_BACKEND_CLASS* script_backend, ScriptFunc
             FO_RUNTIME_ASSERT(!func_desc->RetType->Accessor);
         }
 
+        FO_RUNTIME_ASSERT(func_desc->ArgsBackendType.size() == args.size());
+
         auto* ctx = script_backend->PrepareContext(func);
 
+        // Array arguments are held until the call is over to let them be recycled
+        small_vector<ScriptArray*, 4> arg_arrays;
+        auto return_arg_arrays = ScopeCallback([&]() noexcept {
+            for (auto* arr : arg_arrays) {
+                safe_call([&] { script_backend->ArgArrays.Return(arr, script_backend->Engine->Settings.ScriptRecycleArgArrays); });
+            }
+        });
+
         if (args.size() != 0) {
             auto it = args.begin();
 
@@ -1018,15 +1156,20 @@ static auto AngelScriptFuncCall(SCRIPT_BACKEND_CLASS* script_backend, ScriptFunc
                 auto& arg_type = func_desc->ArgsType[i];
 
                 if (arg_type->Accessor->IsArray()) {
-                    ScriptArray* arr = CreateASArray(ctx->GetEngine(), strex("{}[]", arg_type->Name).c_str());
+                    auto* as_type_info = static_cast<asITypeInfo*>(func_desc->ArgsBackendType[i]);
+                    FO_RUNTIME_ASSERT(as_type_info);
+
+                    ScriptArray* arr = script_backend->ArgArrays.Request(as_type_info);
+                    arg_arrays.emplace_back(arr);
+
+                    const auto arr_size = arg_type->Accessor->GetArraySize(arg);
+                    arr->Resize(numeric_cast<int32>(arr_size));
 
-                    for (size_t n = 0, m = arg_type->Accessor->GetArraySize(arg); n < m; n++) {
-                        auto* elem = arg_type->Accessor->GetArrayElement(arg, n);
-                        arr->InsertLast(elem);
+                    for (size_t n = 0; n < arr_size; n++) {
+                        arr->SetValue(static_cast<int32>(n), arg_type->Accessor->GetArrayElement(arg, n));
                     }
 
                     ctx->SetArgObject(i, arr);
-                    arr->Release();
                 }
                 else if (arg_type->Accessor->IsReference()) {
                     ctx->SetArgAddress(i, arg_type->Accessor->GetData(arg));
@@ -1080,6 +1223,7 @@ template<typename TRet, typename... Args>
         func_desc.CallSupported = true;
         func_desc.RetType = script_backend->Engine->ScriptSys.ResolveEngineType(typeid(TRet));
         func_desc.ArgsType = {script_backend->Engine->ScriptSys.ResolveEngineType(typeid(Args))...};
+        ResolveASArgsBackendType(func, func_desc);
         func_desc.Delegate = func->GetDelegateObject() != nullptr;
         func_desc.Call = [script_backend, &func_desc, as_func = refcount_ptr(func)](initializer_list<void*> args, void* ret) noexcept { //
             return AngelScriptFuncCall(script_backend, &func_desc, as_func.get_no_const(), args, ret);
@@ -1606,7 +1750,7 @@ static auto ASToProps(const Property* prop, void* as_obj) -> PropertyRawData
                 // Calculate size
                 size_t data_size = 0;
 
-                for (auto&& [key, value] : dict->GetMap()) {
+                for (auto&& [key, value] : dict->GetEntries()) {
                     if (prop->IsDictKeyString()) {
                         const auto& key_str = *static_cast<const string*>(key);
                         const auto key_len = numeric_cast<uint32>(key_str.length());
@@ -1634,7 +1778,7 @@ static auto ASToProps(const Property* prop, void* as_obj) -> PropertyRawData
                 // Make buffer
                 auto* buf = prop_data.Alloc(data_size);
 
-                for (auto&& [key, value] : dict->GetMap()) {
+                for (auto&& [key, value] : dict->GetEntries()) {
                     const auto* arr = *static_cast<const ScriptArray**>(value);
 
                     if (prop->IsDictKeyString()) {
@@ -1721,7 +1865,7 @@ static auto ASToProps(const Property* prop, void* as_obj) -> PropertyRawData
                 // Calculate size
                 size_t data_size = 0;
 
-                for (auto&& [key, value] : dict->GetMap()) {
+                for (auto&& [key, value] : dict->GetEntries()) {
                     if (prop->IsDictKeyString()) {
                         const auto& key_str = *static_cast<const string*>(key);
                         const auto key_len = numeric_cast<uint32>(key_str.length());
@@ -1740,7 +1884,7 @@ static auto ASToProps(const Property* prop, void* as_obj) -> PropertyRawData
                 // Make buffer
                 uint8* buf = prop_data.Alloc(data_size);
 
-                for (auto&& [key, value] : dict->GetMap()) {
+                for (auto&& [key, value] : dict->GetEntries()) {
                     const auto& str = *static_cast<const string*>(value);
 
                     if (prop->IsDictKeyString()) {
@@ -1784,7 +1928,7 @@ static auto ASToProps(const Property* prop, void* as_obj) -> PropertyRawData
 
                 const auto value_element_size = prop->GetBaseSize();
 
-                for (auto&& [key, value] : dict->GetMap()) {
+                for (auto&& [key, value] : dict->GetEntries()) {
                     const auto& key_str = *static_cast<const string*>(key);
                     const auto key_len = numeric_cast<uint32>(key_str.length());
                     data_size += sizeof(key_len) + key_len;
@@ -1794,7 +1938,7 @@ static auto ASToProps(const Property* prop, void* as_obj) -> PropertyRawData
                 // Make buffer
                 auto* buf = prop_data.Alloc(data_size);
 
-                for (auto&& [key, value] : dict->GetMap()) {
+                for (auto&& [key, value] : dict->GetEntries()) {
                     const auto& key_str = *static_cast<const string*>(key);
                     const auto key_len = numeric_cast<uint32>(key_str.length());
 
@@ -1824,7 +1968,7 @@ static auto ASToProps(const Property* prop, void* as_obj) -> PropertyRawData
             if (data_size != 0) {
                 auto* buf = prop_data.Alloc(data_size);
 
-                for (auto&& [key, value] : dict->GetMap()) {
+                for (auto&& [key, value] : dict->GetEntries()) {
                     if (prop->IsDictKeyHash()) {
                         const auto hkey = static_cast<const hstring*>(key)->as_hash();
                         MemCopy(buf, &hkey, key_element_size);
@@ -2249,8 +2393,9 @@ static void Global_Yield(int32 time)
     auto* ctx = asGetActiveContext();
     FO_RUNTIME_ASSERT(ctx);
     auto* engine = GET_ENGINE_FROM_AS_ENGINE(ctx->GetEngine());
-    auto& ctx_ext = GET_CONTEXT_EXT(ctx);
-    ctx_ext.SuspendEndTime = engine->GameTime.GetFrameTime() + std::chrono::milliseconds {time};
+    auto* script_backend = GET_SCRIPT_BACKEND_FROM_ENGINE(engine);
+    const auto& ctx_ext = GET_CONTEXT_EXT(ctx);
+    script_backend->Coroutines.SuspendUntil(ctx, engine->GameTime.GetFrameTime() + std::chrono::milliseconds {time}, ctx_ext.ValidCheck.get());
     ctx->Suspend();
 
 #else
@@ -2259,6 +2404,87 @@ static void Global_Yield(int32 time)
 #endif
 }
 
+#if !COMPILER_MODE
+static void WaitScriptEvent(const Entity* target, hstring event, int32 timeout)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto* ctx = asGetActiveContext();
+    FO_RUNTIME_ASSERT(ctx);
+    auto* engine = GET_ENGINE_FROM_AS_ENGINE(ctx->GetEngine());
+    auto* script_backend = GET_SCRIPT_BACKEND_FROM_ENGINE(engine);
+    const auto& ctx_ext = GET_CONTEXT_EXT(ctx);
+    const auto deadline = timeout >= 0 ? optional<nanotime>(engine->GameTime.GetFrameTime() + std::chrono::milliseconds {timeout}) : std::nullopt;
+    script_backend->Coroutines.SuspendOnEvent(ctx, event, deadline, ctx_ext.ValidCheck.get(), target);
+    ctx->Suspend();
+}
+
+static auto NotifyScriptEvent(const Entity* target, hstring event) -> int32
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto* ctx = asGetActiveContext();
+    FO_RUNTIME_ASSERT(ctx);
+    auto* engine = GET_ENGINE_FROM_AS_ENGINE(ctx->GetEngine());
+    return numeric_cast<int32>(engine->ScriptSys.NotifyEvent(event, target));
+}
+#endif
+
+static void Global_WaitEvent(const hstring& event, int32 timeout)
+{
+    FO_STACK_TRACE_ENTRY();
+
+#if !COMPILER_MODE
+    WaitScriptEvent(nullptr, event, timeout);
+
+#else
+    ignore_unused(event, timeout);
+    throw ScriptCompilerException("Stub");
+#endif
+}
+
+static void Global_WaitEntityEvent(Entity* target, const hstring& event, int32 timeout)
+{
+    FO_STACK_TRACE_ENTRY();
+
+#if !COMPILER_MODE
+    ENTITY_VERIFY_NULL(target);
+    ENTITY_VERIFY(target);
+    WaitScriptEvent(target, event, timeout);
+
+#else
+    ignore_unused(target, event, timeout);
+    throw ScriptCompilerException("Stub");
+#endif
+}
+
+static auto Global_NotifyEvent(const hstring& event) -> int32
+{
+    FO_STACK_TRACE_ENTRY();
+
+#if !COMPILER_MODE
+    return NotifyScriptEvent(nullptr, event);
+
+#else
+    ignore_unused(event);
+    throw ScriptCompilerException("Stub");
+#endif
+}
+
+static auto Global_NotifyEntityEvent(Entity* target, const hstring& event) -> int32
+{
+    FO_STACK_TRACE_ENTRY();
+
+#if !COMPILER_MODE
+    ENTITY_VERIFY_NULL(target);
+    return NotifyScriptEvent(target, event);
+
+#else
+    ignore_unused(target, event);
+    throw ScriptCompilerException("Stub");
+#endif
+}
+
 template<typename T>
 static void Game_SetPropertyGetter(asIScriptGeneric* gen)
 {
@@ -2474,7 +2700,8 @@ static void Game_AddPropertySetter(asIScriptGeneric* gen)
             }
         }
         else {
-            // Will be run from scheduler
+            // Will be run from scheduler at next tick
+            script_backend->Coroutines.SuspendUntil(ctx, nanotime::zero, entity);
             ignore_unused(has_value_ref);
             ignore_unused(prop_data);
         }
@@ -2787,6 +3014,117 @@ static void Property_SetValue(asIScriptGeneric* gen)
 #endif
 }
 
+// Typed accessors for non virtual plain data properties, read and write pod data directly without raw data marshalling
+template<typename T, typename TValue, typename TScript>
+static auto Property_GetPodValueDirect(const T* entity, const Property* prop) -> TScript
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+#if !COMPILER_MODE
+    ENTITY_VERIFY_NULL(entity);
+    ENTITY_VERIFY(entity);
+
+    const auto& props = entity->GetProperties();
+    FO_STRONG_ASSERT(props.GetRegistrator() == prop->GetRegistrator());
+
+    return PodPropertyAccess<TValue, TScript>::Get(props, prop);
+
+#else
+    ignore_unused(entity, prop);
+    throw ScriptCompilerException("Stub");
+#endif
+}
+
+template<typename T, typename TValue, typename TScript>
+static void Property_SetPodValueDirect(T* entity, const Property* prop, TScript value)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+#if !COMPILER_MODE
+    ENTITY_VERIFY_NULL(entity);
+    ENTITY_VERIFY(entity);
+
+    // Typed set calls setters and post setters (sync, persistence) same way as raw data path
+    auto& props = entity->GetPropertiesForEdit();
+    FO_STRONG_ASSERT(props.GetRegistrator() == prop->GetRegistrator());
+
+    PodPropertyAccess<TValue, TScript>::Set(props, prop, value);
+
+#else
+    ignore_unused(entity, prop, value);
+    throw ScriptCompilerException("Stub");
+#endif
+}
+
+#ifndef AS_MAX_PORTABILITY
+template<typename T, typename TValue, typename TScript>
+auto PodPropertyAccessor::Get(const T* entity) const -> TScript
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return Property_GetPodValueDirect<T, TValue, TScript>(entity, Prop.get());
+}
+
+template<typename T, typename TValue, typename TScript>
+void PodPropertyAccessor::Set(T* entity, TScript value) const
+{
+    FO_STACK_TRACE_ENTRY();
+
+    Property_SetPodValueDirect<T, TValue, TScript>(entity, Prop.get(), value);
+}
+
+#define POD_PROPERTY_ACCESS_CONV asCALL_THISCALL_OBJFIRST
+
+#else
+template<typename T, typename TValue, typename TScript>
+static void Property_GetPodValue(asIScriptGeneric* gen)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto* prop = static_cast<const Property*>(gen->GetAuxiliary());
+    new (gen->GetAddressOfReturnLocation()) TScript(Property_GetPodValueDirect<T, TValue, TScript>(static_cast<const T*>(gen->GetObject()), prop));
+}
+
+template<typename T, typename TValue, typename TScript>
+static void Property_SetPodValue(asIScriptGeneric* gen)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto* prop = static_cast<const Property*>(gen->GetAuxiliary());
+    Property_SetPodValueDirect<T, TValue, TScript>(static_cast<T*>(gen->GetObject()), prop, *static_cast<const TScript*>(gen->GetAddressOfArg(0)));
+}
+
+#define POD_PROPERTY_ACCESS_CONV SCRIPT_GENERIC_CONV
+#endif
+
+struct PodPropertyAccessFuncs
+{
+    asSFuncPtr Getter {};
+    asSFuncPtr Setter {};
+};
+
+template<typename T, typename TValue, typename TScript = TValue>
+static auto MakePodPropertyAccessFuncs() -> PodPropertyAccessFuncs
+{
+    FO_STACK_TRACE_ENTRY();
+
+#ifndef AS_MAX_PORTABILITY
+    return {asSMethodPtr<sizeof(void(PodPropertyAccessor::*)())>::Convert(&PodPropertyAccessor::Get<T, TValue, TScript>), //
+        asSMethodPtr<sizeof(void(PodPropertyAccessor::*)())>::Convert(&PodPropertyAccessor::Set<T, TValue, TScript>)};
+#else
+    return {asFUNCTION((Property_GetPodValue<T, TValue, TScript>)), asFUNCTION((Property_SetPodValue<T, TValue, TScript>))};
+#endif
+}
+
+// Selects typed accessors by property base type, hashes and structs keep generic path
+template<typename T>
+static auto ResolvePodPropertyAccessFuncs(const Property* prop) -> optional<PodPropertyAccessFuncs>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return ResolvePodPropertyAccess(prop, []<typename TAccess>(TAccess) { return MakePodPropertyAccessFuncs<T, typename TAccess::ValueType, typename TAccess::ScriptType>(); });
+}
+
 template<typename T>
 static auto EntityDownCast(T* entity) -> Entity*
 {
@@ -3508,6 +3846,7 @@ static T* Game_GetEntity(BaseEngine* engine, ident_t id)
 #if !COMPILER_MODE
 #if SERVER_SCRIPTING
     const auto entity_type = engine->Hashes.ToHashedString(T2::ENTITY_TYPE_NAME);
+    static_cast<FOServer*>(engine)->EntityMngr.EnsureLoaded(id);
     auto* entity = static_cast<FOServer*>(engine)->EntityMngr.GetCustomEntity(entity_type, id);
     return dynamic_cast<T*>(entity);
 
@@ -3829,7 +4168,7 @@ static void CallbackMessage(const asSMessageInfo* msg, void* param)
 }
 
 #if COMPILER_MODE && !COMPILER_VALIDATION_MODE
-static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& script_files) -> vector<uint8>;
+static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& script_files, vector<string>& included_files) -> vector<uint8>;
 #else
 static void RestoreRootModule(asIScriptEngine* as_engine, span<const uint8> script_bin);
 #endif
@@ -3987,6 +4326,8 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
     AS_VERIFY(as_engine->RegisterGlobalFunction("void ThrowException(string message, ?&in obj1, ?&in obj2, ?&in obj3, ?&in obj4, ?&in obj5, ?&in obj6, ?&in obj7, ?&in obj8, ?&in obj9)", SCRIPT_GENERIC(Global_ThrowException<9>), SCRIPT_GENERIC_CONV));
     AS_VERIFY(as_engine->RegisterGlobalFunction("void ThrowException(string message, ?&in obj1, ?&in obj2, ?&in obj3, ?&in obj4, ?&in obj5, ?&in obj6, ?&in obj7, ?&in obj8, ?&in obj9, ?&in obj10)", SCRIPT_GENERIC(Global_ThrowException<10>), SCRIPT_GENERIC_CONV));
     AS_VERIFY(as_engine->RegisterGlobalFunction("void Yield(int duration)", SCRIPT_FUNC(Global_Yield), SCRIPT_FUNC_CONV));
+    AS_VERIFY(as_engine->RegisterGlobalFunction("void WaitEvent(const hstring &in eventName, int timeout = -1)", SCRIPT_FUNC(Global_WaitEvent), SCRIPT_FUNC_CONV));
+    AS_VERIFY(as_engine->RegisterGlobalFunction("int NotifyEvent(const hstring &in eventName)", SCRIPT_FUNC(Global_NotifyEvent), SCRIPT_FUNC_CONV));
 
     // Strong type registrators
 #define REGISTER_VALUE_TYPE(name, type) \
@@ -4155,7 +4496,8 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
     entity_is_global.emplace(class_name); \
     entity_get_component_func_ptr.emplace(class_name "Singleton", SCRIPT_GENERIC((Property_GetComponent<real_class>))); \
     entity_get_value_func_ptr.emplace(class_name "Singleton", SCRIPT_GENERIC((Property_GetValue<real_class>))); \
-    entity_set_value_func_ptr.emplace(class_name "Singleton", SCRIPT_GENERIC((Property_SetValue<real_class>)))
+    entity_set_value_func_ptr.emplace(class_name "Singleton", SCRIPT_GENERIC((Property_SetValue<real_class>))); \
+    entity_pod_access_resolver.emplace(class_name "Singleton", &ResolvePodPropertyAccessFuncs<real_class>)
 
 #define REGISTER_ENTITY(class_name, real_class) \
     REGISTER_BASE_ENTITY(class_name, real_class); \
@@ -4165,7 +4507,8 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
     AS_VERIFY(as_engine->RegisterObjectMethod(class_name, "ident get_Id() const", SCRIPT_FUNC_THIS((Entity_Id<real_class>)), SCRIPT_FUNC_THIS_CONV)); \
     entity_get_component_func_ptr.emplace(class_name, SCRIPT_GENERIC((Property_GetComponent<real_class>))); \
     entity_get_value_func_ptr.emplace(class_name, SCRIPT_GENERIC((Property_GetValue<real_class>))); \
-    entity_set_value_func_ptr.emplace(class_name, SCRIPT_GENERIC((Property_SetValue<real_class>)))
+    entity_set_value_func_ptr.emplace(class_name, SCRIPT_GENERIC((Property_SetValue<real_class>))); \
+    entity_pod_access_resolver.emplace(class_name, &ResolvePodPropertyAccessFuncs<real_class>)
 
 #define REGISTER_CUSTOM_ENTITY(class_name, real_class, entity_info) \
     REGISTER_BASE_ENTITY(class_name, real_class); \
@@ -4181,6 +4524,7 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
     entity_get_component_func_ptr.emplace(class_name, SCRIPT_GENERIC((Property_GetComponent<real_class>))); \
     entity_get_value_func_ptr.emplace(class_name, SCRIPT_GENERIC((Property_GetValue<real_class>))); \
     entity_set_value_func_ptr.emplace(class_name, SCRIPT_GENERIC((Property_SetValue<real_class>))); \
+    entity_pod_access_resolver.emplace(class_name, &ResolvePodPropertyAccessFuncs<real_class>); \
     entity_is_custom.emplace(class_name)
 
 #define REGISTER_ENTITY_ABSTRACT(class_name, real_class) \
@@ -4247,6 +4591,8 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
     }
 
     REGISTER_BASE_ENTITY("Entity", Entity);
+    AS_VERIFY(as_engine->RegisterGlobalFunction("void WaitEvent(Entity@+ target, const hstring &in eventName, int timeout = -1)", SCRIPT_FUNC(Global_WaitEntityEvent), SCRIPT_FUNC_CONV));
+    AS_VERIFY(as_engine->RegisterGlobalFunction("int NotifyEvent(Entity@+ target, const hstring &in eventName)", SCRIPT_FUNC(Global_NotifyEntityEvent), SCRIPT_FUNC_CONV));
 
     unordered_set<string> entity_is_custom;
     unordered_set<string> entity_is_global;
@@ -4256,6 +4602,7 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
     unordered_map<string, asSFuncPtr> entity_get_component_func_ptr;
     unordered_map<string, asSFuncPtr> entity_get_value_func_ptr;
     unordered_map<string, asSFuncPtr> entity_set_value_func_ptr;
+    unordered_map<string, optional<PodPropertyAccessFuncs> (*)(const Property*)> entity_pod_access_resolver;
 
     // Events
 #define REGISTER_ENTITY_EVENT(entity_name, class_name, real_class, event_name, as_args_ent, as_args, func_entry) \
@@ -4345,6 +4692,7 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
         const auto get_proto_value_func_ptr = is_has_protos ? entity_get_value_func_ptr.at(proto_class_name) : asSFuncPtr();
         const auto get_static_value_func_ptr = is_has_statics ? entity_get_value_func_ptr.at(static_class_name) : asSFuncPtr();
         const auto set_value_func_ptr = entity_set_value_func_ptr.at(class_name);
+        const auto pod_access_resolver = entity_pod_access_resolver.at(class_name);
         const auto get_component_func_ptr = entity_get_component_func_ptr.at(class_name);
         const auto get_abstract_component_func_ptr = is_has_abstract ? entity_get_component_func_ptr.at(abstract_class_name) : asSFuncPtr();
         const auto get_proto_component_func_ptr = is_has_protos ? entity_get_component_func_ptr.at(proto_class_name) : asSFuncPtr();
@@ -4378,9 +4726,29 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
             const auto component = prop->GetComponent();
             const auto is_handle = prop->IsArray() || prop->IsDict();
 
+            // Non virtual plain data goes through typed accessors
+#if !COMPILER_MODE
+            const auto pod_access = pod_access_resolver(prop);
+#ifndef AS_MAX_PORTABILITY
+            const auto* pod_access_obj = pod_access.has_value() ? &PodPropertyAccessors.emplace_back(PodPropertyAccessor {.Prop = prop}) : nullptr;
+#else
+            const auto* pod_access_obj = prop;
+#endif
+#else
+            const optional<PodPropertyAccessFuncs> pod_access;
+            const void* pod_access_obj = nullptr;
+            ignore_unused(pod_access_resolver);
+#endif
+
             if (!prop->IsDisabled()) {
                 const auto decl_get = strex("{}{} get_{}() const", MakePropertyASName(prop), is_handle ? "@" : "", prop->GetNameWithoutComponent()).str();
-                AS_VERIFY(as_engine->RegisterObjectMethod(component ? strex("{}{}Component", type_name_str, component).c_str() : class_name.c_str(), decl_get.c_str(), get_value_func_ptr, SCRIPT_GENERIC_CONV, PASS_AS_PVOID(prop)));
+
+                if (pod_access.has_value()) {
+                    AS_VERIFY(as_engine->RegisterObjectMethod(component ? strex("{}{}Component", type_name_str, component).c_str() : class_name.c_str(), decl_get.c_str(), pod_access->Getter, POD_PROPERTY_ACCESS_CONV, PASS_AS_PVOID(pod_access_obj)));
+                }
+                else {
+                    AS_VERIFY(as_engine->RegisterObjectMethod(component ? strex("{}{}Component", type_name_str, component).c_str() : class_name.c_str(), decl_get.c_str(), get_value_func_ptr, SCRIPT_GENERIC_CONV, PASS_AS_PVOID(prop)));
+                }
 
                 if (!prop->IsVirtual() || prop->IsNullGetterForProto()) {
                     if (is_has_abstract) {
@@ -4397,7 +4765,13 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
 
             if (!prop->IsDisabled() && prop->IsMutable()) {
                 const auto decl_set = strex("void set_{}({}{})", prop->GetNameWithoutComponent(), MakePropertyASName(prop), is_handle ? "@+" : "").str();
-                AS_VERIFY(as_engine->RegisterObjectMethod(component ? strex("{}{}Component", type_name_str, component).c_str() : class_name.c_str(), decl_set.c_str(), set_value_func_ptr, SCRIPT_GENERIC_CONV, PASS_AS_PVOID(prop)));
+
+                if (pod_access.has_value()) {
+                    AS_VERIFY(as_engine->RegisterObjectMethod(component ? strex("{}{}Component", type_name_str, component).c_str() : class_name.c_str(), decl_set.c_str(), pod_access->Setter, POD_PROPERTY_ACCESS_CONV, PASS_AS_PVOID(pod_access_obj)));
+                }
+                else {
+                    AS_VERIFY(as_engine->RegisterObjectMethod(component ? strex("{}{}Component", type_name_str, component).c_str() : class_name.c_str(), decl_set.c_str(), set_value_func_ptr, SCRIPT_GENERIC_CONV, PASS_AS_PVOID(prop)));
+                }
             }
         }
 
@@ -4436,7 +4810,7 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
 #endif
 
 #if COMPILER_MODE && !COMPILER_VALIDATION_MODE
-    CompiledScriptData = CompileRootModule(as_engine, *script_files);
+    CompiledScriptData = CompileRootModule(as_engine, *script_files, IncludedFiles);
     as_engine->ShutDownAndRelease();
 #else
 #if SERVER_SCRIPTING
@@ -4583,6 +4957,7 @@ void SCRIPT_BACKEND_CLASS::Init(BaseEngine* engine, ScriptSystem& script_sys, co
             asDWORD ret_flags = 0;
             int32 ret_type_id = func->GetReturnTypeId(&ret_flags);
             func_desc->RetType = as_type_to_type_info(ret_type_id, ret_flags, true);
+            ResolveASArgsBackendType(func, *func_desc);
 
             func_desc->CallSupported = func_desc->RetType && std::ranges::find(func_desc->ArgsType, nullptr) == func_desc->ArgsType.end();
 
@@ -4647,7 +5022,7 @@ private:
 };
 
 #if COMPILER_MODE && !COMPILER_VALIDATION_MODE
-static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& script_files) -> vector<uint8>
+static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& script_files, vector<string>& included_files) -> vector<uint8>
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -4657,9 +5032,10 @@ static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& sc
     class ScriptLoader : public Preprocessor::FileLoader
     {
     public:
-        ScriptLoader(const string* root, const map<string, string>* files) :
+        ScriptLoader(const string* root, const map<string, string>* files, vector<string>* included_files) :
             _rootScript {root},
-            _scriptFiles {files}
+            _scriptFiles {files},
+            _includedFiles {included_files}
         {
             FO_STACK_TRACE_ENTRY();
 
@@ -4692,7 +5068,16 @@ static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& sc
                 return true;
             }
 
-            return Preprocessor::FileLoader::LoadFile(dir, file_name, data, file_path);
+            // Nested includes are read from disk and become dependencies of compilation result
+            if (!Preprocessor::FileLoader::LoadFile(dir, file_name, data, file_path)) {
+                return false;
+            }
+
+            if (const string_view included_path = file_path; std::ranges::find(*_includedFiles, included_path) == _includedFiles->end()) {
+                _includedFiles->emplace_back(included_path);
+            }
+
+            return true;
         }
 
         void FileLoaded() override
@@ -4705,6 +5090,7 @@ static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& sc
     private:
         const string* _rootScript;
         const map<string, string>* _scriptFiles;
+        vector<string>* _includedFiles;
         int32 _includeDeep {};
     };
 
@@ -4730,8 +5116,13 @@ static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& sc
         final_script_files.emplace(std::move(script_path), std::move(script_content));
     }
 
+    // Order must not depend on input enumeration, otherwise byte code differs between runs
     std::ranges::stable_sort(final_script_files_order, [](auto&& a, auto&& b) {
         if (std::get<0>(a) == std::get<0>(b)) {
+            if (std::get<1>(a) == std::get<1>(b)) {
+                return std::get<2>(a) < std::get<2>(b);
+            }
+
             return std::get<1>(a) < std::get<1>(b);
         }
         else {
@@ -4763,7 +5154,8 @@ static auto CompileRootModule(asIScriptEngine* as_engine, const vector<File>& sc
     Preprocessor::Define(preprocessor_context, "MAPPER 1");
 #endif
 
-    auto loader = ScriptLoader(&root_script, &final_script_files);
+    included_files.clear();
+    auto loader = ScriptLoader(&root_script, &final_script_files, &included_files);
     Preprocessor::StringOutStream result, errors;
     const auto errors_count = Preprocessor::Preprocess(preprocessor_context, "", result, &errors, &loader);
 
@@ -4855,6 +5247,8 @@ static void RestoreRootModule(asIScriptEngine* as_engine, span<const uint8> scri
     if (as_result < 0) {
         throw ScriptException("Can't load binary", as_result);
     }
+
+    PrepareScriptCallSites(as_engine);
 }
 #endif
 
@@ -4863,7 +5257,7 @@ void FO_CONCAT(Init_, SCRIPT_BACKEND_CLASS)(BaseEngine* engine)
 #elif COMPILER_VALIDATION_MODE
 void FO_CONCAT(Init_, SCRIPT_BACKEND_CLASS)(BaseEngine* engine, ScriptSystem& script_sys, const FileSystem& resources)
 #else
-auto FO_CONCAT(Init_, SCRIPT_BACKEND_CLASS)(const vector<File>& script_files) -> vector<uint8>
+auto FO_CONCAT(Init_, SCRIPT_BACKEND_CLASS)(const vector<File>& script_files, vector<string>* included_files) -> vector<uint8>
 #endif
 {
     FO_STACK_TRACE_ENTRY();
@@ -4881,6 +5275,11 @@ auto FO_CONCAT(Init_, SCRIPT_BACKEND_CLASS)(const vector<File>& script_files) ->
 #else
     auto engine = SafeAlloc::MakeUnique<COMPILER_ENGINE_CLASS>();
     script_backend->Init(engine.get(), engine->ScriptSys, &script_files, nullptr);
+
+    if (included_files != nullptr) {
+        *included_files = std::move(script_backend->IncludedFiles);
+    }
+
     return std::move(script_backend->CompiledScriptData);
 #endif
 }
@@ -252,6 +252,8 @@ FO_SCRIPT_API Item* Server_Game_GetItem(FOServer* server, ident_t itemId)
         throw ScriptException("Item id arg is zero");
     }
 
+    server->EntityMngr.EnsureLoaded(itemId);
+
     auto* item = server->EntityMngr.GetItem(itemId);
     if (item == nullptr || item->IsDestroyed()) {
         return nullptr;
@@ -456,6 +458,8 @@ FO_SCRIPT_API void Server_Game_MoveItems(FOServer* server, const vector<Item*>&
 ///@ ExportMethod
 FO_SCRIPT_API void Server_Game_DestroyEntity(FOServer* server, ident_t id)
 {
+    server->EntityMngr.EnsureLoaded(id);
+
     if (auto* entity = server->EntityMngr.GetEntity(id); entity != nullptr) {
         server->EntityMngr.DestroyEntity(entity);
     }
@@ -473,6 +477,8 @@ FO_SCRIPT_API void Server_Game_DestroyEntity(FOServer* server, ServerEntity* ent
 FO_SCRIPT_API void Server_Game_DestroyEntities(FOServer* server, const vector<ident_t>& ids)
 {
     for (const auto id : ids) {
+        server->EntityMngr.EnsureLoaded(id);
+
         if (auto* entity = server->EntityMngr.GetEntity(id); entity != nullptr) {
             server->EntityMngr.DestroyEntity(entity);
         }
@@ -515,6 +521,8 @@ FO_SCRIPT_API void Server_Game_DestroyItem(FOServer* server, Item* item, int32 c
 ///@ ExportMethod
 FO_SCRIPT_API void Server_Game_DestroyItem(FOServer* server, ident_t itemId)
 {
+    server->EntityMngr.EnsureLoaded(itemId);
+
     auto* item = server->EntityMngr.GetItem(itemId);
 
     if (item != nullptr) {
@@ -525,6 +533,8 @@ FO_SCRIPT_API void Server_Game_DestroyItem(FOServer* server, ident_t itemId)
 ///@ ExportMethod
 FO_SCRIPT_API void Server_Game_DestroyItem(FOServer* server, ident_t itemId, int32 count)
 {
+    server->EntityMngr.EnsureLoaded(itemId);
+
     auto* item = server->EntityMngr.GetItem(itemId);
 
     if (item != nullptr && count > 0) {
@@ -554,6 +564,8 @@ FO_SCRIPT_API void Server_Game_DestroyItems(FOServer* server, const vector<ident
 {
     for (const auto item_id : itemIds) {
         if (item_id) {
+            server->EntityMngr.EnsureLoaded(item_id);
+
             auto* item = server->EntityMngr.GetItem(item_id);
 
             if (item != nullptr) {
@@ -575,6 +587,8 @@ FO_SCRIPT_API void Server_Game_DestroyCritter(FOServer* server, Critter* cr)
 FO_SCRIPT_API void Server_Game_DestroyCritter(FOServer* server, ident_t crId)
 {
     if (crId) {
+        server->EntityMngr.EnsureLoaded(crId);
+
         if (Critter* cr = server->EntityMngr.GetCritter(crId); cr != nullptr && !cr->GetControlledByPlayer()) {
             server->CrMngr.DestroyCritter(cr);
         }
@@ -596,6 +610,8 @@ FO_SCRIPT_API void Server_Game_DestroyCritters(FOServer* server, const vector<id
 {
     for (const auto id : critterIds) {
         if (id) {
+            server->EntityMngr.EnsureLoaded(id);
+
             if (Critter* cr = server->EntityMngr.GetCritter(id); cr != nullptr && !cr->GetControlledByPlayer()) {
                 server->CrMngr.DestroyCritter(cr);
             }
@@ -660,6 +676,8 @@ FO_SCRIPT_API void Server_Game_DestroyLocation(FOServer* server, Location* loc)
 ///@ ExportMethod
 FO_SCRIPT_API void Server_Game_DestroyLocation(FOServer* server, ident_t locId)
 {
+    server->EntityMngr.EnsureLoaded(locId);
+
     auto* loc = server->EntityMngr.GetLocation(locId);
 
     if (loc != nullptr) {
@@ -678,6 +696,8 @@ FO_SCRIPT_API void Server_Game_DestroyMap(FOServer* server, Map* map)
 ///@ ExportMethod
 FO_SCRIPT_API void Server_Game_DestroyMap(FOServer* server, ident_t mapId)
 {
+    server->EntityMngr.EnsureLoaded(mapId);
+
     auto* map = server->EntityMngr.GetMap(mapId);
 
     if (map != nullptr) {
@@ -692,6 +712,8 @@ FO_SCRIPT_API Critter* Server_Game_GetCritter(FOServer* server, ident_t crId)
         return nullptr;
     }
 
+    server->EntityMngr.EnsureLoaded(crId);
+
     return server->EntityMngr.GetCritter(crId);
 }
 
@@ -740,6 +762,8 @@ FO_SCRIPT_API vector<Critter*> Server_Game_GetGlobalMapCritters(FOServer* server
 ///@ ExportMethod
 FO_SCRIPT_API Map* Server_Game_GetMap(FOServer* server, ident_t mapId)
 {
+    server->EntityMngr.EnsureLoaded(mapId);
+
     return server->EntityMngr.GetMap(mapId);
 }
 
@@ -758,6 +782,9 @@ FO_SCRIPT_API Map* Server_Game_GetMap(FOServer* server, hstring mapPid, int32 sk
 ///@ ExportMethod
 FO_SCRIPT_API vector<Map*> Server_Game_GetMaps(FOServer* server)
 {
+    // Paged out locations are reloaded, so enumeration sees whole world
+    server->EntityMngr.EnsureAllLoaded();
+
     vector<Map*> maps;
     maps.reserve(server->EntityMngr.GetLocationsCount());
 
@@ -771,6 +798,15 @@ FO_SCRIPT_API vector<Map*> Server_Game_GetMaps(FOServer* server)
 ///@ ExportMethod
 FO_SCRIPT_API vector<Map*> Server_Game_GetMaps(FOServer* server, hstring pid)
 {
+    if (pid) {
+        server->EntityMngr.EnsureProtoLoaded(pid);
+
+        const auto pid_maps = server->EntityMngr.GetMapsByProto(pid);
+        return vector<Map*>(pid_maps.begin(), pid_maps.end());
+    }
+
+    server->EntityMngr.EnsureAllLoaded();
+
     vector<Map*> maps;
 
     if (!pid) {
@@ -789,6 +825,8 @@ FO_SCRIPT_API vector<Map*> Server_Game_GetMaps(FOServer* server, hstring pid)
 ///@ ExportMethod
 FO_SCRIPT_API Location* Server_Game_GetLocation(FOServer* server, ident_t locId)
 {
+    server->EntityMngr.EnsureLoaded(locId);
+
     return server->EntityMngr.GetLocation(locId);
 }
 
@@ -807,6 +845,8 @@ FO_SCRIPT_API Location* Server_Game_GetLocation(FOServer* server, hstring locPid
 ///@ ExportMethod
 FO_SCRIPT_API Location* Server_Game_GetLocation(FOServer* server, LocationComponent component)
 {
+    server->EntityMngr.EnsureAllLoaded();
+
     for (auto& loc : server->EntityMngr.GetLocations() | std::views::values) {
         if (loc->GetProto()->HasComponent(static_cast<hstring::hash_t>(component))) {
             return loc.get();
@@ -821,6 +861,14 @@ FO_SCRIPT_API Location* Server_Game_GetLocation(FOServer* server, LocationProper
 {
     const auto* prop = ScriptHelpers::GetIntConvertibleEntityProperty<Location>(server, property);
 
+    if (auto* index = server->EntityMngr.GetPropertyIndex(prop); index != nullptr) {
+        const auto indexed_locs = index->Find(propertyValue);
+        return !indexed_locs.empty() ? static_cast<Location*>(indexed_locs.front().get()) : nullptr;
+    }
+
+    // Indexed entities are never paged out, only scan needs reload
+    server->EntityMngr.EnsureAllLoaded();
+
     for (auto& loc : server->EntityMngr.GetLocations() | std::views::values) {
         if (loc->GetValueAsInt(prop) == propertyValue) {
             return loc.get();
@@ -833,6 +881,8 @@ FO_SCRIPT_API Location* Server_Game_GetLocation(FOServer* server, LocationProper
 ///@ ExportMethod
 FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server)
 {
+    server->EntityMngr.EnsureAllLoaded();
+
     auto& locs = server->EntityMngr.GetLocations();
 
     vector<Location*> result;
@@ -848,6 +898,15 @@ FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server)
 ///@ ExportMethod
 FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server, hstring pid)
 {
+    if (pid) {
+        server->EntityMngr.EnsureProtoLoaded(pid);
+
+        const auto pid_locs = server->EntityMngr.GetLocationsByProto(pid);
+        return vector<Location*>(pid_locs.begin(), pid_locs.end());
+    }
+
+    server->EntityMngr.EnsureAllLoaded();
+
     auto& locs = server->EntityMngr.GetLocations();
     vector<Location*> result;
 
@@ -867,6 +926,8 @@ FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server, hstri
 ///@ ExportMethod
 FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server, LocationComponent component)
 {
+    server->EntityMngr.EnsureAllLoaded();
+
     auto& locs = server->EntityMngr.GetLocations();
 
     vector<Location*> result;
@@ -885,6 +946,13 @@ FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server, Locat
 FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server, LocationProperty property, int32 propertyValue)
 {
     const auto* prop = ScriptHelpers::GetIntConvertibleEntityProperty<Location>(server, property);
+
+    if (auto* index = server->EntityMngr.GetPropertyIndex(prop); index != nullptr) {
+        return vec_transform(index->Find(propertyValue), [](auto&& entity) -> Location* { return static_cast<Location*>(entity.get()); });
+    }
+
+    server->EntityMngr.EnsureAllLoaded();
+
     auto& locs = server->EntityMngr.GetLocations();
 
     vector<Location*> result;
@@ -899,9 +967,43 @@ FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server, Locat
     return result;
 }
 
+///@ ExportMethod
+FO_SCRIPT_API vector<Location*> Server_Game_GetLocations(FOServer* server, LocationProperty property, int32 minValue, int32 maxValue)
+{
+    const auto* prop = ScriptHelpers::GetIntConvertibleEntityProperty<Location>(server, property);
+
+    vector<Location*> result;
+
+    if (auto* index = server->EntityMngr.GetPropertyIndex(prop); index != nullptr && index->GetType() == EntityIndexType::Sorted) {
+        index->ForEachInRange(minValue, maxValue, [&](ServerEntity* entity) { result.emplace_back(static_cast<Location*>(entity)); });
+        return result;
+    }
+
+    server->EntityMngr.EnsureAllLoaded();
+
+    for (auto& loc : server->EntityMngr.GetLocations() | std::views::values) {
+        const auto value = loc->GetValueAsInt(prop);
+
+        if (value >= minValue && value <= maxValue) {
+            result.emplace_back(loc.get());
+        }
+    }
+
+    return result;
+}
+
 ///@ ExportMethod
 FO_SCRIPT_API vector<Item*> Server_Game_GetAllItems(FOServer* server, hstring pid)
 {
+    if (pid) {
+        server->EntityMngr.EnsureProtoLoaded(pid);
+
+        const auto pid_items = server->EntityMngr.GetItemsByProto(pid);
+        return vector<Item*>(pid_items.begin(), pid_items.end());
+    }
+
+    server->EntityMngr.EnsureAllLoaded();
+
     auto& items = server->EntityMngr.GetItems();
     vector<Item*> result;
 
@@ -921,16 +1023,7 @@ FO_SCRIPT_API vector<Item*> Server_Game_GetAllItems(FOServer* server, hstring pi
 ///@ ExportMethod
 FO_SCRIPT_API vector<Player*> Server_Game_GetOnlinePlayers(FOServer* server)
 {
-    auto& players = server->EntityMngr.GetPlayers();
-
-    vector<Player*> result;
-    result.reserve(players.size());
-
-    for (auto& player : players | std::views::values) {
-        result.emplace_back(player.get());
-    }
-
-    return result;
+    return server->EntityMngr.GetPlayers().values();
 }
 
 ///@ ExportMethod
@@ -942,12 +1035,21 @@ FO_SCRIPT_API vector<ident_t> Server_Game_GetRegisteredPlayerIds(FOServer* serve
 ///@ ExportMethod
 FO_SCRIPT_API vector<Critter*> Server_Game_GetAllNpc(FOServer* server)
 {
+    server->EntityMngr.EnsureAllLoaded();
+
     return server->CrMngr.GetNonPlayerCritters();
 }
 
 ///@ ExportMethod
 FO_SCRIPT_API vector<Critter*> Server_Game_GetAllNpc(FOServer* server, hstring pid)
 {
+    if (pid) {
+        server->EntityMngr.EnsureProtoLoaded(pid);
+    }
+    else {
+        server->EntityMngr.EnsureAllLoaded();
+    }
+
     vector<Critter*> result;
 
     for (auto* cr : server->CrMngr.GetNonPlayerCritters()) {
@@ -959,6 +1061,41 @@ FO_SCRIPT_API vector<Critter*> Server_Game_GetAllNpc(FOServer* server, hstring p
     return result;
 }
 
+///@ ExportMethod PassOwnership
+FO_SCRIPT_API CritterRange* Server_Game_QueryAllNpc(FOServer* server)
+{
+    auto range = SafeAlloc::MakeRefCounted<CritterRange>();
+
+    range->Entities = &server->EntityMngr;
+
+    range->AddRef();
+    return range.get();
+}
+
+///@ ExportMethod
+FO_SCRIPT_API vector<Critter*> Server_Game_ToArray(FOServer* server, CritterRange* range)
+{
+    ignore_unused(server);
+
+    if (range == nullptr) {
+        throw ScriptException("Range arg is null");
+    }
+
+    return range->ToVector();
+}
+
+///@ ExportMethod
+FO_SCRIPT_API vector<Item*> Server_Game_ToArray(FOServer* server, ItemRange* range)
+{
+    ignore_unused(server);
+
+    if (range == nullptr) {
+        throw ScriptException("Range arg is null");
+    }
+
+    return range->ToVector();
+}
+
 ///@ ExportMethod
 FO_SCRIPT_API void Server_Game_SetSynchronizedTime(FOServer* server, synctime time)
 {
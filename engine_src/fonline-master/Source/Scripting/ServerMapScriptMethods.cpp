@@ -304,6 +304,23 @@ FO_SCRIPT_API vector<Item*> Server_Map_GetItems(Map* self, ItemProperty property
     const auto map_items = self->GetItems();
 
     vector<Item*> result;
+
+    if (auto* index = self->GetEngine()->EntityMngr.GetPropertyIndex(prop); index != nullptr) {
+        const auto indexed_items = index->Find(propertyValue);
+
+        if (indexed_items.size() < map_items.size()) {
+            for (auto& entity : indexed_items) {
+                auto* item = static_cast<Item*>(entity.get());
+
+                if (item->GetOwnership() == ItemOwnership::MapHex && item->GetMapId() == self->GetId()) {
+                    result.emplace_back(item);
+                }
+            }
+
+            return result;
+        }
+    }
+
     result.reserve(map_items.size());
 
     for (auto& item : map_items) {
@@ -315,6 +332,36 @@ FO_SCRIPT_API vector<Item*> Server_Map_GetItems(Map* self, ItemProperty property
     return result;
 }
 
+///@ ExportMethod
+FO_SCRIPT_API vector<Item*> Server_Map_GetItems(Map* self, ItemProperty property, int32 minValue, int32 maxValue)
+{
+    const auto* prop = ScriptHelpers::GetIntConvertibleEntityProperty<Item>(self->GetEngine(), property);
+
+    vector<Item*> result;
+
+    if (auto* index = self->GetEngine()->EntityMngr.GetPropertyIndex(prop); index != nullptr && index->GetType() == EntityIndexType::Sorted) {
+        index->ForEachInRange(minValue, maxValue, [&](ServerEntity* entity) {
+            auto* item = static_cast<Item*>(entity);
+
+            if (item->GetOwnership() == ItemOwnership::MapHex && item->GetMapId() == self->GetId()) {
+                result.emplace_back(item);
+            }
+        });
+
+        return result;
+    }
+
+    for (auto& item : self->GetItems()) {
+        const auto value = item->GetValueAsInt(prop);
+
+        if (value >= minValue && value <= maxValue) {
+            result.emplace_back(item.get());
+        }
+    }
+
+    return result;
+}
+
 ///@ ExportMethod
 FO_SCRIPT_API vector<Item*> Server_Map_GetItems(Map* self, mpos hex, ItemComponent component)
 {
@@ -403,6 +450,18 @@ FO_SCRIPT_API vector<Item*> Server_Map_GetItems(Map* self, mpos hex, int32 radiu
     return items;
 }
 
+///@ ExportMethod PassOwnership
+FO_SCRIPT_API ItemRange* Server_Map_QueryItems(Map* self)
+{
+    auto range = SafeAlloc::MakeRefCounted<ItemRange>();
+
+    range->SourceMap = self;
+    range->State.SetSourceRevision(self->GetItemsRevision());
+
+    range->AddRef();
+    return range.get();
+}
+
 ///@ ExportMethod
 FO_SCRIPT_API StaticItem* Server_Map_GetStaticItem(Map* self, ident_t id)
 {
@@ -616,6 +675,22 @@ FO_SCRIPT_API Critter* Server_Map_GetCritter(Map* self, CritterProperty property
     const auto* prop = ScriptHelpers::GetIntConvertibleEntityProperty<Critter>(self->GetEngine(), property);
     const auto map_critters = self->GetCritters();
 
+    if (auto* index = self->GetEngine()->EntityMngr.GetPropertyIndex(prop); index != nullptr) {
+        const auto indexed_critters = index->Find(propertyValue);
+
+        if (indexed_critters.size() < map_critters.size()) {
+            for (auto& entity : indexed_critters) {
+                auto* cr = static_cast<Critter*>(entity.get());
+
+                if (cr->GetMapId() == self->GetId() && cr->CheckFind(findType)) {
+                    return cr;
+                }
+            }
+
+            return nullptr;
+        }
+    }
+
     for (auto& cr : map_critters) {
         if (cr->CheckFind(findType) && cr->GetValueAsInt(prop) == propertyValue) {
             return cr.get();
@@ -726,6 +801,22 @@ FO_SCRIPT_API vector<Critter*> Server_Map_GetCritters(Map* self, CritterProperty
     const auto map_critters = self->GetCritters();
     vector<Critter*> critters;
 
+    if (auto* index = self->GetEngine()->EntityMngr.GetPropertyIndex(prop); index != nullptr) {
+        const auto indexed_critters = index->Find(propertyValue);
+
+        if (indexed_critters.size() < map_critters.size()) {
+            for (auto& entity : indexed_critters) {
+                auto* cr = static_cast<Critter*>(entity.get());
+
+                if (cr->GetMapId() == self->GetId() && cr->CheckFind(findType)) {
+                    critters.emplace_back(cr);
+                }
+            }
+
+            return critters;
+        }
+    }
+
     critters.reserve(map_critters.size());
 
     for (auto& cr : map_critters) {
@@ -737,6 +828,19 @@ FO_SCRIPT_API vector<Critter*> Server_Map_GetCritters(Map* self, CritterProperty
     return critters;
 }
 
+///@ ExportMethod PassOwnership
+FO_SCRIPT_API CritterRange* Server_Map_QueryCritters(Map* self, CritterFindType findType)
+{
+    auto range = SafeAlloc::MakeRefCounted<CritterRange>();
+
+    range->SourceMap = self;
+    range->State.SetSourceRevision(self->GetCrittersRevision());
+    range->FindType = findType;
+
+    range->AddRef();
+    return range.get();
+}
+
 ///@ ExportMethod
 FO_SCRIPT_API vector<Critter*> Server_Map_GetCrittersInPath(Map* self, mpos fromHex, mpos toHex, float32 angle, int32 dist, CritterFindType findType)
 {
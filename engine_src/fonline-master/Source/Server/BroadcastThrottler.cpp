@@ -0,0 +1,187 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "BroadcastThrottler.h"
+
+FO_BEGIN_NAMESPACE();
+
+auto BroadcastThrottler::GetPeriodForDistance(span<const int32> distances, span<const int32> periods, int32 dist) noexcept -> timespan
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    int32 period = 0;
+
+    for (size_t i = 0; i < distances.size() && i < periods.size(); i++) {
+        if (dist >= distances[i]) {
+            period = periods[i];
+        }
+    }
+
+    return std::chrono::milliseconds {period};
+}
+
+void BroadcastThrottler::ValidateSettings(span<const int32> distances, span<const int32> periods)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (distances.size() != periods.size()) {
+        throw BroadcastThrottlerException("Broadcast throttle distances and periods must have same length", distances.size(), periods.size());
+    }
+
+    for (size_t i = 0; i < distances.size(); i++) {
+        if (distances[i] < 0 || periods[i] < 0) {
+            throw BroadcastThrottlerException("Broadcast throttle distances and periods must not be negative", i, distances[i], periods[i]);
+        }
+        if (i != 0 && distances[i] <= distances[i - 1]) {
+            throw BroadcastThrottlerException("Broadcast throttle distances must be ascending", i, distances[i - 1], distances[i]);
+        }
+    }
+}
+
+auto BroadcastThrottler::GetPendingCount() const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    size_t count = 0;
+
+    for (const auto& entry : _entries | std::views::values) {
+        count += numeric_cast<size_t>(std::ranges::count_if(entry.Slots, [](const SlotState& slot_state) { return slot_state.Pending; }));
+    }
+
+    return count;
+}
+
+auto BroadcastThrottler::IsPending(ident_t entity_id, uint32 slot) const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto it = _entries.find(entity_id);
+
+    if (it == _entries.end()) {
+        return false;
+    }
+
+    const auto slot_it = std::ranges::find(it->second.Slots, slot, &SlotState::Slot);
+    return slot_it != it->second.Slots.end() && slot_it->Pending;
+}
+
+auto BroadcastThrottler::Push(ident_t entity_id, uint32 slot, nanotime time, timespan period) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto& entry = _entries[entity_id];
+    const auto slot_it = std::ranges::find(entry.Slots, slot, &SlotState::Slot);
+
+    if (slot_it == entry.Slots.end()) {
+        entry.Slots.emplace_back(SlotState {.Slot = slot, .WindowStart = time, .Period = period});
+        return true;
+    }
+
+    auto& slot_state = *slot_it;
+
+    // Start new window and send immediately
+    if (time == slot_state.WindowStart || time - slot_state.WindowStart >= period) {
+        slot_state.WindowStart = time;
+        slot_state.Period = period;
+        slot_state.Pending = false;
+        return true;
+    }
+
+    // Coalesce with previous updates, latest state will be sent on flush
+    if (!slot_state.Pending) {
+        slot_state.FlushTime = slot_state.WindowStart + std::min(slot_state.Period, period);
+        slot_state.Pending = true;
+    }
+    else {
+        slot_state.FlushTime = std::min(slot_state.FlushTime, slot_state.WindowStart + period);
+    }
+
+    return false;
+}
+
+void BroadcastThrottler::Flush(nanotime time, const function<void(ident_t, uint32)>& callback)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(_flushBuf.empty());
+
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        auto& slots = it->second.Slots;
+
+        for (auto& slot_state : slots) {
+            if (slot_state.Pending && time >= slot_state.FlushTime) {
+                _flushBuf.emplace_back(it->first, slot_state.Slot);
+                slot_state.Pending = false;
+                slot_state.WindowStart = time;
+            }
+        }
+
+        std::erase_if(slots, [time](const SlotState& slot_state) { return !slot_state.Pending && time - slot_state.WindowStart >= slot_state.Period; });
+
+        if (slots.empty()) {
+            it = _entries.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    if (!_flushBuf.empty()) {
+        auto flush_buf = std::move(_flushBuf);
+        _flushBuf.clear();
+
+        for (const auto& [entity_id, slot] : flush_buf) {
+            callback(entity_id, slot);
+        }
+
+        flush_buf.clear();
+        _flushBuf = std::move(flush_buf);
+    }
+}
+
+void BroadcastThrottler::Cancel(ident_t entity_id) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    _entries.erase(entity_id);
+}
+
+void BroadcastThrottler::Clear() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    _entries.clear();
+    _flushBuf.clear();
+}
+
+FO_END_NAMESPACE();
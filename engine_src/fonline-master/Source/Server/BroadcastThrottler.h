@@ -0,0 +1,86 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+FO_DECLARE_EXCEPTION(BroadcastThrottlerException);
+
+// Rate limiter for state-like updates sent from many entities to one receiver
+// Updates are identified by entity id and slot, each slot has own window so throttled slot never delays other ones
+// Pending slot updates are coalesced and only latest state is sent on flush
+class BroadcastThrottler
+{
+public:
+    BroadcastThrottler() = default;
+    BroadcastThrottler(const BroadcastThrottler&) = delete;
+    BroadcastThrottler(BroadcastThrottler&&) noexcept = default;
+    auto operator=(const BroadcastThrottler&) = delete;
+    auto operator=(BroadcastThrottler&&) noexcept -> BroadcastThrottler& = default;
+    ~BroadcastThrottler() = default;
+
+    [[nodiscard]] static auto GetPeriodForDistance(span<const int32> distances, span<const int32> periods, int32 dist) noexcept -> timespan;
+    static void ValidateSettings(span<const int32> distances, span<const int32> periods);
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return _entries.empty(); }
+    [[nodiscard]] auto GetPendingCount() const noexcept -> size_t;
+    [[nodiscard]] auto IsPending(ident_t entity_id, uint32 slot) const noexcept -> bool;
+
+    auto Push(ident_t entity_id, uint32 slot, nanotime time, timespan period) -> bool;
+    void Flush(nanotime time, const function<void(ident_t, uint32)>& callback);
+    void Cancel(ident_t entity_id) noexcept;
+    void Clear() noexcept;
+
+private:
+    struct SlotState
+    {
+        uint32 Slot {};
+        nanotime WindowStart {};
+        nanotime FlushTime {};
+        timespan Period {};
+        bool Pending {};
+    };
+
+    struct Entry
+    {
+        vector<SlotState> Slots {};
+    };
+
+    unordered_map<ident_t, Entry> _entries {};
+    vector<pair<ident_t, uint32>> _flushBuf {};
+};
+
+FO_END_NAMESPACE();
@@ -152,8 +152,8 @@ void Critter::ClearMove()
     FO_STACK_TRACE_ENTRY();
 
     Moving.Uid++;
-    Moving.Steps = {};
-    Moving.ControlSteps = {};
+    Moving.Steps.clear();
+    Moving.ControlSteps.clear();
     Moving.StartTime = {};
     Moving.OffsetTime = {};
     Moving.Speed = {};
@@ -285,7 +285,12 @@ void Critter::MoveAttachedCritters()
             continue;
         }
 
-        _engine->MapMngr.ProcessVisibleItems(cr);
+        if (_engine->Settings.ServerTickBudget > 0) {
+            _engine->MapMngr.ScheduleVisibleItems(cr);
+        }
+        else {
+            _engine->MapMngr.ProcessVisibleItems(cr);
+        }
     }
 }
 
@@ -421,6 +426,20 @@ auto Critter::GetCritters(CritterSeeType see_type, CritterFindType find_type) ->
     return critters;
 }
 
+auto Critter::GetBroadcastThrottlePeriod(const Critter* observer) const -> timespan
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto& throttle_distances = _engine->Settings.BroadcastThrottleDistances;
+
+    if (throttle_distances.empty() || observer->GetPlayer() == nullptr) {
+        return timespan::zero;
+    }
+
+    const auto dist = GeometryHelper::GetDistance(GetHex(), observer->GetHex());
+    return BroadcastThrottler::GetPeriodForDistance(throttle_distances, _engine->Settings.BroadcastThrottlePeriods, dist);
+}
+
 auto Critter::GetGlobalMapGroup() -> span<raw_ptr<Critter>>
 {
     FO_STACK_TRACE_ENTRY();
@@ -579,6 +598,7 @@ void Critter::SetItem(Item* item)
     FO_RUNTIME_ASSERT(item);
 
     vec_add_unique_value(_invItems, item);
+    _invItemsByPid.Add(item);
 }
 
 void Critter::RemoveItem(Item* item)
@@ -588,6 +608,7 @@ void Critter::RemoveItem(Item* item)
     FO_RUNTIME_ASSERT(item);
 
     vec_remove_unique_value(_invItems, item);
+    _invItemsByPid.Remove(item);
 }
 
 auto Critter::GetInvItem(ident_t item_id) noexcept -> Item*
@@ -611,13 +632,8 @@ auto Critter::GetInvItemByPid(hstring item_pid) noexcept -> Item*
 
     FO_NON_CONST_METHOD_HINT();
 
-    for (auto& item : _invItems) {
-        if (item->GetProtoId() == item_pid) {
-            return item.get();
-        }
-    }
-
-    return nullptr;
+    const auto pid_items = _invItemsByPid.Get(item_pid);
+    return !pid_items.empty() ? *pid_items.begin() : nullptr;
 }
 
 auto Critter::GetInvItemBySlot(CritterItemSlot slot) noexcept -> Item*
@@ -641,10 +657,8 @@ auto Critter::CountInvItemByPid(hstring pid) const noexcept -> int32
 
     int32 count = 0;
 
-    for (const auto& item : _invItems) {
-        if (item->GetProtoId() == pid) {
-            count += item->GetCount();
-        }
+    for (const auto* item : _invItemsByPid.Get(pid)) {
+        count += item->GetCount();
     }
 
     return count;
@@ -657,7 +671,12 @@ void Critter::Broadcast_Property(NetProperty type, const Property* prop, const S
     FO_NON_CONST_METHOD_HINT();
 
     for (auto& cr : _visibleCrWhoSeeMe) {
-        cr->Send_Property(type, prop, entity);
+        if (const auto period = type == NetProperty::Critter ? GetBroadcastThrottlePeriod(cr.get()) : timespan::zero) {
+            cr->GetPlayer()->Send_ThrottledProperty(this, prop, period);
+        }
+        else {
+            cr->Send_Property(type, prop, entity);
+        }
     }
 }
 
@@ -679,7 +698,12 @@ void Critter::Broadcast_Dir()
     FO_NON_CONST_METHOD_HINT();
 
     for (auto& cr : _visibleCrWhoSeeMe) {
-        cr->Send_Dir(this);
+        if (const auto period = GetBroadcastThrottlePeriod(cr.get())) {
+            cr->GetPlayer()->Send_ThrottledDir(this, period);
+        }
+        else {
+            cr->Send_Dir(this);
+        }
     }
 }
 
@@ -709,14 +733,64 @@ void Critter::SendAndBroadcast(const Player* ignore_player, const function<void(
     }
 }
 
-void Critter::SendAndBroadcast_Moving()
+void Critter::SendAndBroadcast_Moving(const Player* ignore_player)
 {
     FO_STACK_TRACE_ENTRY();
 
-    Send_Moving(this);
+    if (ignore_player == nullptr || ignore_player != GetPlayer()) {
+        Send_Moving(this);
+    }
 
     for (auto& cr : _visibleCrWhoSeeMe) {
-        cr->Send_Moving(this);
+        if (ignore_player != nullptr && ignore_player == cr->GetPlayer()) {
+            continue;
+        }
+
+        if (const auto period = GetBroadcastThrottlePeriod(cr.get())) {
+            cr->GetPlayer()->Send_ThrottledMoving(this, period);
+        }
+        else {
+            cr->Send_Moving(this);
+        }
+    }
+}
+
+void Critter::SendAndBroadcast_MovingSpeed()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    Send_MovingSpeed(this);
+
+    for (auto& cr : _visibleCrWhoSeeMe) {
+        // Full moving state includes speed, so far observers receive coalesced moving instead
+        if (const auto period = GetBroadcastThrottlePeriod(cr.get())) {
+            cr->GetPlayer()->Send_ThrottledMoving(this, period);
+        }
+        else {
+            cr->Send_MovingSpeed(this);
+        }
+    }
+}
+
+void Critter::SendAndBroadcast_Dir(const Player* ignore_player)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (ignore_player == nullptr || ignore_player != GetPlayer()) {
+        Send_Dir(this);
+    }
+
+    for (auto& cr : _visibleCrWhoSeeMe) {
+        if (ignore_player != nullptr && ignore_player == cr->GetPlayer()) {
+            continue;
+        }
+
+        if (const auto period = GetBroadcastThrottlePeriod(cr.get())) {
+            cr->GetPlayer()->Send_ThrottledDir(this, period);
+        }
+        else {
+            cr->Send_Dir(this);
+        }
     }
 }
 
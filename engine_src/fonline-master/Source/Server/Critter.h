@@ -37,7 +37,9 @@
 
 #include "EntityProperties.h"
 #include "EntityProtos.h"
+#include "EntityProtoRegistry.h"
 #include "Geometry.h"
+#include "Item.h"
 #include "ServerEntity.h"
 
 FO_BEGIN_NAMESPACE();
@@ -67,7 +69,7 @@ enum class MovingState : uint8
     Attached = 13,
 };
 
-class Critter final : public ServerEntity, public EntityWithProto, public CritterProperties
+class Critter final : public ServerEntity, public EntityWithProto, public CritterProperties, public PooledAllocation<Critter>
 {
 public:
     Critter() = delete;
@@ -89,11 +91,12 @@ public:
     [[nodiscard]] auto GetInvItem(ident_t item_id) noexcept -> Item*;
     [[nodiscard]] auto GetInvItems() noexcept -> span<raw_ptr<Item>> { return _invItems; }
     [[nodiscard]] auto GetInvItems() const noexcept -> span<const raw_ptr<Item>> { return _invItems; }
+    [[nodiscard]] auto GetInvItemsByPid(hstring item_pid) noexcept -> EntityProtoRegistry<Item, &Item::InvProtoHook>::group_range { return _invItemsByPid.Get(item_pid); }
     [[nodiscard]] auto GetInvItemByPid(hstring item_pid) noexcept -> Item*;
     [[nodiscard]] auto GetInvItemBySlot(CritterItemSlot slot) noexcept -> Item*;
     [[nodiscard]] auto CountInvItemByPid(hstring item_pid) const noexcept -> int32;
     [[nodiscard]] auto HasItems() const noexcept -> bool { return !_invItems.empty(); }
-    [[nodiscard]] auto GetVisibleItems() const noexcept -> const unordered_set<ident_t>& { return _visibleItems; }
+    [[nodiscard]] auto GetVisibleItems() const noexcept -> const tagged_unordered_set<ident_t, MemoryCategory::Visibility>& { return _visibleItems; }
     [[nodiscard]] auto IsSeeItem(ident_t item_id) const noexcept -> bool { return _visibleItems.contains(item_id); }
     [[nodiscard]] auto IsSeeCritter(ident_t cr_id) const -> bool;
     [[nodiscard]] auto GetCritter(ident_t cr_id, CritterSeeType see_type) -> Critter*;
@@ -101,6 +104,7 @@ public:
     [[nodiscard]] auto GetGlobalMapGroup() -> span<raw_ptr<Critter>>;
     [[nodiscard]] auto GetRawGlobalMapGroup() -> auto& { return _globalMapGroup; }
     [[nodiscard]] auto IsMoving() const noexcept -> bool { return !Moving.Steps.empty(); }
+    [[nodiscard]] auto GetBroadcastThrottlePeriod(const Critter* observer) const -> timespan;
 
     auto AddVisibleCritter(Critter* cr) -> bool;
     auto RemoveVisibleCritter(Critter* cr) -> bool;
@@ -133,7 +137,9 @@ public:
     void Broadcast_Teleport(mpos to_hex);
 
     void SendAndBroadcast(const Player* ignore_player, const function<void(Critter*)>& callback);
-    void SendAndBroadcast_Moving();
+    void SendAndBroadcast_Moving(const Player* ignore_player = nullptr);
+    void SendAndBroadcast_MovingSpeed();
+    void SendAndBroadcast_Dir(const Player* ignore_player);
     void SendAndBroadcast_Action(CritterAction action, int32 action_data, const Item* context_item);
     void SendAndBroadcast_MoveItem(const Item* item, CritterAction action, CritterItemSlot prev_slot);
     void SendAndBroadcast_Attachments();
@@ -214,8 +220,8 @@ public:
     {
         uint32 Uid {};
         uint16 Speed {};
-        vector<uint8> Steps {};
-        vector<uint16> ControlSteps {};
+        small_vector<uint8, 32> Steps {};
+        small_vector<uint16, 4> ControlSteps {};
         nanotime StartTime {};
         timespan OffsetTime {};
         mpos StartHex {};
@@ -232,14 +238,15 @@ private:
     refcount_ptr<Player> _player {};
     nanotime _playerDetachTime {};
     vector<raw_ptr<Item>> _invItems {};
-    vector<raw_ptr<Critter>> _visibleCrWhoSeeMe {};
-    vector<raw_ptr<Critter>> _visibleCr {};
-    unordered_map<ident_t, raw_ptr<Critter>> _visibleCrWhoSeeMeMap {};
-    unordered_map<ident_t, raw_ptr<Critter>> _visibleCrMap {};
-    unordered_set<ident_t> _visibleCrGroup1 {};
-    unordered_set<ident_t> _visibleCrGroup2 {};
-    unordered_set<ident_t> _visibleCrGroup3 {};
-    unordered_set<ident_t> _visibleItems {};
+    EntityProtoRegistry<Item, &Item::InvProtoHook> _invItemsByPid {};
+    tagged_vector<raw_ptr<Critter>, MemoryCategory::Visibility> _visibleCrWhoSeeMe {};
+    tagged_vector<raw_ptr<Critter>, MemoryCategory::Visibility> _visibleCr {};
+    tagged_unordered_map<ident_t, raw_ptr<Critter>, MemoryCategory::Visibility> _visibleCrWhoSeeMeMap {};
+    tagged_unordered_map<ident_t, raw_ptr<Critter>, MemoryCategory::Visibility> _visibleCrMap {};
+    tagged_unordered_set<ident_t, MemoryCategory::Visibility> _visibleCrGroup1 {};
+    tagged_unordered_set<ident_t, MemoryCategory::Visibility> _visibleCrGroup2 {};
+    tagged_unordered_set<ident_t, MemoryCategory::Visibility> _visibleCrGroup3 {};
+    tagged_unordered_set<ident_t, MemoryCategory::Visibility> _visibleItems {};
     shared_ptr<vector<raw_ptr<Critter>>> _globalMapGroup {};
 };
 
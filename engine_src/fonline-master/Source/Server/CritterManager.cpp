@@ -251,7 +251,7 @@ void CritterManager::DestroyCritter(Critter* cr)
     cr->MarkAsDestroyed();
 
     // Erase from main collection
-    _engine->EntityMngr.UnregisterCritter(cr);
+    _engine->EntityMngr.UnregisterCritter(cr, !cr->GetControlledByPlayer());
 }
 
 void CritterManager::DestroyInventory(Critter* cr)
@@ -272,9 +272,9 @@ auto CritterManager::GetNonPlayerCritters() -> vector<Critter*>
     vector<Critter*> non_player_critters;
     non_player_critters.reserve(all_critters.size());
 
-    for (auto& cr : all_critters | std::views::values) {
+    for (auto* cr : all_critters.iterate()) {
         if (!cr->GetControlledByPlayer()) {
-            non_player_critters.emplace_back(cr.get());
+            non_player_critters.emplace_back(cr);
         }
     }
 
@@ -290,9 +290,9 @@ auto CritterManager::GetPlayerCritters(bool on_global_map_only) -> vector<Critte
     vector<Critter*> player_critters;
     player_critters.reserve(all_critters.size());
 
-    for (auto& cr : all_critters | std::views::values) {
+    for (auto* cr : all_critters.iterate()) {
         if (cr->GetControlledByPlayer() && (!on_global_map_only || !cr->GetMapId())) {
-            player_critters.emplace_back(cr.get());
+            player_critters.emplace_back(cr);
         }
     }
 
@@ -308,9 +308,9 @@ auto CritterManager::GetGlobalMapCritters(CritterFindType find_type) -> vector<C
     vector<Critter*> critters;
     critters.reserve(all_critters.size());
 
-    for (auto& cr : all_critters | std::views::values) {
+    for (auto* cr : all_critters.iterate()) {
         if (!cr->GetMapId() && cr->CheckFind(find_type)) {
-            critters.emplace_back(cr.get());
+            critters.emplace_back(cr);
         }
     }
 
@@ -323,30 +323,28 @@ auto CritterManager::GetItemByPidInvPriority(Critter* cr, hstring item_pid) -> I
 
     const auto* proto = _engine->ProtoMngr.GetProtoItem(item_pid);
 
+    const auto pid_items = cr->GetInvItemsByPid(item_pid);
+
+    if (pid_items.empty()) {
+        return nullptr;
+    }
+
     if (proto->GetStackable()) {
-        for (auto& item : cr->GetInvItems()) {
-            if (item->GetProtoId() == item_pid) {
-                return item.get();
-            }
-        }
+        return *pid_items.begin();
     }
     else {
         Item* another_slot = nullptr;
 
-        for (auto& item : cr->GetInvItems()) {
-            if (item->GetProtoId() == item_pid) {
-                if (item->GetCritterSlot() == CritterItemSlot::Inventory) {
-                    return item.get();
-                }
-
-                another_slot = item.get();
+        for (auto* item : pid_items) {
+            if (item->GetCritterSlot() == CritterItemSlot::Inventory) {
+                return item;
             }
+
+            another_slot = item;
         }
 
         return another_slot;
     }
-
-    return nullptr;
 }
 
 FO_END_NAMESPACE();
@@ -51,6 +51,34 @@ FO_DISABLE_WARNINGS_POP()
 
 FO_BEGIN_NAMESPACE();
 
+// Rough heap footprint of pending value, used only for memory accounting
+static auto EstimateValueSize(string_view key, const AnyData::Value& value) noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    auto size = sizeof(string) + key.length() + sizeof(AnyData::Value);
+
+    switch (value.Type()) {
+    case AnyData::ValueType::String:
+        size += value.AsString().length();
+        break;
+    case AnyData::ValueType::Array:
+        for (const auto& arr_value : value.AsArray()) {
+            size += EstimateValueSize({}, arr_value);
+        }
+        break;
+    case AnyData::ValueType::Dict:
+        for (auto&& [dict_key, dict_value] : value.AsDict()) {
+            size += EstimateValueSize(dict_key, dict_value);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
 class DataBaseImpl
 {
 public:
@@ -64,6 +92,7 @@ public:
     [[nodiscard]] auto GetCommitJobsCount() const -> size_t;
     [[nodiscard]] virtual auto GetAllRecordIds(hstring collection_name) const -> vector<ident_t> = 0;
     [[nodiscard]] auto GetDocument(hstring collection_name, ident_t id) const -> AnyData::Document;
+    [[nodiscard]] auto GetPrefetchCount() const -> size_t { return _prefetches.size(); }
 
     void Insert(hstring collection_name, ident_t id, const AnyData::Document& doc);
     void Update(hstring collection_name, ident_t id, string_view key, const AnyData::Value& value);
@@ -71,6 +100,9 @@ public:
     void CommitChanges();
     void ClearChanges() noexcept;
     void WaitCommitThread() const;
+    auto Prefetch(hstring collection_name, ident_t id) -> size_t;
+    auto TakePrefetched(size_t prefetch_id) -> optional<AnyData::Document>;
+    void CancelPrefetch(size_t prefetch_id) noexcept;
 
 protected:
     [[nodiscard]] virtual auto GetRecord(hstring collection_name, ident_t id) const -> AnyData::Document = 0;
@@ -87,11 +119,31 @@ private:
         DataBase::Collections RecordChanges {};
         DataBase::RecordsState NewRecords {};
         DataBase::RecordsState DeletedRecords {};
+        TaggedMemorySize<MemoryCategory::DataBase> ChangesSize {};
+    };
+
+    struct PrefetchData
+    {
+        hstring CollectionName {};
+        ident_t Id {};
+        size_t CommitIndex {};
+        AnyData::Document Doc {};
+        bool Failed {};
+        std::atomic_bool Ready {};
     };
 
+    static void ApplyCommitedChanges(const CommitJobData& commit_data, hstring collection_name, ident_t id, AnyData::Document& doc);
+    void ApplyPendingChanges(hstring collection_name, ident_t id, AnyData::Document& doc) const;
+    void TrimPrefetchCommits() noexcept;
+
     DataBase::Collections _recordChanges {};
     DataBase::RecordsState _newRecords {};
     DataBase::RecordsState _deletedRecords {};
+    TaggedMemorySize<MemoryCategory::DataBase> _changesSize {};
+    size_t _commitIndex {};
+    size_t _prefetchIdCounter {};
+    unordered_map<size_t, shared_ptr<PrefetchData>> _prefetches {};
+    deque<pair<size_t, shared_ptr<CommitJobData>>> _prefetchCommits {};
     WorkThread _commitThread {"DataBaseCommiter"};
 };
 
@@ -141,6 +193,34 @@ auto DataBase::Valid(hstring collection_name, ident_t id) const -> bool
     return !_impl->GetDocument(collection_name, id).Empty();
 }
 
+auto DataBase::GetPrefetchCount() const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return _impl->GetPrefetchCount();
+}
+
+auto DataBase::Prefetch(hstring collection_name, ident_t id) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return _impl->Prefetch(collection_name, id);
+}
+
+auto DataBase::TakePrefetched(size_t prefetch_id) -> optional<AnyData::Document>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return _impl->TakePrefetched(prefetch_id);
+}
+
+void DataBase::CancelPrefetch(size_t prefetch_id) noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _impl->CancelPrefetch(prefetch_id);
+}
+
 void DataBase::Insert(hstring collection_name, ident_t id, const AnyData::Document& doc)
 {
     FO_STACK_TRACE_ENTRY();
@@ -370,6 +450,15 @@ auto DataBaseImpl::GetDocument(hstring collection_name, ident_t id) const -> Any
 
     auto doc = GetRecord(collection_name, id);
 
+    ApplyPendingChanges(collection_name, id, doc);
+
+    return doc;
+}
+
+void DataBaseImpl::ApplyPendingChanges(hstring collection_name, ident_t id, AnyData::Document& doc) const
+{
+    FO_STACK_TRACE_ENTRY();
+
     if (_recordChanges.count(collection_name) != 0 && _recordChanges.at(collection_name).count(id) != 0) {
         const auto& changes_doc = _recordChanges.at(collection_name).at(id);
 
@@ -377,10 +466,140 @@ auto DataBaseImpl::GetDocument(hstring collection_name, ident_t id) const -> Any
             doc.Assign(changes_doc_key, changes_doc_value.Copy());
         }
     }
+}
+
+void DataBaseImpl::ApplyCommitedChanges(const CommitJobData& commit_data, hstring collection_name, ident_t id, AnyData::Document& doc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Same order as in commit job, inserts and updates first, then deletes
+    if (const auto it = commit_data.RecordChanges.find(collection_name); it != commit_data.RecordChanges.end()) {
+        if (const auto it2 = it->second.find(id); it2 != it->second.end()) {
+            const auto new_it = commit_data.NewRecords.find(collection_name);
+
+            if (new_it != commit_data.NewRecords.end() && new_it->second.count(id) != 0) {
+                doc = it2->second.Copy();
+            }
+            else {
+                for (auto&& [changes_doc_key, changes_doc_value] : it2->second) {
+                    doc.Assign(changes_doc_key, changes_doc_value.Copy());
+                }
+            }
+        }
+    }
+
+    if (const auto it = commit_data.DeletedRecords.find(collection_name); it != commit_data.DeletedRecords.end() && it->second.count(id) != 0) {
+        doc = {};
+    }
+}
+
+auto DataBaseImpl::Prefetch(hstring collection_name, ident_t id) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto prefetch = SafeAlloc::MakeShared<PrefetchData>();
+    prefetch->CollectionName = collection_name;
+    prefetch->Id = id;
+    prefetch->CommitIndex = _commitIndex;
+
+    const auto prefetch_id = ++_prefetchIdCounter;
+    _prefetches.emplace(prefetch_id, prefetch);
+
+    // Runs after all already scheduled commits
+    _commitThread.AddJob([this, prefetch_ = std::move(prefetch)]() mutable {
+        FO_STACK_TRACE_ENTRY_NAMED("PrefetchJob");
+
+        try {
+            prefetch_->Doc = GetRecord(prefetch_->CollectionName, prefetch_->Id);
+        }
+        catch (const std::exception& ex) {
+            ReportExceptionAndContinue(ex);
+            prefetch_->Failed = true;
+        }
+
+        prefetch_->Ready = true;
+
+        return std::nullopt;
+    });
+
+    return prefetch_id;
+}
+
+auto DataBaseImpl::TakePrefetched(size_t prefetch_id) -> optional<AnyData::Document>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = _prefetches.find(prefetch_id);
+    FO_RUNTIME_ASSERT(it != _prefetches.end());
+
+    auto prefetch = it->second;
+
+    if (!prefetch->Ready) {
+        return std::nullopt;
+    }
+
+    _prefetches.erase(it);
+
+    AnyData::Document doc;
+
+    if (prefetch->Failed) {
+        doc = GetDocument(prefetch->CollectionName, prefetch->Id);
+    }
+    else {
+        doc = std::move(prefetch->Doc);
+
+        // Commits scheduled after prefetch request are not visible in fetched record
+        for (auto&& [commit_index, commit_data] : _prefetchCommits) {
+            if (commit_index > prefetch->CommitIndex) {
+                ApplyCommitedChanges(*commit_data, prefetch->CollectionName, prefetch->Id, doc);
+            }
+        }
+
+        if (_deletedRecords.count(prefetch->CollectionName) != 0 && _deletedRecords.at(prefetch->CollectionName).count(prefetch->Id) != 0) {
+            doc = {};
+        }
+        else if (_newRecords.count(prefetch->CollectionName) != 0 && _newRecords.at(prefetch->CollectionName).count(prefetch->Id) != 0) {
+            doc = _recordChanges.at(prefetch->CollectionName).at(prefetch->Id).Copy();
+        }
+        else {
+            ApplyPendingChanges(prefetch->CollectionName, prefetch->Id, doc);
+        }
+    }
+
+    TrimPrefetchCommits();
 
     return doc;
 }
 
+void DataBaseImpl::CancelPrefetch(size_t prefetch_id) noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _prefetches.erase(prefetch_id);
+
+    TrimPrefetchCommits();
+}
+
+void DataBaseImpl::TrimPrefetchCommits() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_prefetches.empty()) {
+        _prefetchCommits.clear();
+        return;
+    }
+
+    size_t min_commit_index = std::numeric_limits<size_t>::max();
+
+    for (const auto& prefetch : _prefetches | std::views::values) {
+        min_commit_index = std::min(min_commit_index, prefetch->CommitIndex);
+    }
+
+    while (!_prefetchCommits.empty() && _prefetchCommits.front().first <= min_commit_index) {
+        _prefetchCommits.pop_front();
+    }
+}
+
 void DataBaseImpl::Insert(hstring collection_name, ident_t id, const AnyData::Document& doc)
 {
     FO_STACK_TRACE_ENTRY();
@@ -394,6 +613,7 @@ void DataBaseImpl::Insert(hstring collection_name, ident_t id, const AnyData::Do
 
     for (auto&& [doc_key, doc_value] : doc) {
         record_changes.Assign(doc_key, doc_value.Copy());
+        _changesSize.Add(EstimateValueSize(doc_key, doc_value));
     }
 }
 
@@ -404,6 +624,7 @@ void DataBaseImpl::Update(hstring collection_name, ident_t id, string_view key,
     FO_RUNTIME_ASSERT(!_deletedRecords[collection_name].count(id));
 
     _recordChanges[collection_name][id].Assign(string(key), value.Copy());
+    _changesSize.Add(EstimateValueSize(key, value));
 }
 
 void DataBaseImpl::Delete(hstring collection_name, ident_t id)
@@ -452,11 +673,18 @@ void DataBaseImpl::CommitChanges()
     job_data->RecordChanges = std::move(_recordChanges);
     job_data->NewRecords = std::move(_newRecords);
     job_data->DeletedRecords = std::move(_deletedRecords);
+    job_data->ChangesSize = std::move(_changesSize);
 
     _recordChanges.clear();
     _newRecords.clear();
     _deletedRecords.clear();
 
+    _commitIndex++;
+
+    if (!_prefetches.empty()) {
+        _prefetchCommits.emplace_back(_commitIndex, job_data);
+    }
+
     _commitThread.AddJob([this, job_data_ = job_data] {
         FO_STACK_TRACE_ENTRY_NAMED("CommitJob");
 
@@ -492,6 +720,7 @@ void DataBaseImpl::ClearChanges() noexcept
     _recordChanges.clear();
     _newRecords.clear();
     _deletedRecords.clear();
+    _changesSize.Set(0);
 }
 
 void DataBaseImpl::WaitCommitThread() const
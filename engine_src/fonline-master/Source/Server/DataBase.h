@@ -65,6 +65,7 @@ public:
     [[nodiscard]] auto GetAllIds(hstring collection_name) const -> vector<ident_t>;
     [[nodiscard]] auto Get(hstring collection_name, ident_t id) const -> AnyData::Document;
     [[nodiscard]] auto Valid(hstring collection_name, ident_t id) const -> bool;
+    [[nodiscard]] auto GetPrefetchCount() const -> size_t;
 
     void Insert(hstring collection_name, ident_t id, const AnyData::Document& doc);
     void Update(hstring collection_name, ident_t id, string_view key, const AnyData::Value& value);
@@ -72,6 +73,11 @@ public:
     void CommitChanges(bool wait_commit_complete);
     void ClearChanges() noexcept;
 
+    // Document read in commit thread, result is the same as Get at the moment of taking
+    auto Prefetch(hstring collection_name, ident_t id) -> size_t;
+    auto TakePrefetched(size_t prefetch_id) -> optional<AnyData::Document>;
+    void CancelPrefetch(size_t prefetch_id) noexcept;
+
 private:
     explicit DataBase(DataBaseImpl* impl);
 
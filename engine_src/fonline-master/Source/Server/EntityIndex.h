@@ -0,0 +1,210 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+enum class EntityIndexType : uint8
+{
+    Hash,
+    Sorted,
+};
+
+// Secondary index of entities by integer key
+// Hash index serves equality lookups, sorted one also serves range lookups
+// Entities with the same key are kept in insertion order (changing key moves entity to the end)
+// Removal leaves hole which is compacted on next lookup of that key
+template<typename T>
+class EntityIndex final
+{
+public:
+    struct Bucket
+    {
+        vector<raw_ptr<T>> Entities {};
+        size_t Holes {};
+    };
+
+    explicit EntityIndex(EntityIndexType type) noexcept :
+        _type {type}
+    {
+    }
+    EntityIndex(const EntityIndex&) = delete;
+    EntityIndex(EntityIndex&&) noexcept = default;
+    auto operator=(const EntityIndex&) = delete;
+    auto operator=(EntityIndex&&) noexcept -> EntityIndex& = default;
+    ~EntityIndex() = default;
+
+    [[nodiscard]] auto GetType() const noexcept -> EntityIndexType { return _type; }
+    [[nodiscard]] auto GetEntitiesCount() const noexcept -> size_t { return _entries.size(); }
+    [[nodiscard]] auto GetKeysCount() const noexcept -> size_t { return _type == EntityIndexType::Hash ? _hashBuckets.size() : _sortedBuckets.size(); }
+    [[nodiscard]] auto Contains(const T* entity) const noexcept -> bool { return _entries.count(entity) != 0; }
+
+    [[nodiscard]] auto Find(int64 key) noexcept -> span<raw_ptr<T>>
+    {
+        auto* bucket = FindBucket(key);
+
+        if (bucket == nullptr) {
+            return {};
+        }
+
+        CompactBucket(*bucket);
+        return bucket->Entities;
+    }
+
+    template<typename F>
+    void ForEachInRange(int64 min_key, int64 max_key, const F& callback)
+    {
+        FO_RUNTIME_ASSERT(_type == EntityIndexType::Sorted);
+
+        for (auto it = _sortedBuckets.lower_bound(min_key); it != _sortedBuckets.end() && it->first <= max_key; ++it) {
+            for (auto& entity : it->second.Entities) {
+                if (entity) {
+                    callback(entity.get());
+                }
+            }
+        }
+    }
+
+    void Set(T* entity, int64 key)
+    {
+        FO_RUNTIME_ASSERT(entity);
+
+        if (const auto it = _entries.find(entity); it != _entries.end()) {
+            if (it->second.Key == key) {
+                return;
+            }
+
+            EraseFromBucket(it->second);
+            _entries.erase(it);
+        }
+
+        auto& bucket = _type == EntityIndexType::Hash ? _hashBuckets[key] : _sortedBuckets[key];
+        bucket.Entities.emplace_back(entity);
+        _entries.emplace(entity, Entry {.Key = key, .Pos = bucket.Entities.size() - 1});
+    }
+
+    void Update(T* entity, int64 key)
+    {
+        if (Contains(entity)) {
+            Set(entity, key);
+        }
+    }
+
+    void Remove(const T* entity)
+    {
+        if (const auto it = _entries.find(entity); it != _entries.end()) {
+            EraseFromBucket(it->second);
+            _entries.erase(it);
+        }
+    }
+
+    void Clear() noexcept
+    {
+        _hashBuckets.clear();
+        _sortedBuckets.clear();
+        _entries.clear();
+    }
+
+private:
+    struct Entry
+    {
+        int64 Key {};
+        size_t Pos {};
+    };
+
+    [[nodiscard]] auto FindBucket(int64 key) noexcept -> Bucket*
+    {
+        if (_type == EntityIndexType::Hash) {
+            const auto it = _hashBuckets.find(key);
+            return it != _hashBuckets.end() ? &it->second : nullptr;
+        }
+        else {
+            const auto it = _sortedBuckets.find(key);
+            return it != _sortedBuckets.end() ? &it->second : nullptr;
+        }
+    }
+
+    void CompactBucket(Bucket& bucket)
+    {
+        if (bucket.Holes == 0) {
+            return;
+        }
+
+        size_t pos = 0;
+
+        for (auto& entity : bucket.Entities) {
+            if (entity) {
+                _entries.at(entity.get()).Pos = pos;
+                bucket.Entities[pos++] = entity;
+            }
+        }
+
+        bucket.Entities.resize(pos);
+        bucket.Holes = 0;
+    }
+
+    void EraseFromBucket(const Entry& entry)
+    {
+        auto* bucket = FindBucket(entry.Key);
+        FO_RUNTIME_ASSERT(bucket);
+        FO_RUNTIME_ASSERT(entry.Pos < bucket->Entities.size());
+
+        bucket->Entities[entry.Pos] = nullptr;
+        bucket->Holes++;
+
+        // Trailing holes are dropped right away
+        while (!bucket->Entities.empty() && !bucket->Entities.back()) {
+            bucket->Entities.pop_back();
+            bucket->Holes--;
+        }
+
+        if (bucket->Entities.empty()) {
+            if (_type == EntityIndexType::Hash) {
+                _hashBuckets.erase(entry.Key);
+            }
+            else {
+                _sortedBuckets.erase(entry.Key);
+            }
+        }
+    }
+
+    EntityIndexType _type;
+    unordered_map<int64, Bucket> _hashBuckets {};
+    map<int64, Bucket> _sortedBuckets {};
+    unordered_map<const T*, Entry> _entries {};
+};
+
+FO_END_NAMESPACE();
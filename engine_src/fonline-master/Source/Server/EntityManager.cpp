@@ -84,22 +84,14 @@ auto EntityManager::GetPlayer(ident_t id) const noexcept -> const Player*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (const auto it = _allPlayers.find(id); it != _allPlayers.end()) {
-        return it->second.get();
-    }
-
-    return nullptr;
+    return _allPlayers.find(id);
 }
 
 auto EntityManager::GetPlayer(ident_t id) noexcept -> Player*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (const auto it = _allPlayers.find(id); it != _allPlayers.end()) {
-        return it->second.get();
-    }
-
-    return nullptr;
+    return _allPlayers.find(id);
 }
 
 auto EntityManager::GetLocation(ident_t id) const noexcept -> const Location*
@@ -150,22 +142,14 @@ auto EntityManager::GetCritter(ident_t id) const noexcept -> const Critter*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (const auto it = _allCritters.find(id); it != _allCritters.end()) {
-        return it->second.get();
-    }
-
-    return nullptr;
+    return _allCritters.find(id);
 }
 
 auto EntityManager::GetCritter(ident_t id) noexcept -> Critter*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (const auto it = _allCritters.find(id); it != _allCritters.end()) {
-        return it->second.get();
-    }
-
-    return nullptr;
+    return _allCritters.find(id);
 }
 
 auto EntityManager::GetItem(ident_t id) const noexcept -> const Item*
@@ -226,7 +210,7 @@ void EntityManager::LoadEntities()
         }
     }
 
-    for (auto* cr : copy_hold_ref(_allCritters)) {
+    for (auto* cr : _allCritters.iterate()) {
         if (!cr->IsDestroyed()) {
             _engine->MapMngr.ProcessVisibleCritters(cr);
         }
@@ -832,6 +816,418 @@ void EntityManager::CallInit(Item* item, bool first_time)
     }
 }
 
+void EntityManager::ProcessPaging(timespan max_time)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto frame_time = _engine->GameTime.GetFrameTime();
+
+    if (_pagingCursor.IsPassFinished()) {
+        if (frame_time < _nextPagingPassTime) {
+            return;
+        }
+
+        _nextPagingPassTime = frame_time + std::chrono::milliseconds {_engine->Settings.WorldPagingCheckPeriod};
+
+        vector<ident_t> loc_ids;
+        loc_ids.reserve(_allLocations.size());
+
+        for (const auto loc_id : _allLocations | std::views::keys) {
+            loc_ids.emplace_back(loc_id);
+        }
+
+        _pagingCursor.StartPass(std::move(loc_ids), frame_time);
+    }
+
+    // Pass is spread over several ticks, slice ends when time budget is spent
+    const auto idle_time = timespan {std::chrono::seconds {_engine->Settings.WorldPagingIdleTime}};
+    const auto slice_time = TimeMeter();
+    size_t unloaded_count = 0;
+
+    while (!_pagingCursor.IsPassFinished() && slice_time.GetDuration() < max_time) {
+        const auto loc_id = _pagingCursor.TakeNext();
+        auto* loc = GetLocation(loc_id);
+
+        if (loc == nullptr || loc->IsDestroying()) {
+            continue;
+        }
+
+        if (!_pagingCursor.Update(loc_id, IsLocationIdle(loc), frame_time, idle_time)) {
+            continue;
+        }
+
+        try {
+            UnloadLocation(loc);
+            unloaded_count++;
+        }
+        catch (const std::exception& ex) {
+            ReportExceptionAndContinue(ex);
+        }
+        catch (...) {
+            FO_UNKNOWN_EXCEPTION();
+        }
+    }
+
+    // Persist unloaded entities right away, reload reads pending changes anyway
+    if (unloaded_count != 0) {
+        _engine->DbStorage.CommitChanges(false);
+    }
+}
+
+auto EntityManager::IsLocationIdle(Location* loc) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto expand = [this](Entity* entity, vector<pair<Entity*, int32>>& pending) -> bool {
+        // Property index lookups can't see paged out entities
+        if (_indexedProperties.count(entity->GetTypeName()) != 0) {
+            return false;
+        }
+        // Suspended coroutines bound to entity are scheduled work same as time events
+        if (_engine->ScriptSys.HasBoundWaits(entity)) {
+            return false;
+        }
+
+        if (entity->HasInnerEntities()) {
+            for (auto& entities : entity->GetInnerEntities() | std::views::values) {
+                for (auto& inner_entity : entities) {
+                    pending.emplace_back(inner_entity.get(), 2);
+                }
+            }
+        }
+
+        if (auto* item = dynamic_cast<Item*>(entity); item != nullptr && item->HasInnerItems()) {
+            for (auto* inner_item : item->GetAllInnerItems()) {
+                pending.emplace_back(inner_item, 1);
+            }
+        }
+
+        return true;
+    };
+
+    auto& pending = _pagingWalk;
+    pending.clear();
+    pending.emplace_back(loc, 1);
+
+    for (auto& map : loc->GetMaps()) {
+        if (!map->GetPlayerCritters().empty()) {
+            return false;
+        }
+
+        pending.emplace_back(map.get(), 2);
+
+        for (auto& cr : map->GetCritters()) {
+            if (cr->GetControlledByPlayer() || cr->IsMoving() || cr->GetIsAttached() || !cr->AttachedCritters.empty()) {
+                return false;
+            }
+
+            pending.emplace_back(cr.get(), 2);
+
+            for (auto& item : cr->GetInvItems()) {
+                pending.emplace_back(item.get(), 1);
+            }
+        }
+
+        for (auto& item : map->GetItems()) {
+            pending.emplace_back(item.get(), 1);
+        }
+    }
+
+    return IsEntityTreeIdle(pending, expand);
+}
+
+void EntityManager::UnloadLocation(Location* loc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(loc);
+    FO_RUNTIME_ASSERT(!loc->IsDestroying());
+
+    const auto unload_time = TimeMeter();
+    const auto loc_id = loc->GetId();
+    refcount_ptr loc_holder = loc;
+
+    // Entities are released without touching storage, all their data is already there
+    PagedOutLocations::Entry paged_out;
+    unordered_set<hstring> pids;
+
+    function<void(Entity*)> unload_inner_entities;
+
+    unload_inner_entities = [this, &paged_out, &unload_inner_entities](Entity* holder) {
+        for (auto& entities : holder->GetInnerEntities() | std::views::values) {
+            for (auto& entity : entities) {
+                if (entity->HasInnerEntities()) {
+                    unload_inner_entities(entity.get());
+                }
+
+                auto* custom_entity = dynamic_cast<CustomEntity*>(entity.get());
+                FO_RUNTIME_ASSERT(custom_entity);
+
+                paged_out.EntityIds.emplace_back(custom_entity->GetId());
+                custom_entity->MarkAsDestroyed();
+                UnregisterCustomEntity(custom_entity, false);
+            }
+        }
+
+        holder->ClearInnerEntities();
+    };
+
+    function<void(Item*)> unload_item;
+
+    unload_item = [this, &paged_out, &pids, &unload_inner_entities, &unload_item](Item* item) {
+        if (item->HasInnerItems()) {
+            auto& inner_items = item->GetRawInnerItems();
+
+            for (auto* inner_item : inner_items) {
+                unload_item(inner_item);
+            }
+
+            inner_items.clear();
+        }
+
+        if (item->HasInnerEntities()) {
+            unload_inner_entities(item);
+        }
+
+        paged_out.EntityIds.emplace_back(item->GetId());
+        pids.emplace(item->GetProtoId());
+        item->MarkAsDestroyed();
+        UnregisterItem(item, false);
+    };
+
+    for (auto& map : loc->GetMaps()) {
+        for (auto* cr : copy_hold_ref(map->GetCritters())) {
+            for (auto* item : copy_hold_ref(cr->GetInvItems())) {
+                unload_item(item);
+                cr->RemoveItem(item);
+            }
+
+            if (cr->HasInnerEntities()) {
+                unload_inner_entities(cr);
+            }
+
+            paged_out.EntityIds.emplace_back(cr->GetId());
+            pids.emplace(cr->GetProtoId());
+            cr->MarkAsDestroyed();
+            UnregisterCritter(cr, false);
+        }
+
+        for (auto* item : copy_hold_ref(map->GetItems())) {
+            unload_item(item);
+        }
+
+        if (map->HasInnerEntities()) {
+            unload_inner_entities(map.get());
+        }
+
+        paged_out.EntityIds.emplace_back(map->GetId());
+        pids.emplace(map->GetProtoId());
+        map->MarkAsDestroyed();
+        UnregisterMap(map.get(), false);
+    }
+
+    if (loc->HasInnerEntities()) {
+        unload_inner_entities(loc);
+    }
+
+    paged_out.EntityIds.emplace_back(loc_id);
+    pids.emplace(loc->GetProtoId());
+    loc->MarkAsDestroyed();
+    UnregisterLocation(loc, false);
+
+    paged_out.Pids.assign(pids.begin(), pids.end());
+
+    _pagedOut.Add(loc_id, std::move(paged_out));
+    _pagingCursor.Forget(loc_id);
+
+    const auto duration = unload_time.GetDuration();
+    _unloadStats.Count++;
+    _unloadStats.TotalTime += duration;
+    _unloadStats.MaxTime = std::max(_unloadStats.MaxTime, duration);
+}
+
+static void SetRestoredInitCalled(Location* loc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    vector<ServerEntity*> pending;
+    pending.emplace_back(loc);
+
+    for (auto& map : loc->GetMaps()) {
+        pending.emplace_back(map.get());
+
+        for (auto& cr : map->GetCritters()) {
+            pending.emplace_back(cr.get());
+
+            for (auto& item : cr->GetInvItems()) {
+                pending.emplace_back(item.get());
+            }
+        }
+
+        for (auto& item : map->GetItems()) {
+            pending.emplace_back(item.get());
+        }
+    }
+
+    MarkEntityTreeRestored(pending, [](ServerEntity* entity, vector<ServerEntity*>& pending_) {
+        if (auto* item = dynamic_cast<Item*>(entity); item != nullptr && item->HasInnerItems()) {
+            for (auto* inner_item : item->GetAllInnerItems()) {
+                pending_.emplace_back(inner_item);
+            }
+        }
+    });
+}
+
+auto EntityManager::ReloadLocation(ident_t loc_id) noexcept -> Location*
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_pagedOut.IsPagedOut(loc_id)) {
+        return nullptr;
+    }
+
+    try {
+        const auto reload_time = TimeMeter();
+        const auto paged_out = _pagedOut.Take(loc_id);
+        FO_RUNTIME_ASSERT(paged_out.has_value());
+
+        bool is_error = false;
+        auto* loc = LoadLocation(loc_id, is_error);
+
+        if (is_error) {
+            WriteLog("Paged out location {} reloaded with errors", loc_id);
+        }
+        if (loc == nullptr) {
+            return nullptr;
+        }
+
+        refcount_ptr loc_holder = loc;
+
+        // Entities were initialized before paging out and all their state is restored from storage
+        SetRestoredInitCalled(loc);
+
+        for (auto& map : copy_hold_ref(loc->GetMaps())) {
+            for (auto* cr : copy_hold_ref(map->GetCritters())) {
+                if (!cr->IsDestroyed()) {
+                    _engine->MapMngr.ProcessVisibleCritters(cr);
+                }
+                if (!cr->IsDestroyed()) {
+                    _engine->MapMngr.ProcessVisibleItems(cr);
+                }
+            }
+        }
+
+        _pagingCursor.MarkBusy(loc_id, _engine->GameTime.GetFrameTime());
+
+        const auto duration = reload_time.GetDuration();
+        _reloadStats.Count++;
+        _reloadStats.TotalTime += duration;
+        _reloadStats.MaxTime = std::max(_reloadStats.MaxTime, duration);
+
+        return !loc->IsDestroyed() ? loc : nullptr;
+    }
+    catch (const std::exception& ex) {
+        WriteLog("Failed to reload paged out location {}", loc_id);
+        ReportExceptionAndContinue(ex);
+        return nullptr;
+    }
+    catch (...) {
+        FO_UNKNOWN_EXCEPTION();
+    }
+}
+
+auto EntityManager::EnsureLoaded(ident_t id) noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (_pagedOut.IsEmpty()) {
+        return false;
+    }
+
+    const auto loc_id = _pagedOut.FindLocation(id);
+    return loc_id && ReloadLocation(loc_id) != nullptr;
+}
+
+void EntityManager::EnsureProtoLoaded(hstring pid) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Reload takes location out of registry even on failure
+    for (auto loc_id = _pagedOut.FindLocationByProto(pid); loc_id; loc_id = _pagedOut.FindLocationByProto(pid)) {
+        ReloadLocation(loc_id);
+    }
+}
+
+void EntityManager::EnsureAllLoaded() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    while (!_pagedOut.IsEmpty()) {
+        ReloadLocation(_pagedOut.GetAnyLocation());
+    }
+}
+
+auto EntityManager::GetPagingInfo() const -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    string buf;
+
+    const auto paging_stats_info = [&buf](string_view stage_name, const PagingStats& stats) {
+        const auto avg_time = stats.Count != 0 ? timespan(stats.TotalTime.value() / numeric_cast<int64>(stats.Count)) : timespan::zero;
+        buf += strex("Location {}s: {}, avg {}, max {}\n", stage_name, stats.Count, avg_time, stats.MaxTime);
+    };
+
+    buf += strex("Paged out locations: {}\n", _pagedOut.GetLocationsCount());
+    paging_stats_info("unload", _unloadStats);
+    paging_stats_info("reload", _reloadStats);
+
+    return buf;
+}
+
+auto EntityManager::GetMemoryUsageInfo(size_t top_count) const -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    string buf;
+
+    unordered_map<hstring, pair<size_t, size_t>> types_usage;
+
+    for (const auto& entity : _allEntities | std::views::values) {
+        auto& [count, bytes] = types_usage[entity->GetTypeName()];
+        count++;
+        bytes += entity->GetProperties().GetMemoryUsage();
+    }
+
+    vector<pair<size_t, string>> top_types;
+    top_types.reserve(types_usage.size());
+
+    for (auto&& [type_name, usage] : types_usage) {
+        top_types.emplace_back(usage.second, strex("{} ({} entities)", type_name, usage.first));
+    }
+
+    vector<pair<size_t, string>> top_maps;
+    top_maps.reserve(_allMaps.size());
+
+    for (const auto& map : _allMaps | std::views::values) {
+        top_maps.emplace_back(map->GetMemoryUsage(), strex("{} ({})", map->GetName(), map->GetId()));
+    }
+
+    const auto add_top = [&buf, top_count](string_view title, vector<pair<size_t, string>>& entries) {
+        std::ranges::sort(entries, [](auto&& e1, auto&& e2) { return e1.first > e2.first; });
+        buf += strex("Top {} by memory:\n", title);
+
+        for (size_t i = 0; i < std::min(top_count, entries.size()); i++) {
+            buf += strex("  {}: {} KB\n", entries[i].second, entries[i].first / 1024);
+        }
+    };
+
+    add_top("entity types", top_types);
+    add_top("maps", top_maps);
+
+    return buf;
+}
+
 void EntityManager::RegisterPlayer(Player* player, ident_t id)
 {
     FO_STACK_TRACE_ENTRY();
@@ -839,7 +1235,7 @@ void EntityManager::RegisterPlayer(Player* player, ident_t id)
     FO_RUNTIME_ASSERT(id);
     player->SetId(id);
     RegisterEntity(player);
-    const auto [it, inserted] = _allPlayers.emplace(player->GetId(), player);
+    const auto inserted = _allPlayers.emplace(player->GetId(), player);
     FO_RUNTIME_ASSERT(inserted);
 }
 
@@ -847,9 +1243,8 @@ void EntityManager::UnregisterPlayer(Player* player)
 {
     FO_STACK_TRACE_ENTRY();
 
-    const auto it = _allPlayers.find(player->GetId());
-    FO_RUNTIME_ASSERT(it != _allPlayers.end());
-    _allPlayers.erase(it);
+    const auto erased = _allPlayers.erase(player->GetId());
+    FO_RUNTIME_ASSERT(erased);
     UnregisterEntity(player, false);
 }
 
@@ -860,16 +1255,18 @@ void EntityManager::RegisterLocation(Location* loc)
     RegisterEntity(loc);
     const auto [it, inserted] = _allLocations.emplace(loc->GetId(), loc);
     FO_RUNTIME_ASSERT(inserted);
+    _locationProtoRegistry.Add(loc);
 }
 
-void EntityManager::UnregisterLocation(Location* loc)
+void EntityManager::UnregisterLocation(Location* loc, bool delete_from_db)
 {
     FO_STACK_TRACE_ENTRY();
 
     const auto it = _allLocations.find(loc->GetId());
     FO_RUNTIME_ASSERT(it != _allLocations.end());
     _allLocations.erase(it);
-    UnregisterEntity(loc, true);
+    _locationProtoRegistry.Remove(loc);
+    UnregisterEntity(loc, delete_from_db);
 }
 
 void EntityManager::RegisterMap(Map* map)
@@ -879,16 +1276,18 @@ void EntityManager::RegisterMap(Map* map)
     RegisterEntity(map);
     const auto [it, inserted] = _allMaps.emplace(map->GetId(), map);
     FO_RUNTIME_ASSERT(inserted);
+    _mapProtoRegistry.Add(map);
 }
 
-void EntityManager::UnregisterMap(Map* map)
+void EntityManager::UnregisterMap(Map* map, bool delete_from_db)
 {
     FO_STACK_TRACE_ENTRY();
 
     const auto it = _allMaps.find(map->GetId());
     FO_RUNTIME_ASSERT(it != _allMaps.end());
     _allMaps.erase(it);
-    UnregisterEntity(map, true);
+    _mapProtoRegistry.Remove(map);
+    UnregisterEntity(map, delete_from_db);
 }
 
 void EntityManager::RegisterCritter(Critter* cr)
@@ -896,18 +1295,19 @@ void EntityManager::RegisterCritter(Critter* cr)
     FO_STACK_TRACE_ENTRY();
 
     RegisterEntity(cr);
-    const auto [it, inserted] = _allCritters.emplace(cr->GetId(), cr);
+    const auto inserted = _allCritters.emplace(cr->GetId(), cr);
     FO_RUNTIME_ASSERT(inserted);
+    _crittersRevision++;
 }
 
-void EntityManager::UnregisterCritter(Critter* cr)
+void EntityManager::UnregisterCritter(Critter* cr, bool delete_from_db)
 {
     FO_STACK_TRACE_ENTRY();
 
-    const auto it = _allCritters.find(cr->GetId());
-    FO_RUNTIME_ASSERT(it != _allCritters.end());
-    _allCritters.erase(it);
-    UnregisterEntity(cr, !cr->GetControlledByPlayer());
+    const auto erased = _allCritters.erase(cr->GetId());
+    FO_RUNTIME_ASSERT(erased);
+    _crittersRevision++;
+    UnregisterEntity(cr, delete_from_db);
 }
 
 void EntityManager::RegisterItem(Item* item)
@@ -917,6 +1317,7 @@ void EntityManager::RegisterItem(Item* item)
     RegisterEntity(item);
     const auto [it, inserted] = _allItems.emplace(item->GetId(), item);
     FO_RUNTIME_ASSERT(inserted);
+    _itemProtoRegistry.Add(item);
 }
 
 void EntityManager::UnregisterItem(Item* item, bool delete_from_db)
@@ -926,6 +1327,7 @@ void EntityManager::UnregisterItem(Item* item, bool delete_from_db)
     const auto it = _allItems.find(item->GetId());
     FO_RUNTIME_ASSERT(it != _allItems.end());
     _allItems.erase(it);
+    _itemProtoRegistry.Remove(item);
     UnregisterEntity(item, delete_from_db);
 }
 
@@ -979,9 +1381,15 @@ void EntityManager::RegisterEntity(ServerEntity* entity)
 
         entity->SetId(id);
     }
+    else {
+        // Waiters kept from unload of same entity
+        _engine->ScriptSys.HandleEntityLoaded(entity, entity->GetId());
+    }
 
     const auto [it, inserted] = _allEntities.emplace(entity->GetId(), entity);
     FO_RUNTIME_ASSERT(inserted);
+
+    AddToPropertyIndexes(entity);
 }
 
 void EntityManager::UnregisterEntity(ServerEntity* entity, bool delete_from_db)
@@ -994,10 +1402,89 @@ void EntityManager::UnregisterEntity(ServerEntity* entity, bool delete_from_db)
 
     const auto it = _allEntities.find(entity_id);
     FO_RUNTIME_ASSERT(it != _allEntities.end());
+    RemoveFromPropertyIndexes(entity);
     _allEntities.erase(it); // Maybe last pointer to this entity
 
     if (delete_from_db) {
         _engine->DbStorage.Delete(type_name_plural, entity_id);
+
+        _engine->ScriptSys.NotifyEvent(_engine->EntityDestroyedEventName, entity);
+        _engine->ScriptSys.HandleEntityDestroyed(entity);
+    }
+    else {
+        // Unloaded entity is not destroyed, it's released from memory and may be loaded again
+        _engine->ScriptSys.HandleEntityUnloaded(entity, entity_id);
+    }
+}
+
+void EntityManager::InitPropertyIndexes()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    for (const auto& [type_name, entity_info] : _engine->GetEntityTypesInfo()) {
+        const auto& registrator = entity_info.PropRegistrator;
+
+        for (size_t i = 1; i < registrator->GetPropertiesCount(); i++) {
+            const auto* prop = registrator->GetPropertyByIndex(numeric_cast<int32>(i));
+
+            if (prop->IsDisabled()) {
+                continue;
+            }
+            if (!prop->IsIndexed()) {
+                continue;
+            }
+
+            const auto index_type = prop->IsSortedIndexed() ? EntityIndexType::Sorted : EntityIndexType::Hash;
+            _propertyIndexes.emplace(prop, SafeAlloc::MakeUnique<EntityIndex<ServerEntity>>(index_type));
+            _indexedProperties[type_name].emplace_back(prop);
+
+            prop->AddPostSetter([this](Entity* entity, const Property* prop_) { OnSetIndexedValue(entity, prop_); });
+        }
+    }
+}
+
+auto EntityManager::GetPropertyIndex(const Property* prop) noexcept -> EntityIndex<ServerEntity>*
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (const auto it = _propertyIndexes.find(prop); it != _propertyIndexes.end()) {
+        return it->second.get();
+    }
+
+    return nullptr;
+}
+
+void EntityManager::AddToPropertyIndexes(ServerEntity* entity)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (const auto it = _indexedProperties.find(entity->GetTypeName()); it != _indexedProperties.end()) {
+        for (const auto& prop : it->second) {
+            _propertyIndexes.at(prop.get())->Set(entity, entity->GetValueAsInt(prop.get()));
+        }
+    }
+}
+
+void EntityManager::RemoveFromPropertyIndexes(ServerEntity* entity)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (const auto it = _indexedProperties.find(entity->GetTypeName()); it != _indexedProperties.end()) {
+        for (const auto& prop : it->second) {
+            _propertyIndexes.at(prop.get())->Remove(entity);
+        }
+    }
+}
+
+void EntityManager::OnSetIndexedValue(Entity* entity, const Property* prop)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Protos and not yet registered entities are skipped, registration picks up actual value
+    auto* server_entity = dynamic_cast<ServerEntity*>(entity);
+
+    if (server_entity != nullptr) {
+        _propertyIndexes.at(prop)->Update(server_entity, server_entity->GetValueAsInt(prop));
     }
 }
 
@@ -1041,6 +1528,15 @@ void EntityManager::DestroyAllEntities()
 {
     FO_STACK_TRACE_ENTRY();
 
+    // Unlink while entities are still alive
+    for (auto& index : _propertyIndexes | std::views::values) {
+        index->Clear();
+    }
+
+    _itemProtoRegistry.Clear();
+    _mapProtoRegistry.Clear();
+    _locationProtoRegistry.Clear();
+
     const auto destroy_entities = [this](auto& entities) {
         for (auto&& [id, entity] : copy(entities)) {
             entity->MarkAsDestroyed();
@@ -1051,10 +1547,21 @@ void EntityManager::DestroyAllEntities()
         FO_RUNTIME_ASSERT(entities.empty());
     };
 
-    destroy_entities(_allPlayers);
+    const auto destroy_epoch_entities = [this](auto& entities) {
+        for (auto* entity : entities.iterate()) {
+            const auto id = entity->GetId();
+            entity->MarkAsDestroyed();
+            entities.erase(id);
+            _allEntities.erase(id);
+        }
+
+        FO_RUNTIME_ASSERT(entities.empty());
+    };
+
+    destroy_epoch_entities(_allPlayers);
     destroy_entities(_allLocations);
     destroy_entities(_allMaps);
-    destroy_entities(_allCritters);
+    destroy_epoch_entities(_allCritters);
     destroy_entities(_allItems);
 
     for (auto& val : _allCustomEntities | std::views::values) {
@@ -1209,7 +1716,6 @@ auto EntityManager::GetCustomEntity(hstring type_name, ident_t id) -> CustomEnti
 
     auto& custom_entities = _allCustomEntities[type_name];
     const auto it = custom_entities.find(id);
-
     return it != custom_entities.end() ? it->second.get() : nullptr;
 }
 
@@ -1292,8 +1798,8 @@ void EntityManager::ForEachCustomEntityView(CustomEntity* entity, const function
             view_callback(player, true);
         }
         else if (const auto* game = dynamic_cast<FOServer*>(holder); game != nullptr) {
-            for (auto& game_player : GetPlayers() | std::views::values) {
-                view_callback(game_player.get(), false);
+            for (auto* game_player : GetPlayers().iterate()) {
+                view_callback(game_player, false);
             }
         }
         else if (auto* loc = dynamic_cast<Location*>(holder); loc != nullptr) {
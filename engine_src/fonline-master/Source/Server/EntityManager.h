@@ -36,6 +36,9 @@
 #include "Common.h"
 
 #include "Critter.h"
+#include "EntityIndex.h"
+#include "EntityPaging.h"
+#include "EntityProtoRegistry.h"
 #include "DataBase.h"
 #include "Item.h"
 #include "Location.h"
@@ -47,6 +50,10 @@ FO_BEGIN_NAMESPACE();
 class EntityManager final
 {
 public:
+    using ItemProtoRegistry = EntityProtoRegistry<Item, &Item::ProtoHook>;
+    using MapProtoRegistry = EntityProtoRegistry<Map, &Map::ProtoHook>;
+    using LocationProtoRegistry = EntityProtoRegistry<Location, &Location::ProtoHook>;
+
     EntityManager() = delete;
     explicit EntityManager(FOServer* engine);
     EntityManager(const EntityManager&) = delete;
@@ -61,7 +68,7 @@ public:
     [[nodiscard]] auto GetEntitiesCount() const noexcept -> size_t { return _allEntities.size(); }
     [[nodiscard]] auto GetPlayer(ident_t id) const noexcept -> const Player*;
     [[nodiscard]] auto GetPlayer(ident_t id) noexcept -> Player*;
-    [[nodiscard]] auto GetPlayers() noexcept -> unordered_map<ident_t, raw_ptr<Player>>& { return _allPlayers; }
+    [[nodiscard]] auto GetPlayers() noexcept -> epoch_map<ident_t, Player>& { return _allPlayers; }
     [[nodiscard]] auto GetPlayersCount() const noexcept -> size_t { return _allPlayers.size(); }
     [[nodiscard]] auto GetLocation(ident_t id) const noexcept -> const Location*;
     [[nodiscard]] auto GetLocation(ident_t id) noexcept -> Location*;
@@ -73,12 +80,23 @@ public:
     [[nodiscard]] auto GetMapsCount() const noexcept -> size_t { return _allMaps.size(); }
     [[nodiscard]] auto GetCritter(ident_t id) const noexcept -> const Critter*;
     [[nodiscard]] auto GetCritter(ident_t id) noexcept -> Critter*;
-    [[nodiscard]] auto GetCritters() noexcept -> unordered_map<ident_t, raw_ptr<Critter>>& { return _allCritters; }
+    [[nodiscard]] auto GetCritters() noexcept -> epoch_map<ident_t, Critter>& { return _allCritters; }
     [[nodiscard]] auto GetCrittersCount() const noexcept -> size_t { return _allCritters.size(); }
+    [[nodiscard]] auto GetCrittersRevision() const noexcept -> uint32 { return _crittersRevision; }
     [[nodiscard]] auto GetItem(ident_t id) const noexcept -> const Item*;
     [[nodiscard]] auto GetItem(ident_t id) noexcept -> Item*;
     [[nodiscard]] auto GetItems() noexcept -> unordered_map<ident_t, raw_ptr<Item>>& { return _allItems; }
     [[nodiscard]] auto GetItemsCount() const noexcept -> size_t { return _allEntities.size(); }
+    [[nodiscard]] auto GetItemsByProto(hstring pid) noexcept -> ItemProtoRegistry::group_range { return _itemProtoRegistry.Get(pid); }
+    [[nodiscard]] auto GetMapsByProto(hstring pid) noexcept -> MapProtoRegistry::group_range { return _mapProtoRegistry.Get(pid); }
+    [[nodiscard]] auto GetLocationsByProto(hstring pid) noexcept -> LocationProtoRegistry::group_range { return _locationProtoRegistry.Get(pid); }
+    [[nodiscard]] auto GetItemByProto(hstring pid, size_t skip_count) noexcept -> Item* { return _itemProtoRegistry.GetFirst(pid, skip_count); }
+    [[nodiscard]] auto GetMapByProto(hstring pid, size_t skip_count) noexcept -> Map* { return _mapProtoRegistry.GetFirst(pid, skip_count); }
+    [[nodiscard]] auto GetLocationByProto(hstring pid, size_t skip_count) noexcept -> Location* { return _locationProtoRegistry.GetFirst(pid, skip_count); }
+    [[nodiscard]] auto GetPropertyIndex(const Property* prop) noexcept -> EntityIndex<ServerEntity>*;
+    [[nodiscard]] auto GetPagedOutLocationsCount() const noexcept -> size_t { return _pagedOut.GetLocationsCount(); }
+    [[nodiscard]] auto GetPagingInfo() const -> string;
+    [[nodiscard]] auto GetMemoryUsageInfo(size_t top_count) const -> string;
 
     template<typename T>
     [[nodiscard]] auto Get(ident_t id) noexcept -> T*
@@ -96,6 +114,7 @@ public:
         return it != _allEntities.end() ? dynamic_cast<const T*>(it->second.get()) : nullptr;
     }
 
+    void InitPropertyIndexes();
     void LoadEntities();
     auto LoadLocation(ident_t loc_id, bool& is_error) noexcept -> Location*;
     auto LoadMap(ident_t map_id, bool& is_error) noexcept -> Map*;
@@ -107,14 +126,22 @@ public:
     void CallInit(Critter* cr, bool first_time);
     void CallInit(Item* item, bool first_time);
 
+    // Lookups see only loaded entities, callers that may touch paged out ones bring them back explicitly
+    void ProcessPaging(timespan max_time);
+    void UnloadLocation(Location* loc);
+    auto ReloadLocation(ident_t loc_id) noexcept -> Location*;
+    auto EnsureLoaded(ident_t id) noexcept -> bool;
+    void EnsureProtoLoaded(hstring pid) noexcept;
+    void EnsureAllLoaded() noexcept;
+
     void RegisterPlayer(Player* player, ident_t id);
     void UnregisterPlayer(Player* player);
     void RegisterLocation(Location* loc);
-    void UnregisterLocation(Location* loc);
+    void UnregisterLocation(Location* loc, bool delete_from_db);
     void RegisterMap(Map* map);
-    void UnregisterMap(Map* map);
+    void UnregisterMap(Map* map, bool delete_from_db);
     void RegisterCritter(Critter* cr);
-    void UnregisterCritter(Critter* cr);
+    void UnregisterCritter(Critter* cr, bool delete_from_db);
     void RegisterItem(Item* item);
     void UnregisterItem(Item* item, bool delete_from_db);
     void RegisterCustomEntity(CustomEntity* custom_entity);
@@ -132,23 +159,49 @@ public:
     void DestroyAllEntities();
 
 private:
+    struct PagingStats
+    {
+        size_t Count {};
+        timespan TotalTime {};
+        timespan MaxTime {};
+    };
+
+    [[nodiscard]] auto IsLocationIdle(Location* loc) -> bool;
+
     void LoadInnerEntities(Entity* holder, bool& is_error) noexcept;
     void LoadInnerEntitiesEntry(Entity* holder, hstring entry, bool& is_error) noexcept;
     auto LoadEntityDoc(hstring type_name, hstring collection_name, ident_t id, bool expect_proto, bool& is_error) const noexcept -> tuple<AnyData::Document, hstring>;
 
     void RegisterEntity(ServerEntity* entity);
     void UnregisterEntity(ServerEntity* entity, bool delete_from_db);
+    void AddToPropertyIndexes(ServerEntity* entity);
+    void RemoveFromPropertyIndexes(ServerEntity* entity);
+    void OnSetIndexedValue(Entity* entity, const Property* prop);
 
     raw_ptr<FOServer> _engine;
 
-    unordered_map<ident_t, raw_ptr<Player>> _allPlayers {};
+    epoch_map<ident_t, Player> _allPlayers {};
     unordered_map<ident_t, raw_ptr<Location>> _allLocations {};
     unordered_map<ident_t, raw_ptr<Map>> _allMaps {};
-    unordered_map<ident_t, raw_ptr<Critter>> _allCritters {};
+    epoch_map<ident_t, Critter> _allCritters {};
+    uint32 _crittersRevision {};
     unordered_map<ident_t, raw_ptr<Item>> _allItems {};
     unordered_map<hstring, unordered_map<ident_t, raw_ptr<CustomEntity>>> _allCustomEntities {};
     unordered_map<ident_t, refcount_ptr<ServerEntity>> _allEntities {};
 
+    unordered_map<const Property*, unique_ptr<EntityIndex<ServerEntity>>> _propertyIndexes {};
+    unordered_map<hstring, vector<raw_ptr<const Property>>> _indexedProperties {};
+    ItemProtoRegistry _itemProtoRegistry {};
+    MapProtoRegistry _mapProtoRegistry {};
+    LocationProtoRegistry _locationProtoRegistry {};
+
+    PagedOutLocations _pagedOut {};
+    LocationPagingCursor _pagingCursor {};
+    nanotime _nextPagingPassTime {};
+    vector<pair<Entity*, int32>> _pagingWalk {};
+    PagingStats _unloadStats {};
+    PagingStats _reloadStats {};
+
     const hstring _playerTypeName {};
     const hstring _locationTypeName {};
     const hstring _mapTypeName {};
@@ -0,0 +1,230 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Bookkeeping of locations released from memory, data of their entities stays in storage
+class PagedOutLocations final
+{
+public:
+    struct Entry
+    {
+        vector<ident_t> EntityIds {};
+        vector<hstring> Pids {};
+    };
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return _locations.empty(); }
+    [[nodiscard]] auto GetLocationsCount() const noexcept -> size_t { return _locations.size(); }
+    [[nodiscard]] auto IsPagedOut(ident_t loc_id) const noexcept -> bool { return _locations.count(loc_id) != 0; }
+    [[nodiscard]] auto GetAnyLocation() const noexcept -> ident_t { return !_locations.empty() ? _locations.begin()->first : ident_t {}; }
+
+    [[nodiscard]] auto FindLocation(ident_t entity_id) const noexcept -> ident_t
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        const auto it = _entities.find(entity_id);
+        return it != _entities.end() ? it->second : ident_t {};
+    }
+
+    [[nodiscard]] auto FindLocationByProto(hstring pid) const noexcept -> ident_t
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        const auto it = _protos.find(pid);
+        return it != _protos.end() ? *it->second.begin() : ident_t {};
+    }
+
+    void Add(ident_t loc_id, Entry entry)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        FO_RUNTIME_ASSERT(loc_id);
+        FO_RUNTIME_ASSERT(_locations.count(loc_id) == 0);
+
+        for (const auto id : entry.EntityIds) {
+            _entities.emplace(id, loc_id);
+        }
+        for (const auto pid : entry.Pids) {
+            _protos[pid].emplace(loc_id);
+        }
+
+        _locations.emplace(loc_id, std::move(entry));
+    }
+
+    [[nodiscard]] auto Take(ident_t loc_id) -> optional<Entry>
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto it = _locations.find(loc_id);
+
+        if (it == _locations.end()) {
+            return std::nullopt;
+        }
+
+        auto entry = std::move(it->second);
+        _locations.erase(it);
+
+        for (const auto id : entry.EntityIds) {
+            _entities.erase(id);
+        }
+
+        for (const auto pid : entry.Pids) {
+            const auto pid_it = _protos.find(pid);
+            FO_RUNTIME_ASSERT(pid_it != _protos.end());
+            pid_it->second.erase(loc_id);
+
+            if (pid_it->second.empty()) {
+                _protos.erase(pid_it);
+            }
+        }
+
+        return entry;
+    }
+
+private:
+    unordered_map<ident_t, Entry> _locations {};
+    unordered_map<ident_t, ident_t> _entities {}; // Entity id -> paged out location id
+    unordered_map<hstring, unordered_set<ident_t>> _protos {}; // Proto id -> paged out location ids
+};
+
+// Resumable walk over loaded locations, each pass works on snapshot of location ids
+// Keeps time of last activity of every location to find ones idle long enough
+class LocationPagingCursor final
+{
+public:
+    [[nodiscard]] auto IsPassFinished() const noexcept -> bool { return _cursor >= _passLocIds.size(); }
+    [[nodiscard]] auto GetTrackedCount() const noexcept -> size_t { return _busyTime.size(); }
+
+    void StartPass(vector<ident_t> loc_ids, nanotime now)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        _passLocIds = std::move(loc_ids);
+        _cursor = 0;
+
+        // Forget locations gone since previous pass
+        unordered_map<ident_t, nanotime> busy_time;
+        busy_time.reserve(_passLocIds.size());
+
+        for (const auto loc_id : _passLocIds) {
+            const auto it = _busyTime.find(loc_id);
+            busy_time.emplace(loc_id, it != _busyTime.end() ? it->second : now);
+        }
+
+        _busyTime = std::move(busy_time);
+    }
+
+    [[nodiscard]] auto TakeNext() noexcept -> ident_t
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        return _cursor < _passLocIds.size() ? _passLocIds[_cursor++] : ident_t {};
+    }
+
+    // Returns true when location stays idle for at least idle_time
+    [[nodiscard]] auto Update(ident_t loc_id, bool is_idle, nanotime now, timespan idle_time) -> bool
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto it = _busyTime.emplace(loc_id, now).first;
+
+        if (!is_idle) {
+            it->second = now;
+            return false;
+        }
+
+        return now - it->second >= idle_time;
+    }
+
+    void MarkBusy(ident_t loc_id, nanotime now)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        _busyTime[loc_id] = now;
+    }
+
+    void Forget(ident_t loc_id) noexcept
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        _busyTime.erase(loc_id);
+    }
+
+private:
+    vector<ident_t> _passLocIds {};
+    size_t _cursor {};
+    unordered_map<ident_t, nanotime> _busyTime {};
+};
+
+// Entity is idle when only engine containers hold it (no script handles) and nothing is scheduled for it
+// Pending holds entities with their expected engine refs, expand adds children and may reject entity by its own rules
+// Walk is iterative so deep item nesting can't overflow stack
+template<typename T, typename Expand>
+[[nodiscard]] auto IsEntityTreeIdle(vector<pair<T*, int32>>& pending, const Expand& expand) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    while (!pending.empty()) {
+        const auto [entity, engine_refs] = pending.back();
+        pending.pop_back();
+
+        if (entity->GetRefCount() != engine_refs || entity->IsDestroying() || entity->HasTimeEvents() || !expand(entity, pending)) {
+            pending.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Reloaded entities get all their state back from storage and were initialized before paging out
+// So init is only marked as done, expand adds children of entity
+template<typename T, typename Expand>
+void MarkEntityTreeRestored(vector<T*>& pending, const Expand& expand)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    while (!pending.empty()) {
+        auto* entity = pending.back();
+        pending.pop_back();
+
+        entity->SetInitCalled();
+        expand(entity, pending);
+    }
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,223 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Links of entity inside one proto registry, entity holds separate hook per registry
+template<typename T>
+struct EntityProtoHook
+{
+    raw_ptr<T> Prev {};
+    raw_ptr<T> Next {};
+    bool Linked {};
+};
+
+// Entities grouped by proto id in intrusive lists
+// Lookup cost is proportional to matched entities, order inside group is order of adding
+template<typename T, EntityProtoHook<T> T::* Hook>
+class EntityProtoRegistry final
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T**;
+        using reference = T*;
+
+        iterator() noexcept = default;
+        explicit iterator(T* entity) noexcept :
+            _entity {entity}
+        {
+        }
+
+        [[nodiscard]] auto operator*() const noexcept -> T* { return _entity; }
+        [[nodiscard]] auto operator==(const iterator& other) const noexcept -> bool { return _entity == other._entity; }
+
+        auto operator++() noexcept -> iterator&
+        {
+            _entity = (_entity->*Hook).Next.get();
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> iterator
+        {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+    private:
+        T* _entity {};
+    };
+
+    class group_range
+    {
+    public:
+        group_range() noexcept = default;
+        group_range(T* head, size_t size) noexcept :
+            _head {head},
+            _size {size}
+        {
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> iterator { return iterator(_head); }
+        [[nodiscard]] auto end() const noexcept -> iterator { return iterator(); }
+        [[nodiscard]] auto size() const noexcept -> size_t { return _size; }
+        [[nodiscard]] auto empty() const noexcept -> bool { return _size == 0; }
+
+    private:
+        T* _head {};
+        size_t _size {};
+    };
+
+    EntityProtoRegistry() = default;
+    EntityProtoRegistry(const EntityProtoRegistry&) = delete;
+    EntityProtoRegistry(EntityProtoRegistry&&) noexcept = default;
+    auto operator=(const EntityProtoRegistry&) = delete;
+    auto operator=(EntityProtoRegistry&&) noexcept -> EntityProtoRegistry& = default;
+    ~EntityProtoRegistry() = default;
+
+    [[nodiscard]] auto Get(hstring pid) const noexcept -> group_range
+    {
+        const auto it = _groups.find(pid);
+        return it != _groups.end() ? group_range(it->second.Head.get_no_const(), it->second.Size) : group_range();
+    }
+
+    [[nodiscard]] auto GetFirst(hstring pid, size_t skip_count) const noexcept -> T*
+    {
+        for (auto* entity : Get(pid)) {
+            if (skip_count == 0) {
+                return entity;
+            }
+
+            skip_count--;
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] auto Count(hstring pid) const noexcept -> size_t
+    {
+        const auto it = _groups.find(pid);
+        return it != _groups.end() ? it->second.Size : 0;
+    }
+
+    [[nodiscard]] auto GetGroupsCount() const noexcept -> size_t { return _groups.size(); }
+
+    void Add(T* entity)
+    {
+        FO_RUNTIME_ASSERT(entity);
+
+        auto& hook = entity->*Hook;
+        FO_RUNTIME_ASSERT(!hook.Linked);
+
+        auto& group = _groups[entity->GetProtoId()];
+
+        if (group.Tail) {
+            (group.Tail.get()->*Hook).Next = entity;
+            hook.Prev = group.Tail;
+        }
+        else {
+            group.Head = entity;
+        }
+
+        group.Tail = entity;
+        group.Size++;
+        hook.Linked = true;
+    }
+
+    void Remove(T* entity) noexcept
+    {
+        auto& hook = entity->*Hook;
+
+        if (!hook.Linked) {
+            return;
+        }
+
+        const auto it = _groups.find(entity->GetProtoId());
+        FO_STRONG_ASSERT(it != _groups.end());
+        auto& group = it->second;
+
+        if (hook.Prev) {
+            (hook.Prev.get()->*Hook).Next = hook.Next;
+        }
+        else {
+            group.Head = hook.Next;
+        }
+
+        if (hook.Next) {
+            (hook.Next.get()->*Hook).Prev = hook.Prev;
+        }
+        else {
+            group.Tail = hook.Prev;
+        }
+
+        hook = {};
+
+        if (--group.Size == 0) {
+            _groups.erase(it);
+        }
+    }
+
+    void Clear() noexcept
+    {
+        for (auto& group : _groups | std::views::values) {
+            for (auto* entity = group.Head.get(); entity != nullptr;) {
+                auto& hook = entity->*Hook;
+                entity = hook.Next.get();
+                hook = {};
+            }
+        }
+
+        _groups.clear();
+    }
+
+private:
+    struct Group
+    {
+        raw_ptr<T> Head {};
+        raw_ptr<T> Tail {};
+        size_t Size {};
+    };
+
+    unordered_map<hstring, Group> _groups {};
+};
+
+FO_END_NAMESPACE();
@@ -0,0 +1,236 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "EntityRange.h"
+
+FO_BEGIN_NAMESPACE();
+
+template<typename Func>
+static void ForEachCandidate(CritterRange& range, const Func& func)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto find_type = range.FindType;
+
+    if (range.SourceMap) {
+        if (range.SourceMap->IsDestroyed()) {
+            return;
+        }
+
+        for (auto& cr : range.SourceMap->GetCritters()) {
+            if (find_type == CritterFindType::Any || cr->CheckFind(find_type)) {
+                func(cr.get());
+            }
+        }
+    }
+    else {
+        // Paged out npc are brought back first, iteration keeps critters list stable while scanning
+        range.Entities->EnsureAllLoaded();
+
+        for (auto* cr : range.Entities->GetCritters().iterate()) {
+            if (!cr->IsDestroyed() && !cr->GetControlledByPlayer() && (find_type == CritterFindType::Any || cr->CheckFind(find_type))) {
+                func(cr);
+            }
+        }
+    }
+}
+
+template<typename Func>
+static void ForEachCandidate(ItemRange& range, const Func& func)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (range.SourceMap->IsDestroyed()) {
+        return;
+    }
+
+    for (auto& item : range.SourceMap->GetItems()) {
+        func(item.get());
+    }
+}
+
+static void CheckRangeIndex(int32 index, size_t count)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (index < 0 || numeric_cast<size_t>(index) >= count) {
+        throw ScriptException("Range index out of bounds", index, count);
+    }
+}
+
+auto CritterRange::GetCount() -> int32
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (IsLive()) {
+        SyncRevision();
+        return SourceMap->IsDestroyed() ? 0 : numeric_cast<int32>(SourceMap->GetCritters().size());
+    }
+
+    // Recount after critters added or removed, game wide range loads paged out npc first so reload doesn't change revision during scan
+    if (!SourceMap) {
+        Entities->EnsureAllLoaded();
+    }
+
+    const auto revision = SourceMap ? SourceMap->GetCrittersRevision() : Entities->GetCrittersRevision();
+    return numeric_cast<int32>(State.GetCount(revision, [this](const auto& func) { ForEachCandidate(*this, func); }));
+}
+
+auto CritterRange::GetAt(int32 index) -> Critter*
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (IsLive()) {
+        SyncRevision();
+        const auto critters = SourceMap->IsDestroyed() ? span<raw_ptr<Critter>>() : SourceMap->GetCritters();
+        CheckRangeIndex(index, critters.size());
+        return critters[index].get();
+    }
+
+    State.Materialize([this](const auto& func) { ForEachCandidate(*this, func); });
+    CheckRangeIndex(index, State.GetEntriesCount());
+    return State.GetEntry(numeric_cast<size_t>(index));
+}
+
+void CritterRange::FilterByProto(hstring pid)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    State.FilterByProto(pid);
+}
+
+void CritterRange::FilterByComponent(CritterComponent component)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    State.FilterByComponent(static_cast<hstring::hash_t>(component));
+}
+
+auto CritterRange::IsLive() const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return SourceMap && !State.IsMaterialized() && FindType == CritterFindType::Any && !State.IsFiltered();
+}
+
+auto CritterRange::ToVector() -> vector<Critter*>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (IsLive()) {
+        SyncRevision();
+        return SourceMap->IsDestroyed() ? vector<Critter*>() : vec_transform(SourceMap->GetCritters(), [](auto&& cr) -> Critter* { return cr.get(); });
+    }
+
+    State.Materialize([this](const auto& func) { ForEachCandidate(*this, func); });
+    return State.GetEntries();
+}
+
+void CritterRange::SyncRevision() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    State.SyncSourceRevision(SourceMap->GetCrittersRevision());
+}
+
+auto ItemRange::GetCount() -> int32
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (IsLive()) {
+        SyncRevision();
+        return SourceMap->IsDestroyed() ? 0 : numeric_cast<int32>(SourceMap->GetItems().size());
+    }
+
+    return numeric_cast<int32>(State.GetCount(SourceMap->GetItemsRevision(), [this](const auto& func) { ForEachCandidate(*this, func); }));
+}
+
+auto ItemRange::GetAt(int32 index) -> Item*
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (IsLive()) {
+        SyncRevision();
+        const auto items = SourceMap->IsDestroyed() ? span<raw_ptr<Item>>() : SourceMap->GetItems();
+        CheckRangeIndex(index, items.size());
+        return items[index].get();
+    }
+
+    State.Materialize([this](const auto& func) { ForEachCandidate(*this, func); });
+    CheckRangeIndex(index, State.GetEntriesCount());
+    return State.GetEntry(numeric_cast<size_t>(index));
+}
+
+void ItemRange::FilterByProto(hstring pid)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    State.FilterByProto(pid);
+}
+
+void ItemRange::FilterByComponent(ItemComponent component)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    State.FilterByComponent(static_cast<hstring::hash_t>(component));
+}
+
+auto ItemRange::IsLive() const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return !State.IsMaterialized() && !State.IsFiltered();
+}
+
+auto ItemRange::ToVector() -> vector<Item*>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (IsLive()) {
+        SyncRevision();
+        return SourceMap->IsDestroyed() ? vector<Item*>() : vec_transform(SourceMap->GetItems(), [](auto&& item) -> Item* { return item.get(); });
+    }
+
+    State.Materialize([this](const auto& func) { ForEachCandidate(*this, func); });
+    return State.GetEntries();
+}
+
+void ItemRange::SyncRevision() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    State.SyncSourceRevision(SourceMap->GetItemsRevision());
+}
+
+FO_END_NAMESPACE();
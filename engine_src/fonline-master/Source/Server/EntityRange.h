@@ -0,0 +1,233 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+#include "Critter.h"
+#include "EntityManager.h"
+#include "Item.h"
+#include "Map.h"
+#include "ScriptSystem.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Filters, match count cache and snapshot shared by entity ranges
+// Filters always combine with AND, count is cached per source revision, snapshot is taken on first indexed access
+template<typename T>
+class EntityRangeState final
+{
+public:
+    [[nodiscard]] auto IsFiltered() const noexcept -> bool { return _pid || !_components.empty(); }
+    [[nodiscard]] auto IsMaterialized() const noexcept -> bool { return _materialized; }
+    [[nodiscard]] auto GetEntriesCount() const noexcept -> size_t { return _entries.size(); }
+    [[nodiscard]] auto GetEntry(size_t index) noexcept -> T* { return _entries[index].get(); }
+    [[nodiscard]] auto GetEntries() -> vector<T*> { return vec_transform(_entries, [](auto&& entity) -> T* { return entity.get(); }); }
+    [[nodiscard]] auto GetSourceRevision() const noexcept -> uint32 { return _sourceRevision; }
+
+    [[nodiscard]] auto Match(const T* entity) const noexcept -> bool
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        if (_pid && entity->GetProtoId() != _pid) {
+            return false;
+        }
+
+        for (const auto component : _components) {
+            if (!entity->GetProto()->HasComponent(component)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void SetSourceRevision(uint32 revision) noexcept { _sourceRevision = revision; }
+
+    // Live access follows source changes, cached count is dropped
+    void SyncSourceRevision(uint32 revision) noexcept
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        if (revision != _sourceRevision) {
+            _sourceRevision = revision;
+            _hasCount = false;
+        }
+    }
+
+    void FilterByProto(hstring pid)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (_pid == pid) {
+            return;
+        }
+        if (_pid) {
+            throw ScriptException("Range is already filtered by other proto", _pid, pid);
+        }
+
+        _pid = pid;
+        ApplyFilter();
+    }
+
+    void FilterByComponent(hstring::hash_t component)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (std::ranges::find(_components, component) != _components.end()) {
+            return;
+        }
+
+        _components.emplace_back(component);
+        ApplyFilter();
+    }
+
+    // For each visits source candidates, own filters are applied here
+    template<typename TForEach>
+    auto GetCount(uint32 revision, const TForEach& for_each) -> size_t
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (_materialized) {
+            return _entries.size();
+        }
+
+        if (!_hasCount || revision != _sourceRevision) {
+            _sourceRevision = revision;
+            _count = 0;
+
+            for_each([this](T* entity) {
+                if (Match(entity)) {
+                    _count++;
+                }
+            });
+
+            _hasCount = true;
+        }
+
+        return _count;
+    }
+
+    template<typename TForEach>
+    void Materialize(const TForEach& for_each)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (_materialized) {
+            return;
+        }
+
+        _entries.reserve(_hasCount ? _count : 0);
+
+        for_each([this](T* entity) {
+            if (Match(entity)) {
+                _entries.emplace_back(entity);
+            }
+        });
+
+        _materialized = true;
+        _hasCount = false;
+    }
+
+private:
+    void ApplyFilter()
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (_materialized) {
+            std::erase_if(_entries, [this](const refcount_ptr<T>& entity) { return !Match(entity.get()); });
+        }
+        else {
+            _hasCount = false;
+        }
+    }
+
+    hstring _pid {};
+    vector<hstring::hash_t> _components {};
+    uint32 _sourceRevision {};
+    bool _hasCount {};
+    size_t _count {};
+    bool _materialized {};
+    vector<refcount_ptr<T>> _entries {};
+};
+
+// Read only entity sequences returned to scripts instead of filled arrays
+// Unfiltered map ranges index live map lists and follow map changes (index is checked against current size),
+// any other range counts matches by scan and materializes them only on first indexed access
+///@ ExportRefType Server
+struct CritterRange
+{
+    FO_SCRIPTABLE_OBJECT_BEGIN();
+
+    auto GetCount() -> int32;
+    auto GetAt(int32 index) -> Critter*;
+    void FilterByProto(hstring pid);
+    void FilterByComponent(CritterComponent component);
+
+    FO_SCRIPTABLE_OBJECT_END();
+
+    [[nodiscard]] auto IsLive() const noexcept -> bool;
+    [[nodiscard]] auto ToVector() -> vector<Critter*>;
+    void SyncRevision() noexcept;
+
+    refcount_ptr<Map> SourceMap {}; // Null for game wide npc range
+    raw_ptr<EntityManager> Entities {};
+    CritterFindType FindType {};
+    EntityRangeState<Critter> State {};
+};
+static_assert(std::is_standard_layout_v<CritterRange>);
+
+///@ ExportRefType Server
+struct ItemRange
+{
+    FO_SCRIPTABLE_OBJECT_BEGIN();
+
+    auto GetCount() -> int32;
+    auto GetAt(int32 index) -> Item*;
+    void FilterByProto(hstring pid);
+    void FilterByComponent(ItemComponent component);
+
+    FO_SCRIPTABLE_OBJECT_END();
+
+    [[nodiscard]] auto IsLive() const noexcept -> bool;
+    [[nodiscard]] auto ToVector() -> vector<Item*>;
+    void SyncRevision() noexcept;
+
+    refcount_ptr<Map> SourceMap {};
+    EntityRangeState<Item> State {};
+};
+static_assert(std::is_standard_layout_v<ItemRange>);
+
+FO_END_NAMESPACE();
@@ -36,6 +36,7 @@
 #include "Common.h"
 
 #include "EntityProperties.h"
+#include "EntityProtoRegistry.h"
 #include "EntityProtos.h"
 #include "ScriptSystem.h"
 #include "ServerEntity.h"
@@ -46,7 +47,7 @@ class Item;
 class Critter;
 using StaticItem = Item;
 
-class Item final : public ServerEntity, public EntityWithProto, public ItemProperties
+class Item final : public ServerEntity, public EntityWithProto, public ItemProperties, public PooledAllocation<Item>
 {
     friend class Entity;
 
@@ -84,6 +85,9 @@ public:
     ScriptFunc<bool, Critter*, StaticItem*, Item*, any_t> StaticScriptFunc {};
     ScriptFunc<void, Critter*, StaticItem*, bool, uint8> TriggerScriptFunc {};
 
+    EntityProtoHook<Item> ProtoHook {};
+    EntityProtoHook<Item> InvProtoHook {};
+
 private:
     unique_ptr<vector<Item*>> _innerItems {};
     unique_ptr<vector<mpos>> _multihexEntries {};
@@ -36,6 +36,7 @@
 #include "Common.h"
 
 #include "EntityProperties.h"
+#include "EntityProtoRegistry.h"
 #include "EntityProtos.h"
 #include "ServerEntity.h"
 
@@ -75,6 +76,8 @@ public:
     ///@ ExportEvent
     FO_ENTITY_EVENT(OnMapRemoved, Map* /*map*/);
 
+    EntityProtoHook<Location> ProtoHook {};
+
 private:
     vector<refcount_ptr<Map>> _locMaps {};
 };
@@ -54,12 +54,16 @@ Map::Map(FOServer* engine, ident_t id, const ProtoMap* proto, Location* location
 
     _mapSize = GetSize();
 
+    _hexField = SafeAlloc::MakeUnique<DynamicTwoDimensionalGrid<Field, mpos, msize>>(_mapSize);
+
     if (engine->Settings.MapInstanceStaticGrid) {
-        _hexField = SafeAlloc::MakeUnique<StaticTwoDimensionalGrid<Field, mpos, msize>>(_mapSize);
-    }
-    else {
-        _hexField = SafeAlloc::MakeUnique<DynamicTwoDimensionalGrid<Field, mpos, msize>>(_mapSize);
+        _hexField->Preallocate();
     }
+
+    _itemsSpatial = SafeAlloc::MakeUnique<HexSpatialIndex<Item>>(_mapSize);
+
+    _shootBlockedChunks = HexChunkCounter(_mapSize);
+    FO_STRONG_ASSERT(_staticMap->ShootBlockedChunks.GetSize() == _mapSize);
 }
 
 Map::~Map()
@@ -67,6 +71,26 @@ Map::~Map()
     FO_STACK_TRACE_ENTRY();
 }
 
+auto Map::GetMemoryUsage() const noexcept -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Map itself with own hex field and entities placed on it, static map data is shared and not counted
+    size_t size = sizeof(Map) + GetProperties().GetMemoryUsage() + _hexField->GetMemoryUsage();
+    size += _shootBlockedChunks.GetMemoryUsage();
+    size += (_critters.capacity() + _playerCritters.capacity() + _nonPlayerCritters.capacity()) * sizeof(raw_ptr<Critter>);
+    size += (_items.capacity() + _farViewItems.capacity()) * sizeof(raw_ptr<Item>);
+
+    for (const auto& cr : _critters) {
+        size += sizeof(Critter) + cr->GetProperties().GetMemoryUsage();
+    }
+    for (const auto& item : _items) {
+        size += sizeof(Item) + item->GetProperties().GetMemoryUsage();
+    }
+
+    return size;
+}
+
 void Map::SetLocation(Location* loc) noexcept
 {
     FO_STACK_TRACE_ENTRY();
@@ -121,10 +145,11 @@ void Map::AddCritter(Critter* cr)
 {
     FO_STACK_TRACE_ENTRY();
 
-    FO_RUNTIME_ASSERT(!_crittersMap.count(cr->GetId()));
+    FO_RUNTIME_ASSERT(!_crittersMap.contains(cr->GetId()));
 
     _crittersMap.emplace(cr->GetId(), cr);
     vec_add_unique_value(_critters, cr);
+    _crittersRevision++;
 
     if (cr->GetControlledByPlayer()) {
         vec_add_unique_value(_playerCritters, cr);
@@ -140,11 +165,11 @@ void Map::RemoveCritter(Critter* cr)
 {
     FO_STACK_TRACE_ENTRY();
 
-    const auto it = _crittersMap.find(cr->GetId());
-    FO_RUNTIME_ASSERT(it != _crittersMap.end());
-    _crittersMap.erase(it);
+    const auto erased = _crittersMap.erase(cr->GetId());
+    FO_RUNTIME_ASSERT(erased);
 
     vec_remove_unique_value(_critters, cr);
+    _crittersRevision++;
 
     if (cr->GetControlledByPlayer()) {
         vec_remove_unique_value(_playerCritters, cr);
@@ -166,7 +191,7 @@ void Map::AddCritterToField(Critter* cr)
     auto& field = _hexField->GetCellForWriting(hex);
 
     vec_add_unique_value(field.Critters, cr);
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
     SetMultihexCritter(cr, true);
 }
 
@@ -180,7 +205,7 @@ void Map::RemoveCritterFromField(Critter* cr)
     auto& field = _hexField->GetCellForWriting(hex);
 
     vec_remove_unique_value(field.Critters, cr);
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
     SetMultihexCritter(cr, false);
 }
 
@@ -205,7 +230,7 @@ void Map::SetMultihexCritter(Critter* cr, bool set)
                     vec_remove_unique_value(field.Critters, cr);
                 }
 
-                RecacheHexFlags(field);
+                RecacheHexFlags(hex_around, field);
             }
         }
     }
@@ -268,17 +293,20 @@ void Map::SetItem(Item* item)
 {
     FO_STACK_TRACE_ENTRY();
 
-    FO_RUNTIME_ASSERT(!_itemsMap.count(item->GetId()));
+    FO_RUNTIME_ASSERT(!_itemsMap.contains(item->GetId()));
 
     _itemsMap.emplace(item->GetId(), item);
     vec_add_unique_value(_items, item);
+    _itemsRevision++;
 
     const auto hex = item->GetHex();
     auto& field = _hexField->GetCellForWriting(hex);
 
     vec_add_unique_value(field.Items, item);
+    _itemsSpatial->Add(item, hex);
+    UpdateFarViewItem(item);
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 
     if (item->IsNonEmptyMultihexLines() || item->IsNonEmptyMultihexMesh()) {
         vector<mpos> multihex_entries;
@@ -290,7 +318,7 @@ void Map::SetItem(Item* item)
             auto& multihex_field = _hexField->GetCellForWriting(multihex);
 
             if (vec_safe_add_unique_value(multihex_field.Items, item)) {
-                RecacheHexFlags(multihex_field);
+                RecacheHexFlags(multihex, multihex_field);
                 multihex_entries.emplace_back(multihex);
             }
         });
@@ -300,12 +328,16 @@ void Map::SetItem(Item* item)
                 auto& multihex_field = _hexField->GetCellForWriting(multihex);
 
                 if (vec_safe_add_unique_value(multihex_field.Items, item)) {
-                    RecacheHexFlags(multihex_field);
+                    RecacheHexFlags(multihex, multihex_field);
                     multihex_entries.emplace_back(multihex);
                 }
             }
         }
 
+        for (const auto multihex : multihex_entries) {
+            _itemsSpatial->Add(item, multihex);
+        }
+
         if (!multihex_entries.empty()) {
             item->SetMultihexEntries(std::move(multihex_entries));
         }
@@ -316,22 +348,20 @@ void Map::RemoveItem(ident_t item_id)
 {
     FO_STACK_TRACE_ENTRY();
 
-    Item* item;
-
-    {
-        FO_RUNTIME_ASSERT(item_id);
-        const auto it = _itemsMap.find(item_id);
-        FO_RUNTIME_ASSERT(it != _itemsMap.end());
-        item = it->second.get();
-        _itemsMap.erase(it);
-    }
+    FO_RUNTIME_ASSERT(item_id);
+    auto* item = _itemsMap.find(item_id);
+    FO_RUNTIME_ASSERT(item);
+    _itemsMap.erase(item_id);
 
     vec_remove_unique_value(_items, item);
+    _itemsRevision++;
 
     const auto hex = item->GetHex();
     auto& field = _hexField->GetCellForWriting(hex);
 
     vec_remove_unique_value(field.Items, item);
+    _itemsSpatial->Remove(item, hex);
+    vec_safe_remove_unique_value(_farViewItems, item);
 
     item->SetOwnership(ItemOwnership::Nowhere);
     item->SetMapId(ident_t {});
@@ -341,13 +371,14 @@ void Map::RemoveItem(ident_t item_id)
     vec_remove_unique_value(item_ids, item->GetId());
     SetItemIds(item_ids);
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 
     if (item->HasMultihexEntries()) {
         for (const auto multihex : item->GetMultihexEntries()) {
             auto& multihex_field = _hexField->GetCellForWriting(multihex);
             vec_remove_unique_value(multihex_field.Items, item);
-            RecacheHexFlags(multihex_field);
+            RecacheHexFlags(multihex, multihex_field);
+            _itemsSpatial->Remove(item, multihex);
         }
 
         item->SetMultihexEntries({});
@@ -408,6 +439,11 @@ auto Map::IsHexShootable(mpos hex) const noexcept -> bool
 {
     FO_NO_STACK_TRACE_ENTRY();
 
+    // Nothing blocks shoot around, skip per hex lookups
+    if (_shootBlockedChunks.IsEmpty(hex) && _staticMap->ShootBlockedChunks.IsEmpty(hex)) {
+        return true;
+    }
+
     const auto& field = _hexField->GetCellForReading(hex);
     const auto& static_field = _staticMap->HexField->GetCellForReading(hex);
 
@@ -448,10 +484,188 @@ auto Map::IsHexesMovable(mpos hex, int32 radius, Critter* ignore_cr) -> bool
     return IsHexesMovable(hex, radius);
 }
 
+void Map::UpdateFarViewItem(Item* item)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Traps included regardless of look checks, trap value may shift their view distance
+    if (item->GetAlwaysView() || item->GetIsTrap()) {
+        vec_safe_add_unique_value(_farViewItems, item);
+    }
+    else {
+        vec_safe_remove_unique_value(_farViewItems, item);
+    }
+}
+
+auto Map::IsHexMovableIgnoreCritters(mpos hex) const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto& field = _hexField->GetCellForReading(hex);
+    const auto& static_field = _staticMap->HexField->GetCellForReading(hex);
+
+    return !field.TerrainBlocked && !static_field.MoveBlocked;
+}
+
+auto Map::IsHexesMovableIgnoreCritters(mpos hex, int32 radius) const -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto hexes_around = GeometryHelper::HexesInRadius(radius);
+
+    for (int32 i = 0; i < hexes_around; i++) {
+        if (auto check_hex = hex; GeometryHelper::MoveHexAroundAway(check_hex, i, _mapSize)) {
+            if (!IsHexMovableIgnoreCritters(check_hex)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+auto Map::GetPathFlowField(mpos target_hex, int32 multihex, int32 cut) noexcept -> PathFlowField*
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Drop outdated fields on the way
+    std::erase_if(_pathFlowFields, [this](auto&& flow_field) { return flow_field->TerrainRevision != _terrainRevision; });
+
+    for (auto& flow_field : _pathFlowFields) {
+        if (flow_field->TargetHex == target_hex && flow_field->Multihex == multihex && flow_field->Cut == cut) {
+            return flow_field.get();
+        }
+    }
+
+    return nullptr;
+}
+
+auto Map::AddPathFlowField(unique_ptr<PathFlowField> flow_field) -> PathFlowField*
+{
+    FO_STACK_TRACE_ENTRY();
+
+    constexpr size_t max_flow_fields = 8;
+
+    FO_RUNTIME_ASSERT(flow_field->TerrainRevision == _terrainRevision);
+
+    // Same key field replaced by wider one, otherwise oldest one evicted
+    std::erase_if(_pathFlowFields, [&](auto&& other) { return other->TargetHex == flow_field->TargetHex && other->Multihex == flow_field->Multihex && other->Cut == flow_field->Cut; });
+
+    if (_pathFlowFields.size() >= max_flow_fields) {
+        _pathFlowFields.erase(_pathFlowFields.begin());
+    }
+
+    return _pathFlowFields.emplace_back(std::move(flow_field)).get();
+}
+
+auto Map::CanPathExist(mpos from_hex, mpos to_hex, int32 cut, int32 multihex, int32 max_path_len) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto& regions = GetPathRegions(multihex);
+
+    // Start hex itself may be impassable, search goes to its neighbors anyway
+    array<uint32, GameSettings::MAP_DIR_COUNT + 1> from_labels {};
+    from_labels[0] = regions.GetLabel(from_hex);
+
+    for (int32 dir = 0; dir < GameSettings::MAP_DIR_COUNT; dir++) {
+        if (auto near_hex = from_hex; GeometryHelper::MoveHexByDir(near_hex, static_cast<uint8>(dir), _mapSize)) {
+            from_labels[dir + 1] = regions.GetLabel(near_hex);
+        }
+    }
+
+    const auto cut_hexes = GeometryHelper::HexesInRadius(cut);
+
+    for (int32 i = 0; i < cut_hexes; i++) {
+        if (auto goal_hex = to_hex; GeometryHelper::MoveHexAroundAway(goal_hex, i, _mapSize)) {
+            if (const auto label = regions.GetLabel(goal_hex); label != 0 && std::ranges::find(from_labels, label) != from_labels.end()) {
+                return true;
+            }
+        }
+    }
+
+    // Search over big area runs out of path length limit before it finds out there is no way, keep its result
+    int32 reachable_hexes = 1;
+
+    for (size_t i = 0; i < from_labels.size(); i++) {
+        if (from_labels[i] != 0 && std::find(from_labels.begin(), from_labels.begin() + numeric_cast<ptrdiff_t>(i), from_labels[i]) == from_labels.begin() + numeric_cast<ptrdiff_t>(i)) {
+            reachable_hexes += regions.GetRegionSize(from_labels[i]);
+        }
+    }
+
+    return reachable_hexes >= max_path_len;
+}
+
+auto Map::GetPathRegions(int32 multihex) -> PathRegions&
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Full relabel only to split areas after churn settles down
+    constexpr size_t settle_queries = 32;
+
+    const auto hexes_around = GeometryHelper::HexesInRadius(multihex);
+
+    const auto is_passable = [&](mpos hex) -> bool {
+        // Gag items may be opened
+        if (_hexField->GetCellForReading(hex).HasGagItem) {
+            return true;
+        }
+
+        for (int32 i = 0; i < hexes_around; i++) {
+            if (auto check_hex = hex; GeometryHelper::MoveHexAroundAway(check_hex, i, _mapSize) && IsHexSolid(check_hex)) {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    auto& entry = _pathRegions[multihex];
+    const auto changes_end = _solidChangesBase + _solidChanges.size();
+
+    if (entry.Regions.IsEmpty() || entry.AppliedChanges < _solidChangesBase) {
+        entry.Regions.Relabel(_mapSize, is_passable);
+        entry.QueriesSinceChange = 0;
+    }
+    else if (entry.AppliedChanges != changes_end) {
+        for (size_t i = entry.AppliedChanges - _solidChangesBase; i < _solidChanges.size(); i++) {
+            entry.Regions.Update(_solidChanges[i], multihex, is_passable);
+        }
+
+        entry.QueriesSinceChange = 0;
+    }
+    else if (entry.Regions.GetPendingSplits() != 0 && ++entry.QueriesSinceChange >= settle_queries) {
+        entry.Regions.Relabel(_mapSize, is_passable);
+        entry.QueriesSinceChange = 0;
+    }
+
+    entry.AppliedChanges = changes_end;
+
+    // Drop changes applied everywhere
+    if (std::ranges::all_of(_pathRegions, [&](auto&& other) { return other.second.AppliedChanges == changes_end; })) {
+        _solidChangesBase = changes_end;
+        _solidChanges.clear();
+    }
+
+    return entry.Regions;
+}
+
+auto Map::IsHexSolid(mpos hex) const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto& field = _hexField->GetCellForReading(hex);
+    const auto& static_field = _staticMap->HexField->GetCellForReading(hex);
+
+    return (static_field.MoveBlocked || field.TerrainBlocked) && !field.HasGagItem;
+}
+
 void Map::ChangeViewItem(Item* item)
 {
     FO_STACK_TRACE_ENTRY();
 
+    UpdateFarViewItem(item);
+
     for (auto* cr : copy_hold_ref(GetCritters())) {
         if (cr->IsDestroyed()) {
             continue;
@@ -546,9 +760,7 @@ auto Map::GetItem(ident_t item_id) noexcept -> Item*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    const auto it = _itemsMap.find(item_id);
-
-    return it != _itemsMap.end() ? it->second.get() : nullptr;
+    return _itemsMap.find(item_id);
 }
 
 auto Map::GetItemOnHex(mpos hex, hstring item_pid, Critter* picker) -> Item*
@@ -609,24 +821,19 @@ auto Map::GetItemsInRadius(mpos hex, int32 radius) -> vector<raw_ptr<Item>>
 {
     FO_STACK_TRACE_ENTRY();
 
-    const auto hexes_around = GeometryHelper::HexesInRadius(radius);
-
     vector<raw_ptr<Item>> items;
-    items.reserve(numeric_cast<size_t>(hexes_around) * 2);
-
-    for (int32 i = 0; i < hexes_around; i++) {
-        if (mpos next_hex = hex; GeometryHelper::MoveHexAroundAway(next_hex, i, _mapSize)) {
-            const auto& field = _hexField->GetCellForReading(next_hex);
 
-            if (!field.Items.empty()) {
-                auto& field2 = _hexField->GetCellForWriting(hex);
+    _itemsSpatial->ForEachInRadius(hex, radius, [&](Item* item, mpos item_hex) {
+        ignore_unused(item_hex);
 
-                for (auto& item : field2.Items) {
-                    vec_safe_add_unique_value(items, item.get());
-                }
-            }
+        // Only multihex items may meet several times
+        if (!item->HasMultihexEntries()) {
+            items.emplace_back(item);
         }
-    }
+        else {
+            vec_safe_add_unique_value(items, item);
+        }
+    });
 
     return items;
 }
@@ -672,13 +879,18 @@ void Map::RecacheHexFlags(mpos hex)
 
     auto& field = _hexField->GetCellForWriting(hex);
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 }
 
-void Map::RecacheHexFlags(Field& field)
+void Map::RecacheHexFlags(mpos hex, Field& field)
 {
     FO_STACK_TRACE_ENTRY();
 
+    const auto was_shoot_blocked = field.ShootBlocked;
+    const auto was_terrain_blocked = field.TerrainBlocked;
+    const auto was_gag_item = field.HasGagItem;
+    const auto was_solid = was_terrain_blocked && !was_gag_item;
+
     field.HasCritter = false;
     field.HasBlockCritter = false;
     field.HasGagItem = false;
@@ -710,7 +922,28 @@ void Map::RecacheHexFlags(Field& field)
     }
 
     field.ShootBlocked = field.HasNoShootItem || (field.ManualBlock && field.ManualBlockFull);
-    field.MoveBlocked = field.ShootBlocked || field.HasNoMoveItem || field.HasBlockCritter || field.ManualBlock;
+    field.TerrainBlocked = field.ShootBlocked || field.HasNoMoveItem || field.ManualBlock;
+    field.MoveBlocked = field.TerrainBlocked || field.HasBlockCritter;
+
+    _shootBlockedChunks.Update(hex, was_shoot_blocked, field.ShootBlocked);
+
+    const auto is_solid = field.TerrainBlocked && !field.HasGagItem;
+
+    // Gags are part of terrain for path flow fields
+    if (field.TerrainBlocked != was_terrain_blocked || field.HasGagItem != was_gag_item) {
+        _terrainRevision++;
+    }
+    if (is_solid != was_solid) {
+        constexpr size_t max_solid_changes = 4096;
+
+        // Regions that lag behind whole log are relabeled instead
+        if (_pathRegions.empty() || _solidChanges.size() >= max_solid_changes) {
+            _solidChangesBase += _solidChanges.size();
+            _solidChanges.clear();
+        }
+
+        _solidChanges.emplace_back(hex);
+    }
 }
 
 void Map::SetHexManualBlock(mpos hex, bool enable, bool full)
@@ -722,7 +955,7 @@ void Map::SetHexManualBlock(mpos hex, bool enable, bool full)
     field.ManualBlock = enable;
     field.ManualBlockFull = full;
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 }
 
 auto Map::IsCritterOnHex(mpos hex, CritterFindType find_type) const -> bool
@@ -767,11 +1000,7 @@ auto Map::GetCritter(ident_t cr_id) noexcept -> Critter*
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (const auto it = _crittersMap.find(cr_id); it != _crittersMap.end()) {
-        return it->second.get();
-    }
-
-    return nullptr;
+    return _crittersMap.find(cr_id);
 }
 
 auto Map::GetCritterOnHex(mpos hex, CritterFindType find_type) noexcept -> Critter*
@@ -872,15 +1101,17 @@ auto Map::GetStaticItems(hstring pid) -> vector<StaticItem*>
 {
     FO_STACK_TRACE_ENTRY();
 
-    vector<StaticItem*> items;
+    if (!pid) {
+        return vec_transform(_staticMap->StaticItems, [](auto&& item) -> StaticItem* { return item.get(); });
+    }
 
-    for (auto& item : _staticMap->StaticItems) {
-        if (!pid || item->GetProtoId() == pid) {
-            items.emplace_back(item.get());
-        }
+    const auto it = _staticMap->StaticItemsByPid.find(pid);
+
+    if (it == _staticMap->StaticItemsByPid.end()) {
+        return {};
     }
 
-    return items;
+    return vec_transform(it->second, [](auto&& item) -> StaticItem* { return item.get(); });
 }
 
 auto Map::GetStaticItemsOnHex(mpos hex) noexcept -> span<raw_ptr<StaticItem>>
@@ -902,12 +1133,13 @@ auto Map::GetStaticItemsInRadius(mpos hex, int32 radius, hstring pid) -> vector<
 
     vector<StaticItem*> items;
 
-    // Todo: optimize items radius search by checking directly hexes in radius
-    for (auto& item : _staticMap->StaticItems) {
-        if ((!pid || item->GetProtoId() == pid) && GeometryHelper::GetDistance(item->GetHex(), hex) <= radius) {
-            items.emplace_back(item.get());
+    _staticMap->StaticItemsSpatial->ForEachInRadius(hex, radius, [&](StaticItem* item, mpos item_hex) {
+        ignore_unused(item_hex);
+
+        if (!pid || item->GetProtoId() == pid) {
+            items.emplace_back(item);
         }
-    }
+    });
 
     return items;
 }
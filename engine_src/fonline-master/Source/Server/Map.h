@@ -36,9 +36,13 @@
 #include "Common.h"
 
 #include "EntityProperties.h"
+#include "EntityProtoRegistry.h"
 #include "EntityProtos.h"
 #include "Geometry.h"
+#include "HexChunkCounter.h"
+#include "HexSpatialIndex.h"
 #include "MapLoader.h"
+#include "PathFinding.h"
 #include "ScriptSystem.h"
 #include "ServerEntity.h"
 #include "TwoDimensionalGrid.h"
@@ -61,16 +65,19 @@ struct StaticMap
         vector<raw_ptr<StaticItem>> TriggerItems {};
     };
 
-    unique_ptr<TwoDimensionalGrid<Field, mpos, msize>> HexField {};
+    unique_ptr<DynamicTwoDimensionalGrid<Field, mpos, msize>> HexField {};
     vector<pair<ident_t, refcount_ptr<Critter>>> CritterBillets {};
     vector<pair<ident_t, refcount_ptr<Item>>> ItemBillets {};
     vector<pair<ident_t, raw_ptr<Item>>> HexItemBillets {};
     vector<pair<ident_t, raw_ptr<Item>>> ChildItemBillets {};
     vector<raw_ptr<StaticItem>> StaticItems {};
     unordered_map<ident_t, raw_ptr<StaticItem>> StaticItemsById {};
+    unordered_map<hstring, vector<raw_ptr<StaticItem>>> StaticItemsByPid {};
+    unique_ptr<HexSpatialIndex<StaticItem>> StaticItemsSpatial {};
+    HexChunkCounter ShootBlockedChunks {}; // Lets traces skip hex lookups in open areas
 };
 
-class Map final : public ServerEntity, public EntityWithProto, public MapProperties
+class Map final : public ServerEntity, public EntityWithProto, public MapProperties, public PooledAllocation<Map>
 {
 public:
     Map() = delete;
@@ -85,6 +92,7 @@ public:
     [[nodiscard]] auto GetStaticMap() const noexcept -> const StaticMap* { return _staticMap.get(); }
     [[nodiscard]] auto GetProtoMap() const noexcept -> const ProtoMap* { return static_cast<const ProtoMap*>(_proto.get()); }
     [[nodiscard]] auto GetLocation() noexcept -> Location* { return _mapLocation.get(); }
+    [[nodiscard]] auto GetMemoryUsage() const noexcept -> size_t;
     [[nodiscard]] auto GetLocation() const noexcept -> const Location* { return _mapLocation.get(); }
     [[nodiscard]] auto IsHexMovable(mpos hex) const noexcept -> bool;
     [[nodiscard]] auto IsHexShootable(mpos hex) const noexcept -> bool;
@@ -98,8 +106,11 @@ public:
     [[nodiscard]] auto GetGagItemOnHex(mpos hex) const noexcept -> const Item*;
     [[nodiscard]] auto HasItems() const noexcept -> bool { return !_items.empty(); }
     [[nodiscard]] auto GetItems() noexcept -> span<raw_ptr<Item>> { return _items; }
+    [[nodiscard]] auto IterateItems() noexcept -> epoch_map<ident_t, Item>::iteration { return _itemsMap.iterate(); }
     [[nodiscard]] auto GetItemsOnHex(mpos hex) noexcept -> span<raw_ptr<Item>>;
     [[nodiscard]] auto GetItemsInRadius(mpos hex, int32 radius) -> vector<raw_ptr<Item>>;
+    [[nodiscard]] auto GetItemsSpatial() noexcept -> HexSpatialIndex<Item>& { return *_itemsSpatial; }
+    [[nodiscard]] auto GetFarViewItems() noexcept -> span<raw_ptr<Item>> { return _farViewItems; }
     [[nodiscard]] auto GetTriggerItemsOnHex(mpos hex) -> vector<Item*>;
     [[nodiscard]] auto IsValidPlaceForItem(mpos hex, const ProtoItem* proto_item) const -> bool;
     [[nodiscard]] auto FindStartHex(mpos hex, int32 multihex, int32 seek_radius, bool skip_unsafe) const -> optional<mpos>;
@@ -109,6 +120,7 @@ public:
     [[nodiscard]] auto GetCritterOnHex(mpos hex, CritterFindType find_type) noexcept -> Critter*;
     [[nodiscard]] auto HasCritters() const noexcept -> bool { return !_critters.empty(); }
     [[nodiscard]] auto GetCritters() noexcept -> span<raw_ptr<Critter>> { return _critters; }
+    [[nodiscard]] auto IterateCritters() noexcept -> epoch_map<ident_t, Critter>::iteration { return _crittersMap.iterate(); }
     [[nodiscard]] auto GetCrittersOnHex(mpos hex, CritterFindType find_type) -> vector<Critter*>;
     [[nodiscard]] auto GetCrittersInRadius(mpos hex, int32 radius, CritterFindType find_type) -> vector<Critter*>;
     [[nodiscard]] auto GetPlayerCritters() noexcept -> span<raw_ptr<Critter>> { return _playerCritters; }
@@ -122,6 +134,13 @@ public:
     [[nodiscard]] auto GetStaticItemsInRadius(mpos hex, int32 radius, hstring pid) -> vector<StaticItem*>;
     [[nodiscard]] auto GetTriggerStaticItemsOnHex(mpos hex) noexcept -> span<raw_ptr<StaticItem>>;
     [[nodiscard]] auto IsOutsideArea(mpos hex) const -> bool;
+    [[nodiscard]] auto IsHexMovableIgnoreCritters(mpos hex) const noexcept -> bool;
+    [[nodiscard]] auto IsHexesMovableIgnoreCritters(mpos hex, int32 radius) const -> bool;
+    [[nodiscard]] auto GetTerrainRevision() const noexcept -> uint32 { return _terrainRevision; }
+    [[nodiscard]] auto GetCrittersRevision() const noexcept -> uint32 { return _crittersRevision; }
+    [[nodiscard]] auto GetItemsRevision() const noexcept -> uint32 { return _itemsRevision; }
+    [[nodiscard]] auto GetPathFlowField(mpos target_hex, int32 multihex, int32 cut) noexcept -> PathFlowField*;
+    [[nodiscard]] auto CanPathExist(mpos from_hex, mpos to_hex, int32 cut, int32 multihex, int32 max_path_len) -> bool;
 
     void SetLocation(Location* loc) noexcept;
     void AddCritter(Critter* cr);
@@ -135,6 +154,7 @@ public:
     void AddCritterToField(Critter* cr);
     void RemoveCritterFromField(Critter* cr);
     void RecacheHexFlags(mpos hex);
+    auto AddPathFlowField(unique_ptr<PathFlowField> flow_field) -> PathFlowField*;
 
     ///@ ExportEvent
     FO_ENTITY_EVENT(OnFinish);
@@ -143,6 +163,8 @@ public:
     ///@ ExportEvent
     FO_ENTITY_EVENT(OnCheckTrapLook, Critter* /*cr*/, Item* /*item*/);
 
+    EntityProtoHook<Map> ProtoHook {};
+
 private:
     struct Field
     {
@@ -152,26 +174,49 @@ private:
         bool HasTriggerItem {};
         bool HasNoMoveItem {};
         bool HasNoShootItem {};
+        bool TerrainBlocked {};
         bool MoveBlocked {};
         bool ShootBlocked {};
-        vector<raw_ptr<Critter>> Critters {};
-        vector<raw_ptr<Item>> Items {};
+        small_vector<raw_ptr<Critter>, 1> Critters {};
+        small_vector<raw_ptr<Item>, 2> Items {};
         bool ManualBlock {};
         bool ManualBlockFull {};
     };
 
+    // Regions for some multihex size and count of solid hex changes already applied to them
+    struct PathRegionsEntry
+    {
+        PathRegions Regions {};
+        size_t AppliedChanges {};
+        size_t QueriesSinceChange {};
+    };
+
+    [[nodiscard]] auto GetPathRegions(int32 multihex) -> PathRegions&;
+    [[nodiscard]] auto IsHexSolid(mpos hex) const noexcept -> bool;
+
     void SetMultihexCritter(Critter* cr, bool set);
-    void RecacheHexFlags(Field& field);
+    void RecacheHexFlags(mpos hex, Field& field);
+    void UpdateFarViewItem(Item* item);
 
     raw_ptr<StaticMap> _staticMap {};
     msize _mapSize {};
-    unique_ptr<TwoDimensionalGrid<Field, mpos, msize>> _hexField {};
+    unique_ptr<DynamicTwoDimensionalGrid<Field, mpos, msize>> _hexField {};
+    unique_ptr<HexSpatialIndex<Item>> _itemsSpatial {};
+    HexChunkCounter _shootBlockedChunks {};
+    uint32 _terrainRevision {};
+    uint32 _crittersRevision {};
+    uint32 _itemsRevision {};
+    vector<mpos> _solidChanges {};
+    size_t _solidChangesBase {};
+    unordered_map<int32, PathRegionsEntry> _pathRegions {};
+    vector<unique_ptr<PathFlowField>> _pathFlowFields {};
     vector<raw_ptr<Critter>> _critters {};
-    unordered_map<ident_t, raw_ptr<Critter>> _crittersMap {};
+    epoch_map<ident_t, Critter> _crittersMap {};
     vector<raw_ptr<Critter>> _playerCritters {};
     vector<raw_ptr<Critter>> _nonPlayerCritters {};
     vector<raw_ptr<Item>> _items {};
-    unordered_map<ident_t, raw_ptr<Item>> _itemsMap {};
+    epoch_map<ident_t, Item> _itemsMap {};
+    vector<raw_ptr<Item>> _farViewItems {}; // Visibility not bounded by look distance (always view items and traps)
     raw_ptr<Location> _mapLocation {};
 };
 
@@ -67,13 +67,14 @@ void MapManager::LoadFromResources()
             auto static_map = SafeAlloc::MakeUnique<StaticMap>();
             const auto map_size = map_proto->GetSize();
 
+            static_map->HexField = SafeAlloc::MakeUnique<DynamicTwoDimensionalGrid<StaticMap::Field, mpos, msize>>(map_size);
+
             if (_engine->Settings.ProtoMapStaticGrid) {
-                static_map->HexField = SafeAlloc::MakeUnique<StaticTwoDimensionalGrid<StaticMap::Field, mpos, msize>>(map_size);
-            }
-            else {
-                static_map->HexField = SafeAlloc::MakeUnique<DynamicTwoDimensionalGrid<StaticMap::Field, mpos, msize>>(map_size);
+                static_map->HexField->Preallocate();
             }
 
+            static_map->StaticItemsSpatial = SafeAlloc::MakeUnique<HexSpatialIndex<StaticItem>>(map_size);
+
             // Read hashes
             {
                 const auto hashes_count = reader.Read<uint32>();
@@ -182,6 +183,8 @@ void MapManager::LoadFromResources()
                             FO_RUNTIME_ASSERT(item->GetOwnership() == ItemOwnership::MapHex);
                             static_map->StaticItems.emplace_back(item.get());
                             static_map->StaticItemsById.emplace(item_id, item.get());
+                            static_map->StaticItemsByPid[item->GetProtoId()].emplace_back(item.get());
+                            static_map->StaticItemsSpatial->Add(item.get(), item->GetHex());
 
                             const auto add_item_to_field = [item = item.get()](StaticMap::Field& static_field) {
                                 if (!vec_exists(static_field.StaticItems, item)) {
@@ -259,6 +262,19 @@ void MapManager::LoadFromResources()
                 }
             }
 
+            // Shoot blocks
+            static_map->ShootBlockedChunks = HexChunkCounter(map_size);
+
+            for (const auto hx : iterate_range(map_size.width)) {
+                for (const auto hy : iterate_range(map_size.height)) {
+                    const mpos hex = {hx, hy};
+
+                    if (static_map->HexField->GetCellForReading(hex).ShootBlocked) {
+                        static_map->ShootBlockedChunks.Add(hex);
+                    }
+                }
+            }
+
             static_map->CritterBillets.shrink_to_fit();
             static_map->ItemBillets.shrink_to_fit();
             static_map->HexItemBillets.shrink_to_fit();
@@ -482,34 +498,18 @@ auto MapManager::GetMapByPid(hstring map_pid, int32 skip_count) noexcept -> Map*
 {
     FO_STACK_TRACE_ENTRY();
 
-    for (auto& map : _engine->EntityMngr.GetMaps() | std::views::values) {
-        if (map->GetProtoId() == map_pid) {
-            if (skip_count <= 0) {
-                return map.get();
-            }
+    _engine->EntityMngr.EnsureProtoLoaded(map_pid);
 
-            skip_count--;
-        }
-    }
-
-    return nullptr;
+    return _engine->EntityMngr.GetMapByProto(map_pid, numeric_cast<size_t>(std::max(skip_count, 0)));
 }
 
 auto MapManager::GetLocationByPid(hstring loc_pid, int32 skip_count) noexcept -> Location*
 {
     FO_STACK_TRACE_ENTRY();
 
-    for (auto& loc : _engine->EntityMngr.GetLocations() | std::views::values) {
-        if (loc->GetProtoId() == loc_pid) {
-            if (skip_count <= 0) {
-                return loc.get();
-            }
-
-            skip_count--;
-        }
-    }
+    _engine->EntityMngr.EnsureProtoLoaded(loc_pid);
 
-    return nullptr;
+    return _engine->EntityMngr.GetLocationByProto(loc_pid, numeric_cast<size_t>(std::max(skip_count, 0)));
 }
 
 void MapManager::DestroyLocation(Location* loc)
@@ -550,7 +550,7 @@ void MapManager::DestroyLocation(Location* loc)
     }
 
     loc->MarkAsDestroyed();
-    _engine->EntityMngr.UnregisterLocation(loc);
+    _engine->EntityMngr.UnregisterLocation(loc, true);
 }
 
 void MapManager::DestroyMap(Map* map)
@@ -591,7 +591,7 @@ void MapManager::DestroyMapInternal(Map* map)
     }
 
     map->MarkAsDestroyed();
-    _engine->EntityMngr.UnregisterMap(map);
+    _engine->EntityMngr.UnregisterMap(map, true);
 }
 
 auto MapManager::TracePath(TracePathInput& input) const -> TracePathOutput
@@ -721,246 +721,26 @@ auto MapManager::FindPath(FindPathInput& input) const -> FindPathOutput
         }
     }
 
+    // Target lies in other closed area, don't flood whole search area to find it out
+    if (!map->CanPathExist(input.FromHex, input.ToHex, input.Cut, input.Multihex, _engine->Settings.MaxPathFindLength)) {
+        output.Result = FindPathOutput::ResultType::NoWay;
+        return output;
+    }
+
     // Prepare grid
     const auto max_path_find_len = _engine->Settings.MaxPathFindLength;
-    auto path_find_grid = vector<int16>(numeric_cast<size_t>(max_path_find_len * 2 + 2) * (max_path_find_len * 2 + 2));
+    vector<int16> path_find_grid;
     const auto grid_offset = input.FromHex;
     const auto grid_at = [&](mpos hex) -> int16& { return path_find_grid[((max_path_find_len + 1) + hex.y - grid_offset.y) * (max_path_find_len * 2 + 2) + ((max_path_find_len + 1) + hex.x - grid_offset.x)]; };
 
-    vector<mpos> next_hexes;
-    vector<mpos> cr_hexes;
-    vector<mpos> gag_hexes;
-    next_hexes.reserve(1024);
-    cr_hexes.reserve(64);
-    gag_hexes.reserve(64);
-
-    // Begin search
     auto to_hex = input.ToHex;
-    grid_at(input.FromHex) = 1;
-    next_hexes.emplace_back(input.FromHex);
-
-    while (true) {
-        bool find_ok = false;
-        const auto next_hexes_round = next_hexes.size();
-        FO_RUNTIME_ASSERT(next_hexes_round != 0);
-
-        for (size_t i = 0; i < next_hexes_round; i++) {
-            const auto cur_hex = next_hexes[i];
-
-            if (GeometryHelper::CheckDist(cur_hex, to_hex, input.Cut)) {
-                to_hex = cur_hex;
-                find_ok = true;
-                break;
-            }
-
-            const auto next_hex_index = numeric_cast<int16>(grid_at(cur_hex) + 1);
-
-            if (next_hex_index > _engine->Settings.MaxPathFindLength) {
-                output.Result = FindPathOutput::ResultType::TooFar;
-                return output;
-            }
-
-            for (int32 j = 0; j < GameSettings::MAP_DIR_COUNT; j++) {
-                auto raw_next_hex = ipos32 {cur_hex.x, cur_hex.y};
-                GeometryHelper::MoveHexByDirUnsafe(raw_next_hex, static_cast<uint8>(j));
-
-                if (!map_size.is_valid_pos(raw_next_hex)) {
-                    continue;
-                }
-
-                const auto next_hex = map_size.from_raw_pos(raw_next_hex);
-                auto& grid_cell = grid_at(next_hex);
-
-                if (grid_cell != 0) {
-                    continue;
-                }
-
-                if (map->IsHexesMovable(next_hex, input.Multihex, input.FromCritter.get())) {
-                    next_hexes.emplace_back(next_hex);
-                    grid_cell = next_hex_index;
-                }
-                else if (input.CheckGagItems && map->IsGagItemOnHex(next_hex)) {
-                    gag_hexes.emplace_back(next_hex);
-                    grid_cell = numeric_cast<int16>(next_hex_index | 0x4000);
-                }
-                else if (input.CheckCritter && map->IsCritterOnHex(next_hex, CritterFindType::NonDead)) {
-                    cr_hexes.emplace_back(next_hex);
-                    grid_cell = numeric_cast<int16>(next_hex_index | 0x4000);
-                }
-                else {
-                    grid_cell = -1;
-                }
-            }
-        }
-
-        if (find_ok) {
-            break;
-        }
-
-        next_hexes.erase(next_hexes.begin(), next_hexes.begin() + static_cast<ptrdiff_t>(next_hexes_round));
-
-        // Add gag hex after some distance
-        if (!gag_hexes.empty()) {
-            const auto last_index = grid_at(next_hexes.back());
-            const auto& gag_hex = gag_hexes.front();
-            const auto gag_index = numeric_cast<int16>(grid_at(gag_hex) ^ 0x4000);
-
-            if (gag_index + 10 < last_index) { // Todo: if path finding not be reworked than migrate magic number to scripts
-                grid_at(gag_hex) = gag_index;
-                next_hexes.emplace_back(gag_hex);
-                gag_hexes.erase(gag_hexes.begin());
-            }
-        }
-
-        // If no way then route through gag/critter
-        if (next_hexes.empty()) {
-            if (!gag_hexes.empty()) {
-                auto& gag_hex = gag_hexes.front();
-                grid_at(gag_hex) ^= 0x4000;
-                next_hexes.emplace_back(gag_hex);
-                gag_hexes.erase(gag_hexes.begin());
-            }
-            else if (!cr_hexes.empty()) {
-                auto& cr_hex = cr_hexes.front();
-                grid_at(cr_hex) ^= 0x4000;
-                next_hexes.emplace_back(cr_hex);
-                cr_hexes.erase(cr_hexes.begin());
-            }
-        }
-
-        if (next_hexes.empty()) {
-            output.Result = FindPathOutput::ResultType::NoWay;
-            return output;
-        }
-    }
-
     vector<uint8> raw_steps;
-    auto hex_index = grid_at(to_hex);
-    auto cur_hex = to_hex;
-    raw_steps.resize(hex_index - 1);
-    float32 base_angle = GeometryHelper::GetDirAngle(to_hex, input.FromHex);
-
-    while (hex_index > 1) {
-        hex_index--;
-
-        const auto find_path_grid = [&](mpos& hex) -> bool {
-            int32 best_step_dir = -1;
-            float32 best_step_angle_diff = 0.0f;
-
-            const auto check_hex = [&](int32 dir, ipos32 step_raw_hex) {
-                if (!map_size.is_valid_pos(step_raw_hex)) {
-                    return;
-                }
-
-                const auto step_hex = map_size.from_raw_pos(step_raw_hex);
-
-                if (grid_at(step_hex) != hex_index) {
-                    return;
-                }
-
-                const float32 angle = GeometryHelper::GetDirAngle(step_hex, input.FromHex);
-                const float32 angle_diff = GeometryHelper::GetDirAngleDiff(base_angle, angle);
-
-                if (best_step_dir == -1 || hex_index == 0) {
-                    best_step_dir = dir;
-                    best_step_angle_diff = GeometryHelper::GetDirAngleDiff(base_angle, angle);
-                }
-                else if (angle_diff < best_step_angle_diff) {
-                    best_step_dir = dir;
-                    best_step_angle_diff = angle_diff;
-                }
-            };
-
-            if ((hex.x % 2) != 0) {
-                check_hex(3, ipos32 {hex.x - 1, hex.y - 1});
-                check_hex(2, ipos32 {hex.x, hex.y - 1});
-                check_hex(5, ipos32 {hex.x, hex.y + 1});
-                check_hex(0, ipos32 {hex.x + 1, hex.y});
-                check_hex(4, ipos32 {hex.x - 1, hex.y});
-                check_hex(1, ipos32 {hex.x + 1, hex.y - 1});
-
-                if (best_step_dir == 3) {
-                    raw_steps[hex_index - 1] = 3;
-                    hex.x--;
-                    hex.y--;
-                    return true;
-                }
-                if (best_step_dir == 2) {
-                    raw_steps[hex_index - 1] = 2;
-                    hex.y--;
-                    return true;
-                }
-                if (best_step_dir == 5) {
-                    raw_steps[hex_index - 1] = 5;
-                    hex.y++;
-                    return true;
-                }
-                if (best_step_dir == 0) {
-                    raw_steps[hex_index - 1] = 0;
-                    hex.x++;
-                    return true;
-                }
-                if (best_step_dir == 4) {
-                    raw_steps[hex_index - 1] = 4;
-                    hex.x--;
-                    return true;
-                }
-                if (best_step_dir == 1) {
-                    raw_steps[hex_index - 1] = 1;
-                    hex.x++;
-                    hex.y--;
-                    return true;
-                }
-            }
-            else {
-                check_hex(3, ipos32 {hex.x - 1, hex.y});
-                check_hex(2, ipos32 {hex.x, hex.y - 1});
-                check_hex(5, ipos32 {hex.x, hex.y + 1});
-                check_hex(0, ipos32 {hex.x + 1, hex.y + 1});
-                check_hex(4, ipos32 {hex.x - 1, hex.y + 1});
-                check_hex(1, ipos32 {hex.x + 1, hex.y});
-
-                if (best_step_dir == 3) {
-                    raw_steps[hex_index - 1] = 3;
-                    hex.x--;
-                    return true;
-                }
-                if (best_step_dir == 2) {
-                    raw_steps[hex_index - 1] = 2;
-                    hex.y--;
-                    return true;
-                }
-                if (best_step_dir == 5) {
-                    raw_steps[hex_index - 1] = 5;
-                    hex.y++;
-                    return true;
-                }
-                if (best_step_dir == 0) {
-                    raw_steps[hex_index - 1] = 0;
-                    hex.x++;
-                    hex.y++;
-                    return true;
-                }
-                if (best_step_dir == 4) {
-                    raw_steps[hex_index - 1] = 4;
-                    hex.x--;
-                    hex.y++;
-                    return true;
-                }
-                if (best_step_dir == 1) {
-                    raw_steps[hex_index - 1] = 1;
-                    hex.x++;
-                    return true;
-                }
-            }
 
-            return false;
-        };
+    // Critters chasing the same target share one search, grid is not filled in this case
+    const auto flow_field_found = input.UseFlowField && !_engine->Settings.MapFreeMovement && FindPathByFlowField(input, raw_steps, to_hex);
 
-        if (!find_path_grid(cur_hex)) {
-            output.Result = FindPathOutput::ResultType::InternalError;
-            return output;
-        }
+    if (!flow_field_found && !FindPathByGrid(input, output, path_find_grid, raw_steps, to_hex)) {
+        return output;
     }
 
     // Check for closed door and critter
@@ -1156,6 +936,108 @@ auto MapManager::FindPath(FindPathInput& input) const -> FindPathOutput
     return output;
 }
 
+auto MapManager::FindPathByGrid(FindPathInput& input, FindPathOutput& output, vector<int16>& path_find_grid, vector<uint8>& raw_steps, mpos& to_hex) const -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto* map = input.TargetMap.get();
+
+    const auto result = PathFinding::SearchGrid(map->GetSize(), input.FromHex, to_hex, input.Cut, _engine->Settings.MaxPathFindLength, path_find_grid, raw_steps, [&](mpos hex) { return GetPathHexType(input, hex); });
+
+    switch (result) {
+    case PathSearchResult::Ok:
+        return true;
+    case PathSearchResult::TooFar:
+        output.Result = FindPathOutput::ResultType::TooFar;
+        return false;
+    case PathSearchResult::NoWay:
+        output.Result = FindPathOutput::ResultType::NoWay;
+        return false;
+    case PathSearchResult::InternalError:
+        output.Result = FindPathOutput::ResultType::InternalError;
+        return false;
+    }
+
+    FO_UNREACHABLE_PLACE();
+}
+
+auto MapManager::FindPathByFlowField(FindPathInput& input, vector<uint8>& raw_steps, mpos& to_hex) const -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto* map = input.TargetMap.get();
+    const auto max_path_find_len = _engine->Settings.MaxPathFindLength;
+    const auto from_dist = GeometryHelper::GetDistance(input.FromHex, input.ToHex);
+
+    if (from_dist > max_path_find_len) {
+        return false;
+    }
+
+    auto* flow_field = map->GetPathFlowField(input.ToHex, input.Multihex, input.Cut);
+
+    if (flow_field == nullptr || !flow_field->IsCovered(input.FromHex)) {
+        const auto radius = std::min(from_dist + std::max(from_dist, 10), max_path_find_len);
+        flow_field = map->AddPathFlowField(BuildPathFlowField(map, input.ToHex, input.Multihex, input.Cut, radius));
+    }
+
+    // Field does not route through gags, so leave such searches to grid
+    if (input.CheckGagItems && flow_field->HasGagHexes) {
+        return false;
+    }
+
+    return PathFinding::WalkFlowField(*flow_field, map->GetSize(), input.FromHex, max_path_find_len, raw_steps, to_hex, [&](mpos hex) { return GetPathHexType(input, hex); });
+}
+
+auto MapManager::BuildPathFlowField(Map* map, mpos target_hex, int32 multihex, int32 cut, int32 radius) const -> unique_ptr<PathFlowField>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto flow_field = SafeAlloc::MakeUnique<PathFlowField>();
+    flow_field->TargetHex = target_hex;
+    flow_field->Multihex = multihex;
+    flow_field->Cut = cut;
+    flow_field->Radius = radius;
+    flow_field->TerrainRevision = map->GetTerrainRevision();
+
+    PathFinding::BuildFlowField(*flow_field, map->GetSize(), _engine->Settings.MaxPathFindLength, [&](mpos hex) { return GetPathTerrainHexType(map, hex, multihex); });
+
+    return flow_field;
+}
+
+auto MapManager::GetPathHexType(FindPathInput& input, mpos hex) const -> PathHexType
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    auto* map = input.TargetMap.get();
+
+    if (map->IsHexesMovable(hex, input.Multihex, input.FromCritter.get())) {
+        return PathHexType::Free;
+    }
+    if (input.CheckGagItems && map->IsGagItemOnHex(hex)) {
+        return PathHexType::Gag;
+    }
+    if (input.CheckCritter && map->IsCritterOnHex(hex, CritterFindType::NonDead)) {
+        return PathHexType::Critter;
+    }
+
+    return PathHexType::Blocked;
+}
+
+auto MapManager::GetPathTerrainHexType(Map* map, mpos hex, int32 multihex) const -> PathHexType
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Same as path hex type with critters removed from map
+    if (map->IsHexesMovableIgnoreCritters(hex, multihex)) {
+        return PathHexType::Free;
+    }
+    if (map->IsGagItemOnHex(hex)) {
+        return PathHexType::Gag;
+    }
+
+    return PathHexType::Blocked;
+}
+
 void MapManager::TransferToMap(Critter* cr, Map* map, mpos hex, uint8 dir, optional<int32> safe_radius)
 {
     FO_STACK_TRACE_ENTRY();
@@ -1181,6 +1063,17 @@ void MapManager::Transfer(Critter* cr, Map* map, mpos hex, uint8 dir, optional<i
         throw GenericException("Critter transfers locked");
     }
 
+    // Target map object may be left from paged out location, so location is reloaded and map is resolved again
+    if (map != nullptr && map->IsDestroyed()) {
+        const auto map_id = map->GetId();
+        _engine->EntityMngr.EnsureLoaded(map_id);
+        map = _engine->EntityMngr.GetMap(map_id);
+
+        if (map == nullptr) {
+            throw GenericException("Transfer to destroyed map", map_id);
+        }
+    }
+
     cr->LockMapTransfers++;
     auto restore_transfers = ScopeCallback([cr]() noexcept { cr->LockMapTransfers--; });
 
@@ -1431,7 +1324,11 @@ void MapManager::ProcessVisibleCritters(Critter* cr)
         auto* map = _engine->EntityMngr.GetMap(map_id);
         FO_RUNTIME_ASSERT(map);
 
-        for (auto* target : copy_hold_ref(map->GetCritters())) {
+        // Map critters are iterated in place, look callbacks may move or destroy any of them
+        refcount_ptr cr_holder = cr;
+        refcount_ptr map_holder = map;
+
+        for (auto* target : map->IterateCritters()) {
             optional<bool> trace_result;
             ProcessCritterLook(map, cr, target, trace_result);
             ProcessCritterLook(map, target, cr, trace_result);
@@ -1618,6 +1515,37 @@ auto MapManager::IsCritterSeeCritter(Map* map, Critter* cr, Critter* target, opt
     return is_see;
 }
 
+void MapManager::ScheduleVisibleItems(Critter* cr)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_scheduledVisibleItemsSet.emplace(cr->GetId()).second) {
+        _scheduledVisibleItems.emplace_back(cr->GetId());
+    }
+}
+
+void MapManager::ProcessScheduledVisibleItems()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_scheduledVisibleItems.empty()) {
+        return;
+    }
+
+    // Swap out to allow rescheduling from script callbacks
+    vector<ident_t> cr_ids;
+    cr_ids.swap(_scheduledVisibleItems);
+    _scheduledVisibleItemsSet.clear();
+
+    for (const auto cr_id : cr_ids) {
+        auto* cr = _engine->EntityMngr.GetCritter(cr_id);
+
+        if (cr != nullptr && !cr->IsDestroyed()) {
+            ProcessVisibleItems(cr);
+        }
+    }
+}
+
 void MapManager::ProcessVisibleItems(Critter* cr)
 {
     FO_STACK_TRACE_ENTRY();
@@ -1637,14 +1565,47 @@ void MapManager::ProcessVisibleItems(Critter* cr)
 
     const auto look = cr->GetLookDistance();
 
-    for (auto* item : copy_hold_ref(map->GetItems())) {
-        if (item->IsDestroyed()) {
+    // Only items around, far view items and already visible ones may change their visibility
+    // Candidates are kept by id, callbacks may remove or destroy any of them
+    vector<ident_t> candidates;
+    unordered_set<ident_t> candidates_set;
+
+    const auto add_candidate = [&](const Item* item) {
+        if (candidates_set.emplace(item->GetId()).second) {
+            candidates.emplace_back(item->GetId());
+        }
+    };
+
+    map->GetItemsSpatial().ForEachInRadius(cr->GetHex(), look, [&](Item* item, mpos item_hex) {
+        ignore_unused(item_hex);
+        add_candidate(item);
+    });
+
+    for (auto& item : map->GetFarViewItems()) {
+        add_candidate(item.get());
+    }
+
+    for (const auto item_id : cr->GetVisibleItems()) {
+        if (candidates_set.emplace(item_id).second) {
+            candidates.emplace_back(item_id);
+        }
+    }
+
+    refcount_ptr cr_holder = cr;
+    refcount_ptr map_holder = map;
+
+    for (const auto item_id : candidates) {
+        auto* item = map->GetItem(item_id);
+
+        if (item == nullptr || item->IsDestroyed()) {
             continue;
         }
         if (item->GetHidden()) {
             continue;
         }
 
+        refcount_ptr item_holder = item;
+
         if (item->GetAlwaysView()) {
             if (cr->AddVisibleItem(item->GetId())) {
                 cr->Send_AddItemOnMap(item);
@@ -63,6 +63,7 @@ struct FindPathInput // Todo: make FindPathInput pointer fields raw_ptr
     int32 TraceDist {};
     bool CheckCritter {};
     bool CheckGagItems {};
+    bool UseFlowField {}; // Share search with other critters moving to the same hex
     raw_ptr<Critter> TraceCr {};
 };
 
@@ -145,10 +146,17 @@ public:
     void TransferToGlobal(Critter* cr, ident_t global_cr_id);
     void ProcessVisibleCritters(Critter* cr);
     void ProcessVisibleItems(Critter* cr);
+    void ScheduleVisibleItems(Critter* cr);
+    void ProcessScheduledVisibleItems();
     void ViewMap(Critter* view_cr, Map* map, int32 look, mpos hex, uint8 dir);
 
 private:
     auto IsCritterSeeCritter(Map* map, Critter* cr, Critter* target, optional<bool>& trace_result) -> bool;
+    auto FindPathByGrid(FindPathInput& input, FindPathOutput& output, vector<int16>& path_find_grid, vector<uint8>& raw_steps, mpos& to_hex) const -> bool;
+    auto FindPathByFlowField(FindPathInput& input, vector<uint8>& raw_steps, mpos& to_hex) const -> bool;
+    auto BuildPathFlowField(Map* map, mpos target_hex, int32 multihex, int32 cut, int32 radius) const -> unique_ptr<PathFlowField>;
+    auto GetPathHexType(FindPathInput& input, mpos hex) const -> PathHexType;
+    auto GetPathTerrainHexType(Map* map, mpos hex, int32 multihex) const -> PathHexType;
 
     void ProcessCritterLook(Map* map, Critter* cr, Critter* target, optional<bool>& trace_result);
     void Transfer(Critter* cr, Map* map, mpos hex, uint8 dir, optional<int32> safe_radius, ident_t global_cr_id);
@@ -158,6 +166,8 @@ private:
 
     raw_ptr<FOServer> _engine;
     unordered_map<const ProtoMap*, unique_ptr<StaticMap>> _staticMaps {};
+    vector<ident_t> _scheduledVisibleItems {};
+    unordered_set<ident_t> _scheduledVisibleItemsSet {};
 };
 
 FO_END_NAMESPACE();
@@ -0,0 +1,643 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "Geometry.h"
+
+FO_BEGIN_NAMESPACE();
+
+// How path search treats hex, grid search and flow fields classify hexes with same map checks
+enum class PathHexType : uint8
+{
+    Free,
+    Gag, // Routed through after detour, closed doors and similar
+    Critter, // Routed through if nothing else left
+    Blocked,
+};
+
+enum class PathSearchResult : uint8
+{
+    Ok,
+    TooFar,
+    NoWay,
+    InternalError,
+};
+
+// Path lengths from every hex around target to hexes within cut distance of it
+// Built ignoring critters and valid until some item or manual block changes map terrain
+struct PathFlowField
+{
+    [[nodiscard]] auto IsCovered(mpos hex) const noexcept -> bool { return std::abs(hex.x - TargetHex.x) <= Radius && std::abs(hex.y - TargetHex.y) <= Radius; }
+    [[nodiscard]] auto GetCell(mpos hex) noexcept -> int16& { return Lengths[numeric_cast<size_t>((hex.y - TargetHex.y + Radius) * (Radius * 2 + 1) + (hex.x - TargetHex.x + Radius))]; }
+
+    mpos TargetHex {};
+    int32 Multihex {};
+    int32 Cut {};
+    int32 Radius {};
+    uint32 TerrainRevision {};
+    bool HasGagHexes {}; // Grid search may route through them, so searches with gag checks fall back to it
+    vector<int16> Lengths {}; // One for goal hexes, zero or less for unreachable ones
+};
+
+// Connected areas of passable hexes, lets path search reject unreachable targets without flooding
+// Areas merge in place when hexes become passable, when hexes become impassable areas are not split
+// and stay joined until full relabel, so joined labels never give false rejection
+class PathRegions final
+{
+public:
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return _labels.empty(); }
+    [[nodiscard]] auto GetPendingSplits() const noexcept -> size_t { return _pendingSplits; }
+    [[nodiscard]] auto GetRegionSize(uint32 label) const noexcept -> int32 { return label != 0 ? _sizes[label] : 0; }
+
+    [[nodiscard]] auto GetLabel(mpos hex) noexcept -> uint32
+    {
+        const auto label = _labels[GetIndex(hex)];
+        return label != 0 ? FindRoot(label) : 0;
+    }
+
+    template<typename F>
+    void Relabel(msize map_size, const F& is_passable);
+
+    // Passability of hexes within radius of changed hex is checked again
+    template<typename F>
+    void Update(mpos changed_hex, int32 radius, const F& is_passable);
+
+private:
+    [[nodiscard]] auto GetIndex(mpos hex) const noexcept -> size_t { return numeric_cast<size_t>(hex.y) * numeric_cast<size_t>(_mapSize.width) + numeric_cast<size_t>(hex.x); }
+
+    [[nodiscard]] auto FindRoot(uint32 label) noexcept -> uint32
+    {
+        while (_parents[label] != label) {
+            _parents[label] = _parents[_parents[label]];
+            label = _parents[label];
+        }
+
+        return label;
+    }
+
+    auto AddLabel() -> uint32
+    {
+        const auto label = numeric_cast<uint32>(_parents.size());
+        _parents.emplace_back(label);
+        _sizes.emplace_back(0);
+        return label;
+    }
+
+    msize _mapSize {};
+    vector<uint32> _labels {}; // Zero for impassable hexes
+    vector<uint32> _parents {}; // Merged labels point to label they were merged into
+    vector<int32> _sizes {}; // Hexes count for root labels
+    size_t _pendingSplits {};
+};
+
+template<typename F>
+void PathRegions::Relabel(msize map_size, const F& is_passable)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _mapSize = map_size;
+    _labels.assign(numeric_cast<size_t>(map_size.width) * numeric_cast<size_t>(map_size.height), 0);
+    _parents.assign(1, 0);
+    _sizes.assign(1, 0);
+    _pendingSplits = 0;
+
+    vector<mpos> open_hexes;
+
+    for (const auto hx : iterate_range(map_size.width)) {
+        for (const auto hy : iterate_range(map_size.height)) {
+            const mpos start_hex = {hx, hy};
+
+            if (_labels[GetIndex(start_hex)] != 0 || !is_passable(start_hex)) {
+                continue;
+            }
+
+            const auto label = AddLabel();
+            _labels[GetIndex(start_hex)] = label;
+            _sizes[label]++;
+            open_hexes.emplace_back(start_hex);
+
+            while (!open_hexes.empty()) {
+                const auto cur_hex = open_hexes.back();
+                open_hexes.pop_back();
+
+                for (int32 dir = 0; dir < GameSettings::MAP_DIR_COUNT; dir++) {
+                    if (auto next_hex = cur_hex; GeometryHelper::MoveHexByDir(next_hex, static_cast<uint8>(dir), map_size)) {
+                        auto& next_label = _labels[GetIndex(next_hex)];
+
+                        if (next_label == 0 && is_passable(next_hex)) {
+                            next_label = label;
+                            _sizes[label]++;
+                            open_hexes.emplace_back(next_hex);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename F>
+void PathRegions::Update(mpos changed_hex, int32 radius, const F& is_passable)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(!_labels.empty());
+
+    const auto hexes_around = GeometryHelper::HexesInRadius(radius);
+
+    for (int32 i = 0; i < hexes_around; i++) {
+        auto hex = changed_hex;
+
+        if (!GeometryHelper::MoveHexAroundAway(hex, i, _mapSize)) {
+            continue;
+        }
+
+        auto& label = _labels[GetIndex(hex)];
+        const auto passable = is_passable(hex);
+
+        if (label != 0 && !passable) {
+            _sizes[FindRoot(label)]--;
+            label = 0;
+            _pendingSplits++;
+        }
+        else if (label == 0 && passable) {
+            uint32 root = 0;
+
+            for (int32 dir = 0; dir < GameSettings::MAP_DIR_COUNT; dir++) {
+                if (auto near_hex = hex; GeometryHelper::MoveHexByDir(near_hex, static_cast<uint8>(dir), _mapSize)) {
+                    const auto near_label = GetLabel(near_hex);
+
+                    if (near_label == 0 || near_label == root) {
+                        continue;
+                    }
+
+                    if (root == 0) {
+                        root = near_label;
+                    }
+                    else {
+                        // Smaller area joins bigger one
+                        auto from_root = near_label;
+                        auto to_root = root;
+
+                        if (_sizes[from_root] > _sizes[to_root]) {
+                            std::swap(from_root, to_root);
+                        }
+
+                        _parents[from_root] = to_root;
+                        _sizes[to_root] += _sizes[from_root];
+                        root = to_root;
+                    }
+                }
+            }
+
+            if (root == 0) {
+                root = AddLabel();
+            }
+
+            label = root;
+            _sizes[root]++;
+        }
+    }
+}
+
+class PathFinding final
+{
+public:
+    PathFinding() = delete;
+
+    // Breadth-first search from start hex, grid is filled with path lengths and reused for free movement
+    template<typename F>
+    [[nodiscard]] static auto SearchGrid(msize map_size, mpos from_hex, mpos& to_hex, int32 cut, int32 max_path_find_len, vector<int16>& path_find_grid, vector<uint8>& raw_steps, const F& get_hex_type) -> PathSearchResult;
+
+    // Lengths are spread from goal hexes, critters must be reported as free
+    template<typename F>
+    static void BuildFlowField(PathFlowField& flow_field, msize map_size, int32 max_path_find_len, const F& get_hex_type);
+
+    // Walk down to goal through hexes that are free right now, prefer straight lines
+    template<typename F>
+    [[nodiscard]] static auto WalkFlowField(PathFlowField& flow_field, msize map_size, mpos from_hex, int32 max_path_find_len, vector<uint8>& raw_steps, mpos& to_hex, const F& get_hex_type) -> bool;
+};
+
+template<typename F>
+auto PathFinding::SearchGrid(msize map_size, mpos from_hex, mpos& to_hex, int32 cut, int32 max_path_find_len, vector<int16>& path_find_grid, vector<uint8>& raw_steps, const F& get_hex_type) -> PathSearchResult
+{
+    FO_STACK_TRACE_ENTRY();
+
+    path_find_grid.assign(numeric_cast<size_t>(max_path_find_len * 2 + 2) * (max_path_find_len * 2 + 2), 0);
+    const auto grid_offset = from_hex;
+    const auto grid_at = [&](mpos hex) -> int16& { return path_find_grid[((max_path_find_len + 1) + hex.y - grid_offset.y) * (max_path_find_len * 2 + 2) + ((max_path_find_len + 1) + hex.x - grid_offset.x)]; };
+
+    raw_steps.clear();
+
+    vector<mpos> next_hexes;
+    vector<mpos> cr_hexes;
+    vector<mpos> gag_hexes;
+    next_hexes.reserve(1024);
+    cr_hexes.reserve(64);
+    gag_hexes.reserve(64);
+
+    // Begin search
+    grid_at(from_hex) = 1;
+    next_hexes.emplace_back(from_hex);
+
+    while (true) {
+        bool find_ok = false;
+        const auto next_hexes_round = next_hexes.size();
+        FO_RUNTIME_ASSERT(next_hexes_round != 0);
+
+        for (size_t i = 0; i < next_hexes_round; i++) {
+            const auto cur_hex = next_hexes[i];
+
+            if (GeometryHelper::CheckDist(cur_hex, to_hex, cut)) {
+                to_hex = cur_hex;
+                find_ok = true;
+                break;
+            }
+
+            const auto next_hex_index = numeric_cast<int16>(grid_at(cur_hex) + 1);
+
+            if (next_hex_index > max_path_find_len) {
+                return PathSearchResult::TooFar;
+            }
+
+            for (int32 j = 0; j < GameSettings::MAP_DIR_COUNT; j++) {
+                auto raw_next_hex = ipos32 {cur_hex.x, cur_hex.y};
+                GeometryHelper::MoveHexByDirUnsafe(raw_next_hex, static_cast<uint8>(j));
+
+                if (!map_size.is_valid_pos(raw_next_hex)) {
+                    continue;
+                }
+
+                const auto next_hex = map_size.from_raw_pos(raw_next_hex);
+                auto& grid_cell = grid_at(next_hex);
+
+                if (grid_cell != 0) {
+                    continue;
+                }
+
+                const auto hex_type = get_hex_type(next_hex);
+
+                if (hex_type == PathHexType::Free) {
+                    next_hexes.emplace_back(next_hex);
+                    grid_cell = next_hex_index;
+                }
+                else if (hex_type == PathHexType::Gag) {
+                    gag_hexes.emplace_back(next_hex);
+                    grid_cell = numeric_cast<int16>(next_hex_index | 0x4000);
+                }
+                else if (hex_type == PathHexType::Critter) {
+                    cr_hexes.emplace_back(next_hex);
+                    grid_cell = numeric_cast<int16>(next_hex_index | 0x4000);
+                }
+                else {
+                    grid_cell = -1;
+                }
+            }
+        }
+
+        if (find_ok) {
+            break;
+        }
+
+        next_hexes.erase(next_hexes.begin(), next_hexes.begin() + static_cast<ptrdiff_t>(next_hexes_round));
+
+        // Add gag hex after some distance
+        if (!gag_hexes.empty()) {
+            const auto last_index = grid_at(next_hexes.back());
+            const auto& gag_hex = gag_hexes.front();
+            const auto gag_index = numeric_cast<int16>(grid_at(gag_hex) ^ 0x4000);
+
+            if (gag_index + 10 < last_index) { // Todo: if path finding not be reworked than migrate magic number to scripts
+                grid_at(gag_hex) = gag_index;
+                next_hexes.emplace_back(gag_hex);
+                gag_hexes.erase(gag_hexes.begin());
+            }
+        }
+
+        // If no way then route through gag/critter
+        if (next_hexes.empty()) {
+            if (!gag_hexes.empty()) {
+                auto& gag_hex = gag_hexes.front();
+                grid_at(gag_hex) ^= 0x4000;
+                next_hexes.emplace_back(gag_hex);
+                gag_hexes.erase(gag_hexes.begin());
+            }
+            else if (!cr_hexes.empty()) {
+                auto& cr_hex = cr_hexes.front();
+                grid_at(cr_hex) ^= 0x4000;
+                next_hexes.emplace_back(cr_hex);
+                cr_hexes.erase(cr_hexes.begin());
+            }
+        }
+
+        if (next_hexes.empty()) {
+            return PathSearchResult::NoWay;
+        }
+    }
+
+    auto hex_index = grid_at(to_hex);
+    auto cur_hex = to_hex;
+    raw_steps.resize(hex_index - 1);
+    float32 base_angle = GeometryHelper::GetDirAngle(to_hex, from_hex);
+
+    while (hex_index > 1) {
+        hex_index--;
+
+        const auto find_path_grid = [&](mpos& hex) -> bool {
+            int32 best_step_dir = -1;
+            float32 best_step_angle_diff = 0.0f;
+
+            const auto check_hex = [&](int32 dir, ipos32 step_raw_hex) {
+                if (!map_size.is_valid_pos(step_raw_hex)) {
+                    return;
+                }
+
+                const auto step_hex = map_size.from_raw_pos(step_raw_hex);
+
+                if (grid_at(step_hex) != hex_index) {
+                    return;
+                }
+
+                const float32 angle = GeometryHelper::GetDirAngle(step_hex, from_hex);
+                const float32 angle_diff = GeometryHelper::GetDirAngleDiff(base_angle, angle);
+
+                if (best_step_dir == -1 || hex_index == 0) {
+                    best_step_dir = dir;
+                    best_step_angle_diff = GeometryHelper::GetDirAngleDiff(base_angle, angle);
+                }
+                else if (angle_diff < best_step_angle_diff) {
+                    best_step_dir = dir;
+                    best_step_angle_diff = angle_diff;
+                }
+            };
+
+            if ((hex.x % 2) != 0) {
+                check_hex(3, ipos32 {hex.x - 1, hex.y - 1});
+                check_hex(2, ipos32 {hex.x, hex.y - 1});
+                check_hex(5, ipos32 {hex.x, hex.y + 1});
+                check_hex(0, ipos32 {hex.x + 1, hex.y});
+                check_hex(4, ipos32 {hex.x - 1, hex.y});
+                check_hex(1, ipos32 {hex.x + 1, hex.y - 1});
+
+                if (best_step_dir == 3) {
+                    raw_steps[hex_index - 1] = 3;
+                    hex.x--;
+                    hex.y--;
+                    return true;
+                }
+                if (best_step_dir == 2) {
+                    raw_steps[hex_index - 1] = 2;
+                    hex.y--;
+                    return true;
+                }
+                if (best_step_dir == 5) {
+                    raw_steps[hex_index - 1] = 5;
+                    hex.y++;
+                    return true;
+                }
+                if (best_step_dir == 0) {
+                    raw_steps[hex_index - 1] = 0;
+                    hex.x++;
+                    return true;
+                }
+                if (best_step_dir == 4) {
+                    raw_steps[hex_index - 1] = 4;
+                    hex.x--;
+                    return true;
+                }
+                if (best_step_dir == 1) {
+                    raw_steps[hex_index - 1] = 1;
+                    hex.x++;
+                    hex.y--;
+                    return true;
+                }
+            }
+            else {
+                check_hex(3, ipos32 {hex.x - 1, hex.y});
+                check_hex(2, ipos32 {hex.x, hex.y - 1});
+                check_hex(5, ipos32 {hex.x, hex.y + 1});
+                check_hex(0, ipos32 {hex.x + 1, hex.y + 1});
+                check_hex(4, ipos32 {hex.x - 1, hex.y + 1});
+                check_hex(1, ipos32 {hex.x + 1, hex.y});
+
+                if (best_step_dir == 3) {
+                    raw_steps[hex_index - 1] = 3;
+                    hex.x--;
+                    return true;
+                }
+                if (best_step_dir == 2) {
+                    raw_steps[hex_index - 1] = 2;
+                    hex.y--;
+                    return true;
+                }
+                if (best_step_dir == 5) {
+                    raw_steps[hex_index - 1] = 5;
+                    hex.y++;
+                    return true;
+                }
+                if (best_step_dir == 0) {
+                    raw_steps[hex_index - 1] = 0;
+                    hex.x++;
+                    hex.y++;
+                    return true;
+                }
+                if (best_step_dir == 4) {
+                    raw_steps[hex_index - 1] = 4;
+                    hex.x--;
+                    hex.y++;
+                    return true;
+                }
+                if (best_step_dir == 1) {
+                    raw_steps[hex_index - 1] = 1;
+                    hex.x++;
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        if (!find_path_grid(cur_hex)) {
+            return PathSearchResult::InternalError;
+        }
+    }
+
+    return PathSearchResult::Ok;
+}
+
+template<typename F>
+void PathFinding::BuildFlowField(PathFlowField& flow_field, msize map_size, int32 max_path_find_len, const F& get_hex_type)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    flow_field.HasGagHexes = false;
+    flow_field.Lengths.assign(numeric_cast<size_t>(flow_field.Radius * 2 + 1) * numeric_cast<size_t>(flow_field.Radius * 2 + 1), 0);
+
+    vector<mpos> next_hexes;
+    next_hexes.reserve(1024);
+
+    const auto check_hex = [&](mpos hex, int16 len) {
+        auto& cell = flow_field.GetCell(hex);
+        const auto hex_type = get_hex_type(hex);
+        FO_RUNTIME_ASSERT(hex_type != PathHexType::Critter);
+
+        if (hex_type == PathHexType::Free) {
+            cell = len;
+            next_hexes.emplace_back(hex);
+        }
+        else {
+            flow_field.HasGagHexes |= hex_type == PathHexType::Gag;
+            cell = -1;
+        }
+    };
+
+    // Goal hexes
+    const auto cut_hexes = GeometryHelper::HexesInRadius(flow_field.Cut);
+
+    for (int32 i = 0; i < cut_hexes; i++) {
+        if (auto goal_hex = flow_field.TargetHex; GeometryHelper::MoveHexAroundAway(goal_hex, i, map_size) && flow_field.IsCovered(goal_hex)) {
+            check_hex(goal_hex, 1);
+        }
+    }
+
+    // Spread outwards
+    for (size_t i = 0; i < next_hexes.size(); i++) {
+        const auto cur_hex = next_hexes[i];
+        const auto next_len = numeric_cast<int16>(flow_field.GetCell(cur_hex) + 1);
+
+        if (next_len > max_path_find_len) {
+            continue;
+        }
+
+        for (int32 dir = 0; dir < GameSettings::MAP_DIR_COUNT; dir++) {
+            auto raw_next_hex = ipos32 {cur_hex.x, cur_hex.y};
+            GeometryHelper::MoveHexByDirUnsafe(raw_next_hex, static_cast<uint8>(dir));
+
+            if (!map_size.is_valid_pos(raw_next_hex)) {
+                continue;
+            }
+
+            const auto next_hex = map_size.from_raw_pos(raw_next_hex);
+
+            if (!flow_field.IsCovered(next_hex) || flow_field.GetCell(next_hex) != 0) {
+                continue;
+            }
+
+            check_hex(next_hex, next_len);
+        }
+    }
+}
+
+template<typename F>
+auto PathFinding::WalkFlowField(PathFlowField& flow_field, msize map_size, mpos from_hex, int32 max_path_find_len, vector<uint8>& raw_steps, mpos& to_hex, const F& get_hex_type) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    raw_steps.clear();
+
+    if (!flow_field.IsCovered(from_hex)) {
+        return false;
+    }
+
+    auto cur_hex = from_hex;
+    auto cur_len = flow_field.GetCell(cur_hex);
+    int32 prev_dir = -1;
+
+    // Start is not connected to goal by terrain, grid search decides how to get out
+    if (cur_len <= 0) {
+        return false;
+    }
+
+    while (cur_len != 1) {
+        if (numeric_cast<int32>(raw_steps.size()) >= max_path_find_len) {
+            return false;
+        }
+
+        int32 best_dir = -1;
+        int16 best_len = cur_len;
+        mpos best_hex;
+
+        for (int32 dir = 0; dir < GameSettings::MAP_DIR_COUNT; dir++) {
+            auto raw_next_hex = ipos32 {cur_hex.x, cur_hex.y};
+            GeometryHelper::MoveHexByDirUnsafe(raw_next_hex, static_cast<uint8>(dir));
+
+            if (!map_size.is_valid_pos(raw_next_hex)) {
+                continue;
+            }
+
+            const auto next_hex = map_size.from_raw_pos(raw_next_hex);
+
+            if (!flow_field.IsCovered(next_hex)) {
+                continue;
+            }
+
+            const auto next_len = flow_field.GetCell(next_hex);
+
+            if (next_len <= 0 || next_len >= cur_len) {
+                continue;
+            }
+            if (best_dir != -1 && (next_len > best_len || (next_len == best_len && dir != prev_dir))) {
+                continue;
+            }
+            if (get_hex_type(next_hex) != PathHexType::Free) {
+                continue;
+            }
+
+            best_dir = dir;
+            best_len = next_len;
+            best_hex = next_hex;
+        }
+
+        // Blocked by critters, let grid search decide
+        if (best_dir == -1) {
+            return false;
+        }
+
+        raw_steps.emplace_back(numeric_cast<uint8>(best_dir));
+        cur_hex = best_hex;
+        cur_len = best_len;
+        prev_dir = best_dir;
+    }
+
+    if (raw_steps.empty()) {
+        return false;
+    }
+
+    to_hex = cur_hex;
+    return true;
+}
+
+FO_END_NAMESPACE();
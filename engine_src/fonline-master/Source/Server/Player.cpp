@@ -43,6 +43,10 @@
 
 FO_BEGIN_NAMESPACE();
 
+static constexpr uint32 THROTTLE_SLOT_MOVING = 0;
+static constexpr uint32 THROTTLE_SLOT_DIR = 1;
+static constexpr uint32 THROTTLE_SLOT_PROPERTY = 2;
+
 Player::Player(FOServer* engine, ident_t id, unique_ptr<ServerConnection> connection, const Properties* props) noexcept :
     ServerEntity(engine, id, engine->GetPropertyRegistrator(ENTITY_TYPE_NAME), props),
     PlayerProperties(GetInitRef()),
@@ -112,6 +116,9 @@ void Player::Send_AddCritter(const Critter* cr)
 {
     FO_STACK_TRACE_ENTRY();
 
+    // Full state is sent, drop outdated coalesced updates
+    _broadcastThrottler.Cancel(cr->GetId());
+
     const auto is_chosen = cr == GetControlledCritter();
 
     vector<const uint8*>* cr_data = nullptr;
@@ -171,6 +178,8 @@ void Player::Send_RemoveCritter(const Critter* cr)
 {
     FO_STACK_TRACE_ENTRY();
 
+    _broadcastThrottler.Cancel(cr->GetId());
+
     auto out_buf = _connection->WriteMsg(NetMessage::RemoveCritter);
 
     out_buf->Write(cr->GetId());
@@ -180,6 +189,8 @@ void Player::Send_LoadMap(const Map* map)
 {
     FO_STACK_TRACE_ENTRY();
 
+    _broadcastThrottler.Clear();
+
     const Location* loc = nullptr;
     hstring pid_map;
     hstring pid_loc;
@@ -523,6 +534,68 @@ void Player::Send_RemoveCustomEntity(ident_t id)
     out_buf->Write(id);
 }
 
+void Player::Send_ThrottledMoving(const Critter* from_cr, timespan period)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_broadcastThrottler.Push(from_cr->GetId(), THROTTLE_SLOT_MOVING, _engine->GameTime.GetFrameTime(), period)) {
+        Send_Moving(from_cr);
+    }
+}
+
+void Player::Send_ThrottledDir(const Critter* from_cr, timespan period)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_broadcastThrottler.Push(from_cr->GetId(), THROTTLE_SLOT_DIR, _engine->GameTime.GetFrameTime(), period)) {
+        Send_Dir(from_cr);
+    }
+}
+
+void Player::Send_ThrottledProperty(const Critter* from_cr, const Property* prop, timespan period)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto slot = THROTTLE_SLOT_PROPERTY + numeric_cast<uint32>(prop->GetRegIndex());
+
+    if (_broadcastThrottler.Push(from_cr->GetId(), slot, _engine->GameTime.GetFrameTime(), period)) {
+        Send_Property(NetProperty::Critter, prop, from_cr);
+    }
+}
+
+void Player::ProcessThrottledUpdates()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_broadcastThrottler.IsEmpty()) {
+        return;
+    }
+
+    _broadcastThrottler.Flush(_engine->GameTime.GetFrameTime(), [this](ident_t cr_id, uint32 slot) {
+        const auto* chosen = GetControlledCritter();
+
+        if (chosen == nullptr || !chosen->IsSeeCritter(cr_id)) {
+            return;
+        }
+
+        const auto* cr = _engine->EntityMngr.GetCritter(cr_id);
+        FO_RUNTIME_ASSERT(cr);
+
+        // Actual state is sent, intermediate changes are dropped
+        if (slot == THROTTLE_SLOT_MOVING) {
+            Send_Moving(cr);
+        }
+        else if (slot == THROTTLE_SLOT_DIR) {
+            Send_Dir(cr);
+        }
+        else {
+            const auto* prop = cr->GetProperties().GetRegistrator()->GetPropertyByIndex(numeric_cast<int32>(slot - THROTTLE_SLOT_PROPERTY));
+            FO_RUNTIME_ASSERT(prop);
+            Send_Property(NetProperty::Critter, prop, cr);
+        }
+    });
+}
+
 void Player::SendItem(NetOutBuffer& out_buf, const Item* item, bool owned, bool with_slot, bool with_inner_entities)
 {
     FO_STACK_TRACE_ENTRY();
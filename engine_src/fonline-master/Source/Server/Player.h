@@ -37,6 +37,7 @@
 
 #include "EntityProperties.h"
 #include "EntityProtos.h"
+#include "BroadcastThrottler.h"
 #include "Geometry.h"
 #include "ServerConnection.h"
 #include "ServerEntity.h"
@@ -94,6 +95,11 @@ public:
     void Send_Attachments(const Critter* from_cr);
     void Send_AddCustomEntity(CustomEntity* entity, bool owned);
     void Send_RemoveCustomEntity(ident_t id);
+    void Send_ThrottledMoving(const Critter* from_cr, timespan period);
+    void Send_ThrottledDir(const Critter* from_cr, timespan period);
+    void Send_ThrottledProperty(const Critter* from_cr, const Property* prop, timespan period);
+
+    void ProcessThrottledUpdates();
 
     ///@ ExportEvent
     FO_ENTITY_EVENT(OnGetAccess, int32 /*arg1*/, string& /*arg2*/);
@@ -112,6 +118,7 @@ private:
     raw_ptr<Critter> _controlledCr {}; // Todo: allow attach many critters to sigle player
     raw_ptr<const Entity> _sendIgnoreEntity {};
     raw_ptr<const Property> _sendIgnoreProperty {};
+    BroadcastThrottler _broadcastThrottler {};
 };
 
 FO_END_NAMESPACE();
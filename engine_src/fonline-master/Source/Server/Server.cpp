@@ -123,6 +123,15 @@ FOServer::FOServer(GlobalSettings& settings) :
         return std::nullopt;
     });
 
+    // Settings validation
+    _starter.AddJob([this] {
+        FO_STACK_TRACE_ENTRY_NAMED("ValidateSettingsJob");
+
+        BroadcastThrottler::ValidateSettings(Settings.BroadcastThrottleDistances, Settings.BroadcastThrottlePeriods);
+
+        return std::nullopt;
+    });
+
     // Script system
     _starter.AddJob([this] {
         FO_STACK_TRACE_ENTRY_NAMED("InitScriptSystemJob");
@@ -202,6 +211,9 @@ FOServer::FOServer(GlobalSettings& settings) :
             }
         }
 
+        // Properties with secondary indexes for script queries
+        EntityMngr.InitPropertyIndexes();
+
         // Properties that sending to clients
         {
             const auto set_send_callbacks = [](const auto* registrator, const PropertyPostSetCallback& callback) {
@@ -445,17 +457,23 @@ FOServer::FOServer(GlobalSettings& settings) :
             return std::chrono::milliseconds {0};
         });
 
+        // Budgeted jobs, ran in one main worker job after time advance
+        _tickScheduler.SetTickBudget(std::chrono::milliseconds {Settings.ServerTickBudget});
+        _tickScheduler.SetMaxDeferTicks(Settings.ServerJobMaxDeferTicks);
+
+        if (Settings.ServerJobOverrunReportPeriod > 0) {
+            _tickScheduler.SetOverrunHandler([](string_view name, timespan duration, timespan max_slice, size_t overruns) { WriteLog("Server job {} overrun: {} of {} slice ({} times since last report)", name, duration, max_slice, overruns); }, std::chrono::milliseconds {Settings.ServerJobOverrunReportPeriod});
+        }
+
         // Script subsystems update
-        _mainWorker.AddJob([this] {
+        _tickScheduler.AddJob({.Name = "ScriptSystem", .Priority = 10, .MaxSlice = std::chrono::milliseconds {5}}, [this] {
             FO_STACK_TRACE_ENTRY_NAMED("ScriptSystemJob");
 
             ScriptSys.Process();
-
-            return std::chrono::milliseconds {0};
         });
 
         // Process unlogined players
-        _mainWorker.AddJob([this] {
+        _tickScheduler.AddJob({.Name = "UnloginedPlayers", .Priority = 20, .MaxSlice = std::chrono::milliseconds {10}}, [this] {
             FO_STACK_TRACE_ENTRY_NAMED("UnloginedPlayersJob");
 
             {
@@ -495,15 +513,20 @@ FOServer::FOServer(GlobalSettings& settings) :
 
             _stats.CurOnline = _unloginedPlayers.size() + EntityMngr.GetPlayers().size();
             _stats.MaxOnline = std::max(_stats.MaxOnline, _stats.CurOnline);
+        });
 
-            return std::chrono::milliseconds {0};
+        // Staged logins
+        _tickScheduler.AddJob({.Name = "Logins", .Priority = 25, .MaxSlice = std::chrono::milliseconds {10}}, [this] {
+            FO_STACK_TRACE_ENTRY_NAMED("LoginsJob");
+
+            ProcessLoginQueue();
         });
 
         // Process players
-        _mainWorker.AddJob([this] {
+        _tickScheduler.AddJob({.Name = "Players", .Priority = 30, .MaxSlice = std::chrono::milliseconds {20}}, [this] {
             FO_STACK_TRACE_ENTRY_NAMED("PlayersJob");
 
-            for (auto* player : copy_hold_ref(EntityMngr.GetPlayers())) {
+            for (auto* player : EntityMngr.GetPlayers().iterate()) {
                 auto* connection = player->GetConnection();
 
                 try {
@@ -511,6 +534,10 @@ FOServer::FOServer(GlobalSettings& settings) :
 
                     ProcessConnection(connection);
                     ProcessPlayer(player);
+
+                    if (!player->IsDestroyed()) {
+                        player->ProcessThrottledUpdates();
+                    }
                 }
                 catch (const NetBufferException& ex) {
                     ReportExceptionAndContinue(ex);
@@ -523,15 +550,13 @@ FOServer::FOServer(GlobalSettings& settings) :
                     FO_UNKNOWN_EXCEPTION();
                 }
             }
-
-            return std::chrono::milliseconds {0};
         });
 
         // Process critters
-        _mainWorker.AddJob([this] {
+        _tickScheduler.AddJob({.Name = "Critters", .Priority = 40, .MaxSlice = std::chrono::milliseconds {10}}, [this] {
             FO_STACK_TRACE_ENTRY_NAMED("CrittersJob");
 
-            for (auto* cr : copy_hold_ref(EntityMngr.GetCritters())) {
+            for (auto* cr : EntityMngr.GetCritters().iterate()) {
                 if (cr->IsDestroyed()) {
                     continue;
                 }
@@ -546,33 +571,62 @@ FOServer::FOServer(GlobalSettings& settings) :
                     FO_UNKNOWN_EXCEPTION();
                 }
             }
+        });
 
-            return std::chrono::milliseconds {0};
+        // Critter item visibility after moving steps
+        _tickScheduler.AddJob({.Name = "ItemVisibility", .Priority = 45, .MaxSlice = std::chrono::milliseconds {5}, .Deferrable = true}, [this] {
+            FO_STACK_TRACE_ENTRY_NAMED("ItemVisibilityJob");
+
+            MapMngr.ProcessScheduledVisibleItems();
         });
 
         // Time events
-        _mainWorker.AddJob([this] {
-            FO_STACK_TRACE_ENTRY_NAMED("TimeEventsJob");
+        TimeEventMngr.SetDeferrableRepeatTime(std::chrono::milliseconds {Settings.TimeEventDeferrableRepeat});
 
-            TimeEventMngr.ProcessTimeEvents();
+        _tickScheduler.AddJob({.Name = "TimeEvents", .Priority = 50, .MaxSlice = std::chrono::milliseconds {10}}, [this] {
+            FO_STACK_TRACE_ENTRY_NAMED("TimeEventsJob");
 
-            return std::chrono::milliseconds {0};
+            TimeEventMngr.ProcessTimeEvents(Settings.TimeEventDeferrableRepeat > 0 ? TimeEventsPass::Urgent : TimeEventsPass::All);
         });
 
+        if (Settings.TimeEventDeferrableRepeat > 0) {
+            _tickScheduler.AddJob({.Name = "DeferrableTimeEvents", .Priority = 52, .MaxSlice = std::chrono::milliseconds {10}, .Deferrable = true}, [this] {
+                FO_STACK_TRACE_ENTRY_NAMED("DeferrableTimeEventsJob");
+
+                TimeEventMngr.ProcessTimeEvents(TimeEventsPass::Deferrable);
+            });
+        }
+
+        // Unload idle locations
+        if (Settings.WorldPagingIdleTime > 0) {
+            // Check pass starts every WorldPagingCheckPeriod and continues on next ticks until all locations are visited
+            constexpr auto paging_slice = std::chrono::milliseconds {5};
+
+            _tickScheduler.AddJob({.Name = "WorldPaging", .Priority = 55, .MaxSlice = std::chrono::milliseconds {10}, .Deferrable = true}, [this, paging_slice] {
+                FO_STACK_TRACE_ENTRY_NAMED("WorldPagingJob");
+
+                EntityMngr.ProcessPaging(paging_slice);
+            });
+        }
+
         // Commit data to storage
-        _mainWorker.AddJob([this] {
+        _tickScheduler.AddJob({.Name = "StorageCommit", .Priority = 60, .MaxSlice = std::chrono::milliseconds {10}, .Period = std::chrono::milliseconds {Settings.DataBaseCommitPeriod}, .Deferrable = true}, [this] {
             FO_STACK_TRACE_ENTRY_NAMED("StorageCommitJob");
 
             DbStorage.CommitChanges(false);
-
-            return std::chrono::milliseconds {Settings.DataBaseCommitPeriod};
         });
 
         // Clients log
-        _mainWorker.AddJob([this] {
+        _tickScheduler.AddJob({.Name = "LogDispatch", .Priority = 70, .MaxSlice = std::chrono::milliseconds {2}, .Deferrable = true}, [this] {
             FO_STACK_TRACE_ENTRY_NAMED("LogDispatchJob");
 
             DispatchLogToClients();
+        });
+
+        _mainWorker.AddJob([this] {
+            FO_STACK_TRACE_ENTRY_NAMED("TickSchedulerJob");
+
+            _tickScheduler.RunTick();
 
             return std::chrono::milliseconds {0};
         });
@@ -666,11 +720,13 @@ FOServer::~FOServer()
         _logClients.clear();
 
         // Logined players
-        for (auto& player : copy(EntityMngr.GetPlayers()) | std::views::values) {
+        for (auto* player : EntityMngr.GetPlayers().iterate()) {
             player->GetConnection()->HardDisconnect();
         }
 
         // Unlogined players
+        _loginQueue.clear();
+
         for (auto& player : _unloginedPlayers) {
             player->GetConnection()->HardDisconnect();
             player->MarkAsDestroyed();
@@ -825,7 +881,8 @@ void FOServer::DrawGui(string_view server_name)
 
             // Profiler
             if (ImGui::TreeNode("Profiler")) {
-                buf = "WIP..........................."; // ScriptSys.GetProfilerStatistics();
+                const auto& profiler = ScriptSys.GetProfiler();
+                buf = profiler.IsEnabled() || profiler.GetSamplesCount() != 0 ? profiler.GetTopFunctions(50) : "Script profiler is not running, use 'profiler start' command";
                 ImGui::TextUnformatted(buf.c_str(), buf.c_str() + buf.size());
                 ImGui::TreePop();
             }
@@ -857,6 +914,31 @@ auto FOServer::GetHealthInfo() const -> string
     buf += strex("KBytes Recv: {}\n", _stats.BytesRecv / 1024);
     buf += strex("Compress ratio: {}\n", numeric_cast<float64>(_stats.DataReal) / numeric_cast<float64>(_stats.DataCompressed != 0 ? _stats.DataCompressed : 1));
     buf += strex("DB commit jobs: {}\n", DbStorage.GetCommitJobsCount());
+    buf += strex("Login queue: {}\n", _loginQueue.size());
+    buf += strex("Logins in flight: {}\n", DbStorage.GetPrefetchCount());
+    buf += strex("Logins rejected: {}\n", _loginStats.Rejected);
+
+    const auto login_stage_info = [&buf](string_view stage_name, const LoginStageStats& stats) {
+        const auto avg_time = stats.Count != 0 ? timespan(stats.TotalTime.value() / numeric_cast<int64>(stats.Count)) : timespan::zero;
+        buf += strex("Login {} time: avg {}, max {}\n", stage_name, avg_time, stats.MaxTime);
+    };
+
+    login_stage_info("queue", _loginStats.Queue);
+    login_stage_info("fetch", _loginStats.Fetch);
+    login_stage_info("commit", _loginStats.Commit);
+    buf += EntityMngr.GetPagingInfo();
+
+    for (size_t i = 0; i < static_cast<size_t>(MemoryCategory::Count); i++) {
+        const auto category = static_cast<MemoryCategory>(i);
+        buf += strex("Memory {}: {} KB\n", GetMemoryCategoryName(category), GetMemoryCategoryBytes(category) / 1024);
+    }
+
+    if (Settings.HealthInfoMemoryTop > 0) {
+        buf += EntityMngr.GetMemoryUsageInfo(numeric_cast<size_t>(Settings.HealthInfoMemoryTop));
+    }
+
+    buf += strex("Last tick time: {}\n", _tickScheduler.GetLastTickTime());
+    buf += _tickScheduler.GetStatsInfo();
 
     return buf;
 }
@@ -865,13 +947,13 @@ auto FOServer::GetIngamePlayersStatistics() -> string
 {
     FO_STACK_TRACE_ENTRY();
 
-    const auto& players = EntityMngr.GetPlayers();
+    auto& players = EntityMngr.GetPlayers();
     const auto conn_count = _unloginedPlayers.size() + players.size();
 
     string result = strex("Players: {}\nConnections: {}\n", players.size(), conn_count);
     result += "Name                 Id         Ip              X     Y     Location and map\n";
 
-    for (const auto& player : players | std::views::values) {
+    for (const auto* player : players.iterate()) {
         const auto* cr = player->GetControlledCritter();
         const auto* map = EntityMngr.GetMap(cr->GetMapId());
         const auto* loc = map != nullptr ? map->GetLocation() : nullptr;
@@ -1397,6 +1479,56 @@ void FOServer::Process_Command(NetInBuffer& buf, const LogFunc& logcb, Player* p
             SetLogCallback("LogToClients", [this](string_view str) { LogToClients(str); });
         }
     } break;
+    case CMD_PROFILER: {
+        const auto action = buf.Read<string>();
+        const auto param = buf.Read<string>();
+        auto& profiler = ScriptSys.GetProfiler();
+
+        if (action == "start") {
+            const auto interval = !param.empty() ? strex(param).to_int32() : Settings.ScriptProfilerSampleInterval;
+
+            if (interval <= 0) {
+                logcb("Invalid sample interval");
+                break;
+            }
+
+            profiler.Start(std::chrono::microseconds {interval});
+            logcb(strex("Script profiler started with interval {}", profiler.GetSampleInterval()));
+        }
+        else if (action == "stop") {
+            profiler.Stop();
+            logcb(strex("Script profiler stopped, collected {} samples", profiler.GetSamplesCount()));
+        }
+        else if (action == "reset") {
+            profiler.Reset();
+            logcb("Script profiler data cleared");
+        }
+        else if (action == "top") {
+            const auto count = !param.empty() ? strex(param).to_int32() : 20;
+
+            for (const auto& line : strex(profiler.GetTopFunctions(numeric_cast<size_t>(std::max(count, 1)))).split('\n')) {
+                logcb(line);
+            }
+        }
+        else if (action == "dump") {
+            const auto path = ScriptProfiler::MakeDumpPath(param);
+
+            if (!path.has_value()) {
+                logcb(strex("Invalid dump name, use up to {} letters, digits, '_', '-' or '.'", ScriptProfiler::MAX_DUMP_NAME_LENGTH));
+                break;
+            }
+
+            if (DiskFileSystem::WriteFile(path.value(), profiler.GetFoldedStacks())) {
+                logcb(strex("Folded stacks written to {}", DiskFileSystem::ResolvePath(path.value())));
+            }
+            else {
+                logcb(strex("Can't write folded stacks to {}", path.value()));
+            }
+        }
+        else {
+            logcb("Unknown profiler action");
+        }
+    } break;
     default:
         logcb("Unknown command");
         break;
@@ -1478,6 +1610,9 @@ auto FOServer::LoadCritter(ident_t cr_id, bool for_player) -> Critter*
 
     WriteLog(LogType::Info, "Load critter {}", cr_id);
 
+    // Paged out critter must come back with its location instead of separate load
+    EntityMngr.EnsureLoaded(cr_id);
+
     if (EntityMngr.GetCritter(cr_id) != nullptr) {
         throw GenericException("Critter already in game");
     }
@@ -1490,7 +1625,7 @@ auto FOServer::LoadCritter(ident_t cr_id, bool for_player) -> Critter*
             cr->MarkAsDestroying();
             UnloadCritterInnerEntities(cr);
             cr->MarkAsDestroyed();
-            EntityMngr.UnregisterCritter(cr);
+            EntityMngr.UnregisterCritter(cr, !cr->GetControlledByPlayer());
         }
 
         throw GenericException("Critter data base loading error");
@@ -1560,7 +1695,7 @@ void FOServer::UnloadCritter(Critter* cr)
 
     UnloadCritterInnerEntities(cr);
     cr->MarkAsDestroyed();
-    EntityMngr.UnregisterCritter(cr);
+    EntityMngr.UnregisterCritter(cr, !cr->GetControlledByPlayer());
 }
 
 void FOServer::UnloadCritterInnerEntities(Critter* cr)
@@ -1658,6 +1793,8 @@ void FOServer::DestroyUnloadedCritter(ident_t cr_id)
 
     WriteLog(LogType::Info, "Destroy unloaded critter {}", cr_id);
 
+    EntityMngr.EnsureLoaded(cr_id);
+
     if (EntityMngr.GetCritter(cr_id) != nullptr) {
         throw GenericException("Critter must be unloaded before destroying");
     }
@@ -1670,6 +1807,7 @@ void FOServer::SendCritterInitialInfo(Critter* cr, Critter* prev_cr)
     cr->Send_TimeSync();
 
     if (cr->ViewMapId) {
+        EntityMngr.EnsureLoaded(cr->ViewMapId);
         auto* map = EntityMngr.GetMap(cr->ViewMapId);
         cr->ViewMapId = ident_t {};
 
@@ -2072,10 +2210,108 @@ void FOServer::Process_Login(Player* unlogined_player)
         return;
     }
 
-    // Check password
+    // Login already in progress
+    if (std::ranges::any_of(_loginQueue, [&](auto&& request) { return request.UnloginedPlayer.get() == unlogined_player; })) {
+        return;
+    }
+
     const auto player_id = MakePlayerId(name);
-    const auto player_doc = DbStorage.Get(PlayersCollectionName, player_id);
+    auto request = LoginRequest {.UnloginedPlayer = unlogined_player, .Name = name, .Password = password, .PlayerId = player_id, .QueueTime = nanotime::now()};
+
+    if (Settings.LoginMaxInFlight <= 0) {
+        FinishLogin(request, DbStorage.Get(PlayersCollectionName, player_id));
+        return;
+    }
+
+    // Whole queue is bounded, not only logins in flight
+    if (Settings.LoginMaxQueued > 0 && _loginQueue.size() >= numeric_cast<size_t>(Settings.LoginMaxQueued)) {
+        _loginStats.Rejected++;
+        unlogined_player->Send_InfoMessage(EngineInfoMessage::NetConnFail);
+        connection->GracefulDisconnect();
+        return;
+    }
+
+    // Player data will be fetched in database commit thread
+    _loginQueue.emplace_back(std::move(request));
+}
+
+void FOServer::ProcessLoginQueue()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto add_stage_time = [](LoginStageStats& stats, timespan time) {
+        stats.Count++;
+        stats.TotalTime += time;
+        stats.MaxTime = std::max(stats.MaxTime, time);
+    };
+
+    size_t in_flight = 0;
+
+    for (size_t i = 0; i < _loginQueue.size();) {
+        auto& request = _loginQueue[i];
+        const auto* connection = request.UnloginedPlayer->GetConnection();
 
+        // Disconnected while waiting
+        if (request.UnloginedPlayer->IsDestroyed() || connection->IsHardDisconnected() || connection->IsGracefulDisconnected()) {
+            if (request.PrefetchId.has_value()) {
+                DbStorage.CancelPrefetch(request.PrefetchId.value());
+            }
+
+            _loginQueue.erase(_loginQueue.begin() + numeric_cast<ptrdiff_t>(i));
+            continue;
+        }
+
+        if (!request.PrefetchId.has_value()) {
+            if (in_flight >= numeric_cast<size_t>(Settings.LoginMaxInFlight)) {
+                i++;
+                continue;
+            }
+
+            request.FetchTime = nanotime::now();
+            request.PrefetchId = DbStorage.Prefetch(PlayersCollectionName, request.PlayerId);
+            add_stage_time(_loginStats.Queue, request.FetchTime - request.QueueTime);
+        }
+
+        auto player_doc = DbStorage.TakePrefetched(request.PrefetchId.value());
+
+        if (!player_doc.has_value()) {
+            in_flight++;
+            i++;
+            continue;
+        }
+
+        auto finished_request = std::move(request);
+        _loginQueue.erase(_loginQueue.begin() + numeric_cast<ptrdiff_t>(i));
+
+        const auto commit_time = nanotime::now();
+        add_stage_time(_loginStats.Fetch, commit_time - finished_request.FetchTime);
+
+        try {
+            FinishLogin(finished_request, player_doc.value());
+        }
+        catch (const NetBufferException& ex) {
+            ReportExceptionAndContinue(ex);
+            finished_request.UnloginedPlayer->GetConnection()->HardDisconnect();
+        }
+        catch (const std::exception& ex) {
+            ReportExceptionAndContinue(ex);
+        }
+
+        add_stage_time(_loginStats.Commit, nanotime::now() - commit_time);
+    }
+}
+
+void FOServer::FinishLogin(LoginRequest& request, const AnyData::Document& player_doc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto* unlogined_player = request.UnloginedPlayer.get();
+    auto* connection = unlogined_player->GetConnection();
+    const auto& name = request.Name;
+    const auto& password = request.Password;
+    const auto player_id = request.PlayerId;
+
+    // Check password
     if (!player_doc.Contains("Password") || player_doc["Password"].Type() != AnyData::ValueType::String || player_doc["Password"].AsString().length() != password.length() || player_doc["Password"].AsString() != password) {
         unlogined_player->Send_InfoMessage(EngineInfoMessage::NetLoginPassWrong);
         connection->GracefulDisconnect();
@@ -2400,7 +2636,7 @@ void FOServer::Process_StopMove(Player* player)
     }
 
     cr->ClearMove();
-    cr->SendAndBroadcast(player, [cr](Critter* cr2) { cr2->Send_Moving(cr); });
+    cr->SendAndBroadcast_Moving(player);
 }
 
 void FOServer::Process_Dir(Player* player)
@@ -2437,7 +2673,7 @@ void FOServer::Process_Dir(Player* player)
     }
 
     cr->ChangeDirAngle(checked_dir_angle);
-    cr->SendAndBroadcast(player, [cr](Critter* cr2) { cr2->Send_Dir(cr); });
+    cr->SendAndBroadcast_Dir(player);
 }
 
 void FOServer::Process_Property(Player* player)
@@ -2671,7 +2907,7 @@ void FOServer::OnSendGlobalValue(Entity* entity, const Property* prop)
     ignore_unused(entity);
 
     if (prop->IsPublicSync()) {
-        for (auto& player : EntityMngr.GetPlayers() | std::views::values) {
+        for (auto* player : EntityMngr.GetPlayers().iterate()) {
             player->Send_Property(NetProperty::Game, prop, this);
         }
     }
@@ -2991,6 +3227,7 @@ void FOServer::ProcessCritterMoving(Critter* cr)
             find_input.TraceCr = trace_cr;
             find_input.CheckCritter = true;
             find_input.CheckGagItems = true;
+            find_input.UseFlowField = static_cast<bool>(cr->TargetMoving.TargId);
 
             if (cr->TargetMoving.Speed == 0) {
                 cr->TargetMoving.State = MovingState::CantMove;
@@ -3183,9 +3420,15 @@ void FOServer::ProcessCritterMovingBySteps(Critter* cr, Map* map)
                         return;
                     }
 
-                    MapMngr.ProcessVisibleItems(cr);
-                    if (!validate_moving(hex2)) {
-                        return;
+                    // Items visibility may lag behind few steps under tick budget
+                    if (Settings.ServerTickBudget > 0) {
+                        MapMngr.ScheduleVisibleItems(cr);
+                    }
+                    else {
+                        MapMngr.ProcessVisibleItems(cr);
+                        if (!validate_moving(hex2)) {
+                            return;
+                        }
                     }
                 }
                 else if (map->IsBlockItemOnHex(hex2)) {
@@ -3254,6 +3497,8 @@ void FOServer::ProcessCritterMovingBySteps(Critter* cr, Map* map)
         if (incorrect_final_position) {
             cr->SendAndBroadcast_Moving();
         }
+
+        ScriptSys.NotifyEvent(CritterReachedHexEventName, cr);
     }
 }
 
@@ -3275,8 +3520,8 @@ void FOServer::StartCritterMoving(Critter* cr, uint16 speed, const vector<uint8>
     cr->Moving.Speed = speed;
     cr->Moving.StartTime = GameTime.GetFrameTime();
     cr->Moving.OffsetTime = {};
-    cr->Moving.Steps = steps;
-    cr->Moving.ControlSteps = control_steps;
+    cr->Moving.Steps.assign(steps.begin(), steps.end());
+    cr->Moving.ControlSteps.assign(control_steps.begin(), control_steps.end());
     cr->Moving.StartHex = start_hex;
     cr->Moving.StartHexOffset = cr->GetHexOffset();
     cr->Moving.EndHexOffset = end_hex_offset;
@@ -3333,7 +3578,7 @@ void FOServer::StartCritterMoving(Critter* cr, uint16 speed, const vector<uint8>
 
     cr->SetMovingSpeed(speed);
 
-    cr->SendAndBroadcast(initiator, [cr](Critter* cr2) { cr2->Send_Moving(cr); });
+    cr->SendAndBroadcast_Moving(initiator);
 }
 
 void FOServer::ChangeCritterMovingSpeed(Critter* cr, uint16 speed)
@@ -3367,7 +3612,7 @@ void FOServer::ChangeCritterMovingSpeed(Critter* cr, uint16 speed)
 
     cr->SetMovingSpeed(speed);
 
-    cr->SendAndBroadcast(nullptr, [cr](Critter* cr2) { cr2->Send_MovingSpeed(cr); });
+    cr->SendAndBroadcast_MovingSpeed();
 }
 
 void FOServer::Process_RemoteCall(Player* player)
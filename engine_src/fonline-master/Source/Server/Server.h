@@ -40,6 +40,7 @@
 #include "DataBase.h"
 #include "EngineBase.h"
 #include "EntityManager.h"
+#include "EntityRange.h"
 #include "Geometry.h"
 #include "Item.h"
 #include "ItemManager.h"
@@ -52,6 +53,7 @@
 #include "ScriptSystem.h"
 #include "ServerConnection.h"
 #include "Settings.h"
+#include "TickScheduler.h"
 
 FO_BEGIN_NAMESPACE();
 
@@ -173,6 +175,8 @@ public:
     const hstring GameCollectionName = Hashes.ToHashedString("Game");
     const hstring HistoryCollectionName = Hashes.ToHashedString("History");
     const hstring PlayersCollectionName = Hashes.ToHashedString("Players");
+    const hstring EntityDestroyedEventName = Hashes.ToHashedString("EntityDestroyed");
+    const hstring CritterReachedHexEventName = Hashes.ToHashedString("CritterReachedHex");
 
     EventObserver<> OnWillFinish {};
     EventObserver<> OnDidFinish {};
@@ -206,6 +210,35 @@ private:
         size_t LoopsPerSecond {};
     };
 
+    // Only player document fetching is pipelined, it is the only database access of login
+    // Password check, document decoding and critter attaching are done by FinishLogin in main thread
+    // Critter is attached only if it is already in game, so there is no critter document to prefetch
+    struct LoginRequest
+    {
+        refcount_ptr<Player> UnloginedPlayer {};
+        string Name {};
+        string Password {};
+        ident_t PlayerId {};
+        nanotime QueueTime {};
+        nanotime FetchTime {};
+        optional<size_t> PrefetchId {};
+    };
+
+    struct LoginStageStats
+    {
+        size_t Count {};
+        timespan TotalTime {};
+        timespan MaxTime {};
+    };
+
+    struct LoginStats
+    {
+        LoginStageStats Queue {};
+        LoginStageStats Fetch {};
+        LoginStageStats Commit {};
+        size_t Rejected {};
+    };
+
     void SyncPoint();
 
     void OnNewConnection(shared_ptr<NetworkServerConnection> net_connection);
@@ -220,6 +253,8 @@ private:
     void Process_UpdateFileData(ServerConnection* connection);
     void Process_Register(Player* unlogined_player);
     void Process_Login(Player* unlogined_player);
+    void ProcessLoginQueue();
+    void FinishLogin(LoginRequest& request, const AnyData::Document& player_doc);
     void Process_Move(Player* player);
     void Process_StopMove(Player* player);
     void Process_Dir(Player* player);
@@ -263,6 +298,7 @@ private:
     std::atomic_bool _started {};
     std::atomic_bool _startingError {};
     FrameBalancer _loopBalancer {};
+    TickScheduler _tickScheduler {};
     ServerStats _stats {};
     unordered_map<string, nanotime> _registrationHistory {};
     vector<vector<uint8>> _updateFilesData {};
@@ -274,6 +310,8 @@ private:
     vector<shared_ptr<NetworkServerConnection>> _newConnections {};
     mutable std::mutex _newConnectionsLocker {};
     vector<refcount_ptr<Player>> _unloginedPlayers {};
+    vector<LoginRequest> _loginQueue {};
+    LoginStats _loginStats {};
     EventDispatcher<> _willFinishDispatcher {OnWillFinish};
     EventDispatcher<> _didFinishDispatcher {OnDidFinish};
 };
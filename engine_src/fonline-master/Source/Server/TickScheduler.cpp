@@ -0,0 +1,162 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "TickScheduler.h"
+
+FO_BEGIN_NAMESPACE();
+
+TickScheduler::TickScheduler(Clock clock) :
+    _clock {std::move(clock)}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+auto TickScheduler::GetJobStats(string_view name) const -> const JobStats&
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto it = std::ranges::find_if(_jobs, [&](auto&& job) { return job->Desc.Name == name; });
+    FO_RUNTIME_ASSERT(it != _jobs.end());
+
+    return (*it)->Stats;
+}
+
+auto TickScheduler::GetStatsInfo() const -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    string buf;
+    buf.reserve(_jobs.size() * 128);
+
+    for (const auto& job : _jobs) {
+        const auto& stats = job->Stats;
+        const auto avg_time = stats.RunCount != 0 ? timespan(stats.TotalTime.value() / numeric_cast<int64>(stats.RunCount)) : timespan::zero;
+
+        buf += strex("Job {}: runs {}, deferred {}, overruns {}, last {}, avg {}, max {}\n", job->Desc.Name, stats.RunCount, stats.DeferCount, stats.OverrunCount, stats.LastTime, avg_time, stats.MaxTime);
+    }
+
+    return buf;
+}
+
+void TickScheduler::SetOverrunHandler(OverrunHandler handler, timespan report_period)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _overrunHandler = std::move(handler);
+    _overrunReportPeriod = report_period;
+}
+
+void TickScheduler::AddJob(JobDesc desc, function<void()> func)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_RUNTIME_ASSERT(!desc.Name.empty());
+    FO_RUNTIME_ASSERT(func);
+    FO_RUNTIME_ASSERT(std::ranges::none_of(_jobs, [&](auto&& other) { return other->Desc.Name == desc.Name; }));
+
+    auto new_job = SafeAlloc::MakeUnique<Job>();
+    new_job->Desc = std::move(desc);
+    new_job->Func = std::move(func);
+
+    // Keep addition order for jobs with same priority
+    const auto it = std::ranges::upper_bound(_jobs, new_job->Desc.Priority, std::less {}, [](auto&& other) { return other->Desc.Priority; });
+    _jobs.emplace(it, std::move(new_job));
+}
+
+void TickScheduler::RunTick()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto tick_start = Now();
+    const auto tick_deadline = _tickBudget ? tick_start + _tickBudget : nanotime::zero;
+
+    for (auto& job : _jobs) {
+        const auto time = Now();
+
+        if (job->Desc.Period && time < job->NextRunTime) {
+            continue;
+        }
+
+        if (job->Desc.Deferrable && tick_deadline && time >= tick_deadline && job->DeferredTicks < _maxDeferTicks) {
+            job->DeferredTicks++;
+            job->Stats.DeferCount++;
+            continue;
+        }
+
+        RunJob(*job, time);
+    }
+
+    _lastTickTime = Now() - tick_start;
+    _ticksCount++;
+}
+
+void TickScheduler::RunJob(Job& job, nanotime start_time)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    try {
+        job.Func();
+    }
+    catch (const std::exception& ex) {
+        ReportExceptionAndContinue(ex);
+    }
+    catch (...) {
+        FO_UNKNOWN_EXCEPTION();
+    }
+
+    const auto duration = Now() - start_time;
+
+    job.DeferredTicks = 0;
+
+    if (job.Desc.Period) {
+        job.NextRunTime = start_time + job.Desc.Period;
+    }
+
+    job.Stats.RunCount++;
+    job.Stats.LastTime = duration;
+    job.Stats.MaxTime = std::max(job.Stats.MaxTime, duration);
+    job.Stats.TotalTime += duration;
+
+    if (job.Desc.MaxSlice && duration > job.Desc.MaxSlice) {
+        job.Stats.OverrunCount++;
+        job.UnreportedOverruns++;
+
+        if (_overrunHandler && (!job.LastOverrunReport || start_time - job.LastOverrunReport >= _overrunReportPeriod)) {
+            _overrunHandler(job.Desc.Name, duration, job.Desc.MaxSlice, job.UnreportedOverruns);
+            job.UnreportedOverruns = 0;
+            job.LastOverrunReport = start_time;
+        }
+    }
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,113 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Runs server loop jobs in priority order within tick time budget
+// Deferrable jobs are postponed to next ticks when budget is exhausted, but not longer than max defer ticks
+class TickScheduler
+{
+public:
+    using Clock = function<nanotime()>;
+    using OverrunHandler = function<void(string_view name, timespan duration, timespan max_slice, size_t overruns)>;
+
+    struct JobDesc
+    {
+        string Name {};
+        int32 Priority {}; // Lower runs earlier
+        timespan MaxSlice {}; // Zero to disable overrun tracking
+        timespan Period {}; // Zero to run every tick
+        bool Deferrable {};
+    };
+
+    struct JobStats
+    {
+        size_t RunCount {};
+        size_t DeferCount {};
+        size_t OverrunCount {};
+        timespan LastTime {};
+        timespan MaxTime {};
+        timespan TotalTime {};
+    };
+
+    TickScheduler() = default;
+    explicit TickScheduler(Clock clock);
+    TickScheduler(const TickScheduler&) = delete;
+    TickScheduler(TickScheduler&&) noexcept = delete;
+    auto operator=(const TickScheduler&) = delete;
+    auto operator=(TickScheduler&&) noexcept = delete;
+    ~TickScheduler() = default;
+
+    [[nodiscard]] auto GetJobsCount() const noexcept -> size_t { return _jobs.size(); }
+    [[nodiscard]] auto GetJobStats(string_view name) const -> const JobStats&;
+    [[nodiscard]] auto GetLastTickTime() const noexcept -> timespan { return _lastTickTime; }
+    [[nodiscard]] auto GetTicksCount() const noexcept -> size_t { return _ticksCount; }
+    [[nodiscard]] auto GetStatsInfo() const -> string;
+
+    void SetTickBudget(timespan budget) noexcept { _tickBudget = budget; }
+    void SetMaxDeferTicks(int32 max_defer_ticks) noexcept { _maxDeferTicks = max_defer_ticks; }
+    void SetOverrunHandler(OverrunHandler handler, timespan report_period);
+    void AddJob(JobDesc desc, function<void()> func);
+    void RunTick();
+
+private:
+    struct Job
+    {
+        JobDesc Desc {};
+        function<void()> Func {};
+        JobStats Stats {};
+        nanotime NextRunTime {};
+        int32 DeferredTicks {};
+        size_t UnreportedOverruns {};
+        nanotime LastOverrunReport {};
+    };
+
+    [[nodiscard]] auto Now() const -> nanotime { return _clock ? _clock() : nanotime::now(); }
+
+    void RunJob(Job& job, nanotime start_time);
+
+    Clock _clock {};
+    timespan _tickBudget {};
+    int32 _maxDeferTicks {};
+    OverrunHandler _overrunHandler {};
+    timespan _overrunReportPeriod {};
+    vector<unique_ptr<Job>> _jobs {};
+    timespan _lastTickTime {};
+    size_t _ticksCount {};
+};
+
+FO_END_NAMESPACE();
@@ -0,0 +1,218 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+#if FO_ANGELSCRIPT_SCRIPTING
+
+#include "AngelScriptArray.h"
+
+FO_BEGIN_NAMESPACE();
+
+static constexpr string_view ARG_ARRAYS_TEST_SCRIPT = "int OnAppear(int[]@ ids) { int sum = 0; for (int i = 0; i < ids.length(); i++) { sum += ids[i]; } return sum; }\n"
+                                                      "int[]@ Stored;\n"
+                                                      "int OnAppearStore(int[]@ ids) { @Stored = ids; return ids.length(); }\n";
+
+static auto CreateArgArraysTestEngine() -> AngelScript::asIScriptEngine*
+{
+    auto* as_engine = AngelScript::asCreateScriptEngine();
+    FO_RUNTIME_ASSERT(as_engine);
+    FO_RUNTIME_ASSERT(as_engine->SetEngineProperty(AngelScript::asEP_ALLOW_UNSAFE_REFERENCES, true) >= 0);
+    FO_RUNTIME_ASSERT(as_engine->SetEngineProperty(AngelScript::asEP_ALLOW_IMPLICIT_HANDLE_TYPES, true) >= 0);
+
+    RegisterAngelScriptArray(as_engine);
+
+    auto* mod = as_engine->GetModule("ArgArraysTest", AngelScript::asGM_ALWAYS_CREATE);
+    FO_RUNTIME_ASSERT(mod->AddScriptSection("ArgArraysTest", ARG_ARRAYS_TEST_SCRIPT.data(), ARG_ARRAYS_TEST_SCRIPT.size()) >= 0);
+    FO_RUNTIME_ASSERT(mod->Build() >= 0);
+
+    return as_engine;
+}
+
+static auto CallWithArray(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, ScriptArray* arr) -> int32
+{
+    ctx->Prepare(func);
+    ctx->SetArgObject(0, arr);
+    FO_RUNTIME_ASSERT(ctx->Execute() == AngelScript::asEXECUTION_FINISHED);
+    const auto result = static_cast<int32>(ctx->GetReturnDWord());
+    ctx->Unprepare();
+
+    return result;
+}
+
+static void FillArray(ScriptArray* arr, const vector<int32>& values)
+{
+    arr->Resize(numeric_cast<int32>(values.size()));
+
+    for (size_t n = 0; n < values.size(); n++) {
+        arr->SetValue(static_cast<int32>(n), const_cast<int32*>(&values[n]));
+    }
+}
+
+// Previous behaviour, type is resolved by name and elements are appended one by one
+static auto DispatchByName(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, const vector<int32>& values) -> int32
+{
+    auto* as_engine = ctx->GetEngine();
+    auto* arr = ScriptArray::Create(as_engine->GetTypeInfoById(as_engine->GetTypeIdByDecl(strex("{}[]", "int").c_str())));
+
+    for (const auto& value : values) {
+        arr->InsertLast(const_cast<int32*>(&value));
+    }
+
+    const auto result = CallWithArray(ctx, func, arr);
+    arr->Release();
+
+    return result;
+}
+
+static auto DispatchCached(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, AngelScript::asITypeInfo* ti, const vector<int32>& values) -> int32
+{
+    auto* arr = ScriptArray::Create(ti);
+    FillArray(arr, values);
+
+    const auto result = CallWithArray(ctx, func, arr);
+    arr->Release();
+
+    return result;
+}
+
+static auto DispatchPooled(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, AngelScript::asITypeInfo* ti, ScriptArrayPool& pool, const vector<int32>& values) -> int32
+{
+    auto* arr = pool.Request(ti);
+    FillArray(arr, values);
+
+    const auto result = CallWithArray(ctx, func, arr);
+    pool.Return(arr, true);
+
+    return result;
+}
+
+static auto GetArgArrayType(AngelScript::asIScriptFunction* func) -> AngelScript::asITypeInfo*
+{
+    int32 type_id;
+    FO_RUNTIME_ASSERT(func->GetParam(0, &type_id) >= 0);
+
+    return func->GetEngine()->GetTypeInfoById(type_id);
+}
+
+TEST_CASE("AngelScriptArgArrays")
+{
+    auto* as_engine = CreateArgArraysTestEngine();
+    auto release_engine = ScopeCallback([&]() noexcept { as_engine->ShutDownAndRelease(); });
+    auto* mod = as_engine->GetModule("ArgArraysTest");
+    auto* func = mod->GetFunctionByName("OnAppear");
+    auto* store_func = mod->GetFunctionByName("OnAppearStore");
+    auto* ctx = as_engine->CreateContext();
+    auto release_ctx = ScopeCallback([&]() noexcept { ctx->Release(); });
+    auto* ti = GetArgArrayType(func);
+    const vector<int32> values = {1, 2, 3, 4, 5};
+
+    SECTION("SameResult")
+    {
+        ScriptArrayPool pool;
+        CHECK(DispatchByName(ctx, func, values) == 15);
+        CHECK(DispatchCached(ctx, func, ti, values) == 15);
+        CHECK(DispatchPooled(ctx, func, ti, pool, values) == 15);
+        CHECK(DispatchPooled(ctx, func, ti, pool, {7}) == 7);
+    }
+
+    SECTION("ArrayRecycled")
+    {
+        ScriptArrayPool pool;
+        auto* arr = pool.Request(ti);
+        FillArray(arr, values);
+        CHECK(CallWithArray(ctx, func, arr) == 15);
+        pool.Return(arr, true);
+        CHECK(pool.GetFreeCount(ti) == 1);
+
+        auto* arr2 = pool.Request(ti);
+        CHECK(arr2 == arr);
+        CHECK(arr2->GetSize() == 0);
+        CHECK(pool.GetFreeCount(ti) == 0);
+        pool.Return(arr2, false);
+        CHECK(pool.GetFreeCount(ti) == 0);
+    }
+
+    SECTION("KeptArrayNotRecycled")
+    {
+        ScriptArrayPool pool;
+        auto* arr = pool.Request(ti);
+        FillArray(arr, values);
+        CHECK(CallWithArray(ctx, store_func, arr) == 5);
+        pool.Return(arr, true);
+        CHECK(pool.GetFreeCount(ti) == 0);
+
+        auto* stored = *static_cast<ScriptArray**>(mod->GetAddressOfGlobalVar(mod->GetGlobalVarIndexByName("Stored")));
+        REQUIRE(stored == arr);
+        CHECK(stored->GetSize() == 5);
+    }
+}
+
+TEST_CASE("AngelScriptArgArraysBenchmark", "[.benchmark]")
+{
+    auto* as_engine = CreateArgArraysTestEngine();
+    auto release_engine = ScopeCallback([&]() noexcept { as_engine->ShutDownAndRelease(); });
+    auto* func = as_engine->GetModule("ArgArraysTest")->GetFunctionByName("OnAppear");
+    auto* ctx = as_engine->CreateContext();
+    auto release_ctx = ScopeCallback([&]() noexcept { ctx->Release(); });
+    auto* ti = GetArgArrayType(func);
+    ScriptArrayPool pool;
+
+    vector<int32> values;
+
+    for (int32 i = 0; i < 64; i++) {
+        values.emplace_back(i);
+    }
+
+    BENCHMARK("resolve by name and insert")
+    {
+        return DispatchByName(ctx, func, values);
+    };
+
+    BENCHMARK("cached type and bulk fill")
+    {
+        return DispatchCached(ctx, func, ti, values);
+    };
+
+    BENCHMARK("cached type and recycled array")
+    {
+        return DispatchPooled(ctx, func, ti, pool, values);
+    };
+}
+
+FO_END_NAMESPACE();
+
+#endif
@@ -0,0 +1,218 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+#if FO_ANGELSCRIPT_SCRIPTING
+
+#include "AngelScriptCallSites.h"
+
+#include <as_context.h>
+#include <as_scriptfunction.h>
+
+FO_BEGIN_NAMESPACE();
+
+static constexpr string_view CALL_SITES_TEST_SCRIPT = "int Fib(int n) { return n < 2 ? n : Fib(n - 1) + Fib(n - 2); }\n";
+
+struct CallSitesTestData
+{
+    std::mutex Locker {};
+    unordered_map<size_t, StackTraceEntryStorage> Entries {};
+    size_t Fills {};
+};
+
+static CallSitesTestData CallSitesTest;
+
+static void FillCallSiteTestEntry(StackTraceEntryStorage& storage, AngelScript::asIScriptFunction* func)
+{
+    const string_view decl = func->GetDeclaration(true);
+    storage.FuncBufLen = std::min(decl.length(), storage.FuncBuf.size() - 1);
+    MemCopy(storage.FuncBuf.data(), decl.data(), storage.FuncBufLen);
+    storage.SrcLoc.function = storage.FuncBuf.data();
+    storage.SrcLoc.file = "CallSitesTest";
+    CallSitesTest.Fills++;
+}
+
+// Previous behaviour, every call takes lock and looks up position in hash map
+static void LockedMapBeginCall(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, size_t program_pos)
+{
+    ignore_unused(ctx);
+
+    StackTraceEntryStorage* storage;
+
+    {
+        std::scoped_lock lock {CallSitesTest.Locker};
+
+        const auto it = CallSitesTest.Entries.find(program_pos);
+
+        if (it != CallSitesTest.Entries.end()) {
+            storage = &it->second;
+        }
+        else {
+            storage = &CallSitesTest.Entries.emplace(program_pos, StackTraceEntryStorage {}).first->second;
+            FillCallSiteTestEntry(*storage, func);
+        }
+    }
+
+    PushStackTrace(storage->SrcLoc);
+}
+
+static void CallSiteTableBeginCall(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, size_t program_pos)
+{
+    auto* slot = FindScriptCallSite(ctx, func, program_pos);
+    FO_STRONG_ASSERT(slot);
+
+    const auto* storage = ResolveScriptCallSite(*slot, [&](StackTraceEntryStorage& new_storage) { FillCallSiteTestEntry(new_storage, func); });
+
+    PushStackTrace(storage->SrcLoc);
+}
+
+static void TracedEndCall(AngelScript::asIScriptContext* ctx)
+{
+    ignore_unused(ctx);
+
+    PopStackTrace();
+}
+
+static auto CreateCallSitesTestEngine() -> AngelScript::asIScriptEngine*
+{
+    auto* as_engine = AngelScript::asCreateScriptEngine();
+    FO_RUNTIME_ASSERT(as_engine);
+
+    auto* mod = as_engine->GetModule("CallSitesTest", AngelScript::asGM_ALWAYS_CREATE);
+    FO_RUNTIME_ASSERT(mod->AddScriptSection("CallSitesTest", CALL_SITES_TEST_SCRIPT.data(), CALL_SITES_TEST_SCRIPT.size()) >= 0);
+    FO_RUNTIME_ASSERT(mod->Build() >= 0);
+
+    return as_engine;
+}
+
+static auto RunFib(AngelScript::asIScriptContext* ctx, AngelScript::asIScriptFunction* func, int32 n) -> int32
+{
+    ctx->Prepare(func);
+    ctx->SetArgDWord(0, static_cast<AngelScript::asDWORD>(n));
+    FO_RUNTIME_ASSERT(ctx->Execute() == AngelScript::asEXECUTION_FINISHED);
+
+    return static_cast<int32>(ctx->GetReturnDWord());
+}
+
+TEST_CASE("AngelScriptCallSites")
+{
+    auto* as_engine = CreateCallSitesTestEngine();
+    auto release_engine = ScopeCallback([&]() noexcept { as_engine->ShutDownAndRelease(); });
+    auto* func = as_engine->GetModule("CallSitesTest")->GetFunctionByName("Fib");
+    auto* ctx = as_engine->CreateContext();
+    auto release_ctx = ScopeCallback([&]() noexcept { ctx->Release(); });
+
+    SECTION("UnpreparedFunction")
+    {
+        CHECK(FindScriptCallSite(ctx, func, reinterpret_cast<size_t>(func)) == nullptr);
+    }
+
+    SECTION("CallSitesPrepared")
+    {
+        PrepareScriptCallSites(as_engine);
+
+        const auto* func_data = static_cast<AngelScript::asCScriptFunction*>(func)->Ext;
+        REQUIRE(func_data != nullptr);
+        CHECK(func_data->CallSiteOffsets.size() == 2);
+        CHECK(FindScriptCallSite(ctx, func, reinterpret_cast<size_t>(func)) == &func_data->EntryCall);
+    }
+
+    SECTION("SlotsFilledOnce")
+    {
+        PrepareScriptCallSites(as_engine);
+
+        static_cast<AngelScript::asCContext*>(ctx)->Ext2.BeginScriptCall = CallSiteTableBeginCall;
+        static_cast<AngelScript::asCContext*>(ctx)->Ext2.EndScriptCall = TracedEndCall;
+
+        const auto fills_before = CallSitesTest.Fills;
+        CHECK(RunFib(ctx, func, 10) == 55);
+        CHECK(CallSitesTest.Fills == fills_before + 3);
+        CHECK(RunFib(ctx, func, 12) == 144);
+        CHECK(CallSitesTest.Fills == fills_before + 3);
+    }
+
+    SECTION("FreedWithFunctions")
+    {
+        const auto count_before = GetScriptCallSitesCount();
+
+        auto* other_engine = CreateCallSitesTestEngine();
+        PrepareScriptCallSites(other_engine);
+
+        const auto prepared_count = GetScriptCallSitesCount();
+        CHECK(prepared_count > count_before);
+
+        other_engine->GetModule("CallSitesTest")->Discard();
+        other_engine->GarbageCollect();
+        CHECK(GetScriptCallSitesCount() < prepared_count);
+
+        other_engine->ShutDownAndRelease();
+        CHECK(GetScriptCallSitesCount() == count_before);
+    }
+}
+
+TEST_CASE("AngelScriptCallSitesBenchmark", "[.benchmark]")
+{
+    auto* as_engine = CreateCallSitesTestEngine();
+    auto release_engine = ScopeCallback([&]() noexcept { as_engine->ShutDownAndRelease(); });
+    auto* func = as_engine->GetModule("CallSitesTest")->GetFunctionByName("Fib");
+    auto* ctx = as_engine->CreateContext();
+    auto release_ctx = ScopeCallback([&]() noexcept { ctx->Release(); });
+    auto& ctx_ext2 = static_cast<AngelScript::asCContext*>(ctx)->Ext2;
+
+    PrepareScriptCallSites(as_engine);
+
+    BENCHMARK("no call tracking")
+    {
+        ctx_ext2 = {};
+        return RunFib(ctx, func, 20);
+    };
+
+    BENCHMARK("locked map call tracking")
+    {
+        ctx_ext2 = {.BeginScriptCall = LockedMapBeginCall, .EndScriptCall = TracedEndCall};
+        return RunFib(ctx, func, 20);
+    };
+
+    BENCHMARK("call site table tracking")
+    {
+        ctx_ext2 = {.BeginScriptCall = CallSiteTableBeginCall, .EndScriptCall = TracedEndCall};
+        return RunFib(ctx, func, 20);
+    };
+}
+
+FO_END_NAMESPACE();
+
+#endif
@@ -0,0 +1,347 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+#if FO_ANGELSCRIPT_SCRIPTING
+
+#include "AngelScriptArray.h"
+#include "AngelScriptDict.h"
+#include "AngelScriptString.h"
+
+FO_BEGIN_NAMESPACE();
+
+static constexpr string_view DICT_TEST_SCRIPT = "class Obj { int Value; }\n"
+                                                "int FirstKey() { dict<int, int> d = {{30, 3}, {10, 1}, {20, 2}}; return d.getKey(0) * 100 + d.getKey(1) * 10 + d.getKey(2) / 10; }\n";
+
+static auto CreateDictTestEngine() -> AngelScript::asIScriptEngine*
+{
+    auto* as_engine = AngelScript::asCreateScriptEngine();
+    FO_RUNTIME_ASSERT(as_engine);
+    FO_RUNTIME_ASSERT(as_engine->SetEngineProperty(AngelScript::asEP_ALLOW_UNSAFE_REFERENCES, true) >= 0);
+    FO_RUNTIME_ASSERT(as_engine->SetEngineProperty(AngelScript::asEP_ALLOW_IMPLICIT_HANDLE_TYPES, true) >= 0);
+
+    RegisterAngelScriptString(as_engine);
+    RegisterAngelScriptArray(as_engine);
+    RegisterAngelScriptDict(as_engine);
+
+    auto* mod = as_engine->GetModule("DictTest", AngelScript::asGM_ALWAYS_CREATE);
+    FO_RUNTIME_ASSERT(mod->AddScriptSection("DictTest", DICT_TEST_SCRIPT.data(), DICT_TEST_SCRIPT.size()) >= 0);
+    FO_RUNTIME_ASSERT(mod->Build() >= 0);
+
+    return as_engine;
+}
+
+static auto CreateDict(AngelScript::asIScriptEngine* as_engine, string_view decl) -> ScriptDict*
+{
+    auto* ti = as_engine->GetTypeInfoByDecl(string(decl).c_str());
+    FO_RUNTIME_ASSERT(ti);
+
+    return ScriptDict::Create(ti);
+}
+
+static void FillIntDict(ScriptDict* dict, int32 count)
+{
+    for (int32 i = 0; i < count; i++) {
+        int32 key = (i * 7919) % count;
+        int32 value = i;
+        dict->Set(&key, &value);
+    }
+}
+
+TEST_CASE("AngelScriptDict")
+{
+    auto* as_engine = CreateDictTestEngine();
+    auto release_engine = ScopeCallback([&]() noexcept { as_engine->ShutDownAndRelease(); });
+
+    SECTION("HashedIntKeys")
+    {
+        auto* dict = CreateDict(as_engine, "dict<int, int>");
+        auto release_dict = ScopeCallback([&]() noexcept { dict->Release(); });
+        CHECK(dict->IsHashed());
+
+        FillIntDict(dict, 1000);
+        CHECK(dict->GetSize() == 1000);
+
+        for (int32 i = 0; i < 1000; i++) {
+            CHECK(*static_cast<int32*>(dict->GetKey(i)) == i);
+        }
+
+        int32 key = 999;
+        CHECK(dict->Exists(&key));
+        int32 value = -1;
+        dict->Set(&key, &value);
+        CHECK(*static_cast<int32*>(dict->Get(&key)) == -1);
+        CHECK(dict->GetSize() == 1000);
+
+        key = 1000;
+        CHECK_FALSE(dict->Exists(&key));
+        CHECK_THROWS(dict->Get(&key));
+    }
+
+    SECTION("HashedRemove")
+    {
+        auto* dict = CreateDict(as_engine, "dict<int, int>");
+        auto release_dict = ScopeCallback([&]() noexcept { dict->Release(); });
+
+        FillIntDict(dict, 1000);
+
+        for (int32 i = 0; i < 1000; i += 2) {
+            CHECK(dict->Remove(&i));
+            CHECK_FALSE(dict->Remove(&i));
+        }
+
+        CHECK(dict->GetSize() == 500);
+
+        for (int32 i = 0; i < 1000; i++) {
+            CHECK(dict->Exists(&i) == (i % 2 != 0));
+        }
+
+        int32 value = 0;
+        dict->Set(&value, &value);
+        int32 key = 1;
+        dict->Set(&key, &value);
+        CHECK(dict->RemoveValues(&value) == 2);
+        CHECK(dict->GetSize() == 499);
+        CHECK(*static_cast<int32*>(dict->GetKey(0)) == 3);
+
+        dict->Clear();
+        CHECK(dict->IsEmpty());
+        CHECK_FALSE(dict->Exists(&key));
+    }
+
+    SECTION("HashedFloatZero")
+    {
+        auto* dict = CreateDict(as_engine, "dict<float, int>");
+        auto release_dict = ScopeCallback([&]() noexcept { dict->Release(); });
+
+        float32 key = 0.0f;
+        int32 value = 1;
+        dict->Set(&key, &value);
+        key = -0.0f;
+        CHECK(dict->Exists(&key));
+        dict->Set(&key, &value);
+        CHECK(dict->GetSize() == 1);
+    }
+
+    SECTION("HashedStringKeys")
+    {
+        auto* dict = CreateDict(as_engine, "dict<string, int>");
+        auto release_dict = ScopeCallback([&]() noexcept { dict->Release(); });
+        CHECK(dict->IsHashed());
+
+        for (const string_view name : {"charlie", "alpha", "bravo", "delta"}) {
+            string key {name};
+            int32 value = numeric_cast<int32>(key.length());
+            dict->Set(&key, &value);
+        }
+
+        CHECK(*static_cast<string*>(dict->GetKey(0)) == "alpha");
+        CHECK(*static_cast<string*>(dict->GetKey(3)) == "delta");
+
+        string key = "bravo";
+        CHECK(*static_cast<int32*>(dict->Get(&key)) == 5);
+        CHECK(dict->Remove(&key));
+        CHECK(*static_cast<string*>(dict->GetKey(1)) == "charlie");
+    }
+
+    SECTION("OverwriteKeepsEntries")
+    {
+        auto* dict = CreateDict(as_engine, "dict<string, int>");
+        auto release_dict = ScopeCallback([&]() noexcept { dict->Release(); });
+
+        for (const string_view name : {"charlie", "alpha", "bravo"}) {
+            string key {name};
+            int32 value = 0;
+            dict->Set(&key, &value);
+        }
+
+        CHECK(dict->GetEntries().size() == 3);
+
+        for (int32 i = 0; i < 3; i++) {
+            string key = *static_cast<string*>(dict->GetKey(i));
+            int32 value = i + 10;
+            dict->Set(&key, &value);
+
+            CHECK(*static_cast<int32*>(dict->GetValue(i)) == i + 10);
+            CHECK(dict->GetValue(i) == dict->Get(&key));
+        }
+
+        CHECK(*static_cast<string*>(dict->GetKey(0)) == "alpha");
+        CHECK(*static_cast<string*>(dict->GetKey(2)) == "charlie");
+    }
+
+    SECTION("CopyAndEquals")
+    {
+        auto* dict = CreateDict(as_engine, "dict<int, int>");
+        auto release_dict = ScopeCallback([&]() noexcept { dict->Release(); });
+        auto* dict2 = CreateDict(as_engine, "dict<int, int>");
+        auto release_dict2 = ScopeCallback([&]() noexcept { dict2->Release(); });
+
+        FillIntDict(dict, 100);
+        *dict2 = *dict;
+        CHECK(*dict2 == *dict);
+
+        int32 key = 50;
+        int32 value = -1;
+        dict2->Set(&key, &value);
+        CHECK_FALSE(*dict2 == *dict);
+    }
+
+    SECTION("TreeForHandles")
+    {
+        auto* dict = CreateDict(as_engine, "dict<Obj@, int>");
+        auto release_dict = ScopeCallback([&]() noexcept { dict->Release(); });
+        CHECK_FALSE(dict->IsHashed());
+    }
+
+    SECTION("ScriptOrder")
+    {
+        auto* ctx = as_engine->CreateContext();
+        auto release_ctx = ScopeCallback([&]() noexcept { ctx->Release(); });
+
+        ctx->Prepare(as_engine->GetModule("DictTest")->GetFunctionByName("FirstKey"));
+        REQUIRE(ctx->Execute() == AngelScript::asEXECUTION_FINISHED);
+        CHECK(static_cast<int32>(ctx->GetReturnDWord()) == 1000 + 200 + 3);
+    }
+}
+
+TEST_CASE("AngelScriptDictBenchmark", "[.benchmark]")
+{
+    auto* as_engine = CreateDictTestEngine();
+    auto release_engine = ScopeCallback([&]() noexcept { as_engine->ShutDownAndRelease(); });
+
+    constexpr int32 keys_count = 10000;
+
+    auto* int_dict = CreateDict(as_engine, "dict<int, int>");
+    auto release_int_dict = ScopeCallback([&]() noexcept { int_dict->Release(); });
+    FillIntDict(int_dict, keys_count);
+
+    auto* str_dict = CreateDict(as_engine, "dict<string, int>");
+    auto release_str_dict = ScopeCallback([&]() noexcept { str_dict->Release(); });
+    vector<string> str_keys;
+
+    for (int32 i = 0; i < keys_count; i++) {
+        str_keys.emplace_back(strex("Key{}", i).str());
+        str_dict->Set(&str_keys.back(), &i);
+    }
+
+    // Reference ordered container, same shape as previous tree storage
+    map<int32, int32> ref_map;
+
+    for (int32 i = 0; i < keys_count; i++) {
+        ref_map.emplace((i * 7919) % keys_count, i);
+    }
+
+    BENCHMARK("int insert")
+    {
+        auto* dict = CreateDict(as_engine, "dict<int, int>");
+        FillIntDict(dict, keys_count);
+        const auto size = dict->GetSize();
+        dict->Release();
+        return size;
+    };
+
+    BENCHMARK("int insert reference map")
+    {
+        map<int32, int32> m;
+
+        for (int32 i = 0; i < keys_count; i++) {
+            m.emplace((i * 7919) % keys_count, i);
+        }
+
+        return m.size();
+    };
+
+    BENCHMARK("int lookup")
+    {
+        int64 sum = 0;
+
+        for (int32 i = 0; i < keys_count; i++) {
+            sum += *static_cast<int32*>(int_dict->Get(&i));
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("int lookup reference map")
+    {
+        int64 sum = 0;
+
+        for (int32 i = 0; i < keys_count; i++) {
+            sum += ref_map.find(i)->second;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("string lookup")
+    {
+        int64 sum = 0;
+
+        for (auto& key : str_keys) {
+            sum += *static_cast<int32*>(str_dict->Get(&key));
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("int iterate")
+    {
+        int64 sum = 0;
+
+        for (int32 i = 0; i < int_dict->GetSize(); i++) {
+            sum += *static_cast<int32*>(int_dict->GetValue(i));
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("int iterate reference map")
+    {
+        int64 sum = 0;
+
+        for (const auto& [key, value] : ref_map) {
+            sum += value;
+        }
+
+        return sum;
+    };
+}
+
+FO_END_NAMESPACE();
+
+#endif
@@ -0,0 +1,268 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "BroadcastThrottler.h"
+
+FO_BEGIN_NAMESPACE();
+
+TEST_CASE("BroadcastThrottler")
+{
+    const auto start_time = nanotime(timespan(std::chrono::seconds {100}));
+    const auto tick = timespan(std::chrono::milliseconds {10});
+
+    SECTION("ZeroPeriodPassThrough")
+    {
+        BroadcastThrottler throttler;
+
+        for (int32 i = 0; i < 10; i++) {
+            CHECK(throttler.Push(ident_t {1}, 0, start_time + timespan(tick.value() * i), timespan::zero));
+        }
+
+        CHECK(throttler.GetPendingCount() == 0);
+    }
+
+    SECTION("SameTickSlots")
+    {
+        BroadcastThrottler throttler;
+        const auto period = timespan(std::chrono::milliseconds {200});
+
+        CHECK(throttler.Push(ident_t {1}, 0, start_time, period));
+        CHECK(throttler.Push(ident_t {1}, 1, start_time, period));
+        CHECK(throttler.Push(ident_t {2}, 0, start_time, period));
+        CHECK_FALSE(throttler.Push(ident_t {1}, 0, start_time + tick, period));
+        CHECK_FALSE(throttler.Push(ident_t {1}, 0, start_time + tick + tick, period));
+        CHECK(throttler.IsPending(ident_t {1}, 0));
+        CHECK(throttler.GetPendingCount() == 1);
+
+        throttler.Cancel(ident_t {1});
+        CHECK_FALSE(throttler.IsPending(ident_t {1}, 0));
+        CHECK(throttler.GetPendingCount() == 0);
+    }
+
+    SECTION("IndependentSlots")
+    {
+        // Two properties of same entity change in one window, throttled one must not delay another
+        BroadcastThrottler throttler;
+        const auto period = timespan(std::chrono::milliseconds {200});
+        vector<uint32> flushed;
+
+        CHECK(throttler.Push(ident_t {1}, 0, start_time, period));
+        CHECK_FALSE(throttler.Push(ident_t {1}, 0, start_time + tick, period));
+        CHECK(throttler.Push(ident_t {1}, 1, start_time + tick, period));
+        CHECK(throttler.IsPending(ident_t {1}, 0));
+        CHECK_FALSE(throttler.IsPending(ident_t {1}, 1));
+
+        CHECK_FALSE(throttler.Push(ident_t {1}, 1, start_time + tick + tick, period));
+        CHECK(throttler.GetPendingCount() == 2);
+
+        const auto flush = [&](nanotime time) {
+            throttler.Flush(time, [&](ident_t id, uint32 slot) {
+                CHECK(id == ident_t {1});
+                flushed.emplace_back(slot);
+            });
+        };
+
+        // Each slot is flushed at end of own window
+        flush(start_time + period);
+        CHECK(flushed == vector<uint32> {0});
+        flush(start_time + tick + period);
+        CHECK(flushed == vector<uint32> {0, 1});
+        CHECK(throttler.GetPendingCount() == 0);
+
+        throttler.Cancel(ident_t {1});
+        CHECK(throttler.IsEmpty());
+    }
+
+    SECTION("ClientStateConvergence")
+    {
+        // Source changes its state every tick, observers at different periods receive only some of the updates
+        struct SimulatedClient
+        {
+            timespan Period {};
+            BroadcastThrottler Throttler {};
+            vector<int32> State {};
+            size_t Messages {};
+        };
+
+        constexpr uint32 slots_count = 3;
+        vector<int32> server_state(slots_count);
+        vector<SimulatedClient> clients;
+
+        for (const int32 period_ms : {0, 50, 200, 1000}) {
+            auto& client = clients.emplace_back();
+            client.Period = std::chrono::milliseconds {period_ms};
+            client.State.resize(slots_count);
+        }
+
+        auto time = start_time;
+
+        const auto flush_all = [&] {
+            for (auto& client : clients) {
+                client.Throttler.Flush(time, [&](ident_t, uint32 slot) {
+                    client.State[slot] = server_state[slot];
+                    client.Messages++;
+                });
+            }
+        };
+
+        for (int32 i = 0; i < 500; i++) {
+            time += tick;
+            flush_all();
+
+            // Fixed pattern of slot changes, each change produces unique value
+            const auto slot = numeric_cast<uint32>((i * 7 + i / 5) % numeric_cast<int32>(slots_count));
+            server_state[slot] = i + 1;
+
+            for (auto& client : clients) {
+                if (client.Throttler.Push(ident_t {1}, slot, time, client.Period)) {
+                    client.State[slot] = server_state[slot];
+                    client.Messages++;
+                }
+            }
+        }
+
+        // Changes stopped, after longest period all clients must see final state
+        for (int32 i = 0; i < 110; i++) {
+            time += tick;
+            flush_all();
+        }
+
+        for (const auto& client : clients) {
+            CHECK(client.State == server_state);
+            CHECK(client.Throttler.GetPendingCount() == 0);
+            CHECK(client.Throttler.IsEmpty());
+        }
+
+        CHECK(clients[0].Messages == 500);
+        CHECK(clients[1].Messages < clients[0].Messages);
+        CHECK(clients[2].Messages < clients[1].Messages);
+        CHECK(clients[3].Messages < clients[2].Messages);
+        CHECK(clients[3].Messages < 30);
+    }
+
+    SECTION("PeriodForDistance")
+    {
+        const vector<int32> distances = {10, 20, 40};
+        const vector<int32> periods = {100, 250, 1000};
+
+        CHECK(BroadcastThrottler::GetPeriodForDistance(distances, periods, 0) == timespan::zero);
+        CHECK(BroadcastThrottler::GetPeriodForDistance(distances, periods, 9) == timespan::zero);
+        CHECK(BroadcastThrottler::GetPeriodForDistance(distances, periods, 10) == timespan(std::chrono::milliseconds {100}));
+        CHECK(BroadcastThrottler::GetPeriodForDistance(distances, periods, 39) == timespan(std::chrono::milliseconds {250}));
+        CHECK(BroadcastThrottler::GetPeriodForDistance(distances, periods, 100) == timespan(std::chrono::milliseconds {1000}));
+        CHECK(BroadcastThrottler::GetPeriodForDistance({}, {}, 100) == timespan::zero);
+    }
+
+    SECTION("ValidateSettings")
+    {
+        CHECK_NOTHROW(BroadcastThrottler::ValidateSettings({}, {}));
+        CHECK_NOTHROW(BroadcastThrottler::ValidateSettings(vector<int32> {10, 20}, vector<int32> {100, 200}));
+        CHECK_THROWS_AS(BroadcastThrottler::ValidateSettings(vector<int32> {10, 20}, vector<int32> {100}), BroadcastThrottlerException);
+        CHECK_THROWS_AS(BroadcastThrottler::ValidateSettings(vector<int32> {10}, vector<int32> {100, 200}), BroadcastThrottlerException);
+        CHECK_THROWS_AS(BroadcastThrottler::ValidateSettings(vector<int32> {20, 10}, vector<int32> {100, 200}), BroadcastThrottlerException);
+        CHECK_THROWS_AS(BroadcastThrottler::ValidateSettings(vector<int32> {10}, vector<int32> {-1}), BroadcastThrottlerException);
+    }
+
+    SECTION("ThrottledBroadcast")
+    {
+        // Same flow as critter broadcast: period is selected by observer distance, sent now or coalesced and sent on flush
+        const vector<int32> distances = {10, 30};
+        const vector<int32> periods = {100, 500};
+
+        struct Observer
+        {
+            int32 Distance {};
+            BroadcastThrottler Throttler {};
+            vector<int32> ReceivedDirs {};
+        };
+
+        vector<Observer> observers(3);
+        observers[0].Distance = 5;
+        observers[1].Distance = 15;
+        observers[2].Distance = 50;
+
+        constexpr uint32 dir_slot = 1;
+        int32 dir = 0;
+        auto time = start_time;
+
+        const auto broadcast_dir = [&] {
+            for (auto& observer : observers) {
+                const auto period = BroadcastThrottler::GetPeriodForDistance(distances, periods, observer.Distance);
+
+                if (period == timespan::zero || observer.Throttler.Push(ident_t {1}, dir_slot, time, period)) {
+                    observer.ReceivedDirs.emplace_back(dir);
+                }
+            }
+        };
+
+        const auto flush = [&] {
+            for (auto& observer : observers) {
+                observer.Throttler.Flush(time, [&](ident_t id, uint32 slot) {
+                    CHECK(id == ident_t {1});
+                    CHECK(slot == dir_slot);
+                    observer.ReceivedDirs.emplace_back(dir);
+                });
+            }
+        };
+
+        // Dir changes every tick during 200ms
+        for (int32 i = 0; i < 20; i++) {
+            time += tick;
+            flush();
+            dir++;
+            broadcast_dir();
+        }
+
+        CHECK(observers[0].ReceivedDirs.size() == 20);
+        CHECK(observers[1].ReceivedDirs == vector<int32> {1, 10, 11});
+        CHECK(observers[2].ReceivedDirs == vector<int32> {1});
+
+        // Changes stopped, pending state is delivered and throttling state expires after longest period
+        for (int32 i = 0; i < 110; i++) {
+            time += tick;
+            flush();
+        }
+
+        for (const auto& observer : observers) {
+            CHECK(observer.ReceivedDirs.back() == dir);
+            CHECK(observer.Throttler.IsEmpty());
+        }
+
+        CHECK(observers[1].ReceivedDirs == vector<int32> {1, 10, 11, 20});
+        CHECK(observers[2].ReceivedDirs == vector<int32> {1, 20});
+    }
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,183 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "ClientConnection.h"
+#include "Settings.h"
+
+#if !FO_WINDOWS && !FO_WEB
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+FO_BEGIN_NAMESPACE();
+
+static void ApplyTestConnectionSettings(GlobalSettings& settings, string_view host, uint16 port)
+{
+    const auto host_str = string(host);
+    const auto port_str = strex("{}", port).str();
+    const char* args[] = {"-ServerHost", host_str.c_str(), "-ServerPort", port_str.c_str(), "-NetReceiveThread", "1", "-PingPeriod", "0"};
+
+    settings.ApplyCommandLine(numeric_cast<int32>(std::size(args)), const_cast<char**>(args));
+}
+
+// Blocks in receive on other thread, disconnect must wake it before wait timeout
+static void CheckDisconnectWakesReceive(NetworkClientConnection& conn)
+{
+    REQUIRE(conn.IsConnected());
+
+    const auto wait_timeout = timespan(std::chrono::seconds {5});
+    std::atomic_bool wait_started {};
+
+    const auto start_time = nanotime::now();
+
+    std::thread receive_thread([&] {
+        wait_started = true;
+        conn.WaitReceive(wait_timeout);
+    });
+
+    while (!wait_started) {
+        std::this_thread::yield();
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds {50});
+
+    conn.Disconnect();
+    receive_thread.join();
+
+    CHECK_FALSE(conn.IsConnected());
+    CHECK(nanotime::now() - start_time < timespan(std::chrono::seconds {2}));
+    CHECK_FALSE(conn.WaitReceive(wait_timeout));
+}
+
+TEST_CASE("ClientConnection")
+{
+    SECTION("InterthreadDisconnectWakesReceive")
+    {
+        constexpr uint16 port = 43001;
+        GlobalSettings settings {false};
+        ApplyTestConnectionSettings(settings, "localhost", port);
+
+        InterthreadListeners.emplace(port, [](InterthreadDataCallback client_send) -> InterthreadDataCallback {
+            (void)client_send;
+            return [](span<const uint8> buf) { (void)buf; };
+        });
+
+        {
+            auto conn = NetworkClientConnection::CreateInterthreadConnection(settings);
+            CheckDisconnectWakesReceive(*conn);
+        }
+
+        InterthreadListeners.erase(port);
+    }
+
+#if !FO_WINDOWS && !FO_WEB
+    SECTION("SocketsDisconnectWakesReceive")
+    {
+        const auto listen_sock = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        REQUIRE(listen_sock >= 0);
+
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t addr_len = sizeof(addr);
+        REQUIRE(::bind(listen_sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+        REQUIRE(::listen(listen_sock, 1) == 0);
+        REQUIRE(::getsockname(listen_sock, reinterpret_cast<sockaddr*>(&addr), &addr_len) == 0);
+
+        GlobalSettings settings {false};
+        ApplyTestConnectionSettings(settings, "127.0.0.1", ::ntohs(addr.sin_port));
+
+        {
+            auto conn = NetworkClientConnection::CreateSocketsConnection(settings);
+            const auto connect_deadline = nanotime::now() + std::chrono::seconds {5};
+
+            while (conn->IsConnecting() && nanotime::now() < connect_deadline) {
+                conn->CheckStatus(true);
+                std::this_thread::sleep_for(std::chrono::milliseconds {1});
+            }
+
+            const auto server_sock = ::accept(listen_sock, nullptr, nullptr);
+            REQUIRE(server_sock >= 0);
+
+            // Server stays silent, so only disconnect can end the wait early
+            CheckDisconnectWakesReceive(*conn);
+
+            ::close(server_sock);
+        }
+
+        ::close(listen_sock);
+    }
+#endif
+
+    SECTION("SendFailureWhileReceiveThreadWaits")
+    {
+        // Send error disconnects low level connection while receive thread is blocked on it
+        constexpr uint16 port = 43002;
+        GlobalSettings settings {false};
+        ApplyTestConnectionSettings(settings, "localhost", port);
+
+        InterthreadListeners.emplace(port, [](InterthreadDataCallback client_send) -> InterthreadDataCallback {
+            (void)client_send;
+            return [](span<const uint8> buf) {
+                if (!buf.empty()) {
+                    throw NetworkClientException("Test send failure");
+                }
+            };
+        });
+
+        {
+            ClientConnection conn {settings};
+            optional<ClientConnection::ConnectResult> connect_result;
+            conn.SetConnectHandler([&](ClientConnection::ConnectResult result) { connect_result = result; });
+
+            conn.Connect();
+            REQUIRE(conn.IsConnecting());
+
+            conn.Process();
+
+            CHECK_FALSE(conn.IsConnecting());
+            CHECK_FALSE(conn.IsConnected());
+            REQUIRE(connect_result.has_value());
+            CHECK(connect_result.value() == ClientConnection::ConnectResult::Failed);
+        }
+
+        InterthreadListeners.erase(port);
+    }
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,205 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "DataBase.h"
+#include "Settings.h"
+
+FO_BEGIN_NAMESPACE();
+
+static auto WaitPrefetched(DataBase& db, size_t prefetch_id) -> AnyData::Document
+{
+    while (true) {
+        auto doc = db.TakePrefetched(prefetch_id);
+
+        if (doc.has_value()) {
+            return std::move(doc.value());
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds {1});
+    }
+}
+
+TEST_CASE("DataBasePrefetch")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    auto db = ConnectToDataBase(settings, "Memory");
+    const auto collection = hashes.ToHashedString("Players");
+    const auto id = ident_t {1};
+
+    AnyData::Document doc;
+    doc.Emplace("Name", string("Player"));
+    doc.Emplace("Value", numeric_cast<int64>(1));
+    db.Insert(collection, id, doc);
+    db.CommitChanges(true);
+
+    SECTION("Committed")
+    {
+        const auto prefetch_id = db.Prefetch(collection, id);
+        const auto fetched = WaitPrefetched(db, prefetch_id);
+
+        CHECK(fetched == db.Get(collection, id));
+        CHECK(db.GetPrefetchCount() == 0);
+    }
+
+    SECTION("InterleavedChanges")
+    {
+        const auto prefetch_id = db.Prefetch(collection, id);
+
+        db.Update(collection, id, "Value", numeric_cast<int64>(2));
+        db.CommitChanges(false);
+        db.Update(collection, id, "Value", numeric_cast<int64>(3));
+        db.Update(collection, id, "Extra", string("Pending"));
+
+        const auto fetched = WaitPrefetched(db, prefetch_id);
+
+        CHECK(fetched == db.Get(collection, id));
+        CHECK(fetched["Value"] == AnyData::Value(numeric_cast<int64>(3)));
+        CHECK(fetched.Contains("Extra"));
+    }
+
+    SECTION("Deleted")
+    {
+        const auto prefetch_id = db.Prefetch(collection, id);
+
+        db.Delete(collection, id);
+        db.CommitChanges(false);
+
+        const auto fetched = WaitPrefetched(db, prefetch_id);
+
+        CHECK(fetched.Empty());
+        CHECK(db.Get(collection, id).Empty());
+    }
+
+    SECTION("Missing")
+    {
+        const auto prefetch_id = db.Prefetch(collection, ident_t {2});
+
+        CHECK(WaitPrefetched(db, prefetch_id).Empty());
+    }
+
+    SECTION("Cancel")
+    {
+        const auto prefetch_id = db.Prefetch(collection, id);
+        db.CancelPrefetch(prefetch_id);
+
+        CHECK(db.GetPrefetchCount() == 0);
+    }
+
+    SECTION("CancelAfterReady")
+    {
+        const auto prefetch_id = db.Prefetch(collection, id);
+        db.CommitChanges(true);
+        db.CancelPrefetch(prefetch_id);
+
+        CHECK(db.GetPrefetchCount() == 0);
+        CHECK(WaitPrefetched(db, db.Prefetch(collection, id)) == db.Get(collection, id));
+    }
+
+    SECTION("LoginPipeline")
+    {
+        // Same flow as server login queue, requests polled from main thread while commit thread fetches
+        constexpr int32 players_count = 64;
+
+        for (int32 i = 2; i <= players_count; i++) {
+            AnyData::Document player_doc;
+            player_doc.Emplace("Name", strex("Player{}", i).str());
+            player_doc.Emplace("Value", numeric_cast<int64>(i));
+            db.Insert(collection, ident_t {i}, player_doc);
+        }
+
+        db.CommitChanges(false);
+
+        struct Request
+        {
+            ident_t Id {};
+            size_t PrefetchId {};
+            bool Disconnected {};
+        };
+
+        vector<Request> requests;
+
+        for (int32 i = 1; i <= players_count; i++) {
+            requests.emplace_back(Request {.Id = ident_t {i}, .PrefetchId = db.Prefetch(collection, ident_t {i}), .Disconnected = i % 4 == 0});
+
+            // Changes made while fetch is in progress
+            db.Update(collection, ident_t {i}, "Value", numeric_cast<int64>(i * 10));
+
+            if (i % 8 == 0) {
+                db.CommitChanges(false);
+            }
+        }
+
+        CHECK(db.GetPrefetchCount() == numeric_cast<size_t>(players_count));
+
+        size_t finished = 0;
+        size_t cancelled = 0;
+
+        while (!requests.empty()) {
+            for (size_t i = 0; i < requests.size();) {
+                auto& request = requests[i];
+
+                if (request.Disconnected) {
+                    db.CancelPrefetch(request.PrefetchId);
+                    requests.erase(requests.begin() + numeric_cast<ptrdiff_t>(i));
+                    cancelled++;
+                    continue;
+                }
+
+                auto player_doc = db.TakePrefetched(request.PrefetchId);
+
+                if (!player_doc.has_value()) {
+                    i++;
+                    continue;
+                }
+
+                CHECK(player_doc.value() == db.Get(collection, request.Id));
+                CHECK(player_doc.value()["Value"] == AnyData::Value(numeric_cast<int64>(request.Id.underlying_value() * 10)));
+                requests.erase(requests.begin() + numeric_cast<ptrdiff_t>(i));
+                finished++;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds {1});
+        }
+
+        CHECK(finished == numeric_cast<size_t>(players_count - players_count / 4));
+        CHECK(cancelled == numeric_cast<size_t>(players_count / 4));
+        CHECK(db.GetPrefetchCount() == 0);
+    }
+
+    db.CommitChanges(true);
+}
+
+FO_END_NAMESPACE();
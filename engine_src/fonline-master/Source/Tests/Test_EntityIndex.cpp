@@ -0,0 +1,259 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "EntityIndex.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct IndexTestEntity
+{
+    int32 MapId {};
+    int32 Value {};
+};
+
+static auto CollectKeys(EntityIndex<IndexTestEntity>& index, int64 key) -> vector<int32>
+{
+    vector<int32> values;
+
+    for (auto& entity : index.Find(key)) {
+        values.emplace_back(entity->Value);
+    }
+
+    std::ranges::sort(values);
+    return values;
+}
+
+static auto CollectOrder(EntityIndex<IndexTestEntity>& index, int64 key) -> vector<int32>
+{
+    vector<int32> values;
+
+    for (auto& entity : index.Find(key)) {
+        values.emplace_back(entity->Value);
+    }
+
+    return values;
+}
+
+TEST_CASE("EntityIndex")
+{
+    vector<IndexTestEntity> entities(10);
+
+    for (size_t i = 0; i < entities.size(); i++) {
+        entities[i].Value = numeric_cast<int32>(i);
+    }
+
+    SECTION("HashLookup")
+    {
+        EntityIndex<IndexTestEntity> index {EntityIndexType::Hash};
+
+        for (auto& entity : entities) {
+            index.Set(&entity, entity.Value % 3);
+        }
+
+        CHECK(index.GetEntitiesCount() == 10);
+        CHECK(index.GetKeysCount() == 3);
+        CHECK(CollectKeys(index, 0) == vector<int32> {0, 3, 6, 9});
+        CHECK(CollectKeys(index, 1) == vector<int32> {1, 4, 7});
+        CHECK(index.Find(5).empty());
+    }
+
+    SECTION("UpdateAndRemove")
+    {
+        EntityIndex<IndexTestEntity> index {EntityIndexType::Hash};
+
+        for (auto& entity : entities) {
+            index.Set(&entity, 0);
+        }
+
+        index.Remove(&entities[2]);
+        index.Set(&entities[4], 1);
+        index.Remove(&entities[0]);
+
+        CHECK(CollectKeys(index, 0) == vector<int32> {1, 3, 5, 6, 7, 8, 9});
+        CHECK(CollectKeys(index, 1) == vector<int32> {4});
+        CHECK(!index.Contains(&entities[2]));
+
+        // Update is ignored for entities that are not in index
+        index.Update(&entities[2], 1);
+        CHECK(!index.Contains(&entities[2]));
+
+        index.Update(&entities[4], 0);
+        CHECK(index.Find(1).empty());
+        CHECK(index.GetKeysCount() == 1);
+
+        for (auto& entity : entities) {
+            index.Remove(&entity);
+        }
+
+        CHECK(index.GetEntitiesCount() == 0);
+        CHECK(index.GetKeysCount() == 0);
+    }
+
+    SECTION("InsertionOrder")
+    {
+        EntityIndex<IndexTestEntity> index {EntityIndexType::Sorted};
+
+        for (auto& entity : entities) {
+            index.Set(&entity, 0);
+        }
+
+        index.Remove(&entities[2]);
+        index.Remove(&entities[5]);
+        index.Remove(&entities[9]);
+
+        vector<int32> values;
+        index.ForEachInRange(0, 0, [&](IndexTestEntity* entity) { values.emplace_back(entity->Value); });
+        CHECK(values == vector<int32> {0, 1, 3, 4, 6, 7, 8});
+        CHECK(CollectOrder(index, 0) == vector<int32> {0, 1, 3, 4, 6, 7, 8});
+
+        // Changed key moves entity to the end of its new bucket
+        index.Set(&entities[5], 0);
+        index.Set(&entities[1], 1);
+        index.Set(&entities[1], 0);
+        index.Remove(&entities[0]);
+
+        CHECK(CollectOrder(index, 0) == vector<int32> {3, 4, 6, 7, 8, 5, 1});
+        CHECK(index.GetEntitiesCount() == 7);
+
+        index.Remove(&entities[1]);
+        index.Remove(&entities[5]);
+        CHECK(CollectOrder(index, 0) == vector<int32> {3, 4, 6, 7, 8});
+    }
+
+    SECTION("SortedRange")
+    {
+        EntityIndex<IndexTestEntity> index {EntityIndexType::Sorted};
+
+        for (auto& entity : entities) {
+            index.Set(&entity, entity.Value * 10);
+        }
+
+        vector<int32> values;
+        index.ForEachInRange(15, 50, [&](IndexTestEntity* entity) { values.emplace_back(entity->Value); });
+
+        CHECK(values == vector<int32> {2, 3, 4, 5});
+        CHECK(CollectKeys(index, 30) == vector<int32> {3});
+    }
+}
+
+TEST_CASE("EntityIndexBenchmark", "[.benchmark]")
+{
+    constexpr int32 count = 50000;
+    constexpr int32 values_count = 1000;
+    constexpr int32 map_id = 1;
+
+    // Items of single map in their natural order, few more maps to make index global
+    vector<IndexTestEntity> entities(count * 2);
+    vector<raw_ptr<IndexTestEntity>> map_items;
+    EntityIndex<IndexTestEntity> hash_index {EntityIndexType::Hash};
+    EntityIndex<IndexTestEntity> sorted_index {EntityIndexType::Sorted};
+
+    for (int32 i = 0; i < count * 2; i++) {
+        auto& entity = entities[i];
+        entity.MapId = i % 2 == 0 ? map_id : map_id + 1 + i % 7;
+        entity.Value = GenericUtils::Random(0, values_count - 1);
+
+        if (entity.MapId == map_id) {
+            map_items.emplace_back(&entity);
+        }
+
+        hash_index.Set(&entity, entity.Value);
+        sorted_index.Set(&entity, entity.Value);
+    }
+
+    REQUIRE(map_items.size() == count);
+
+    BENCHMARK("linear scan equal")
+    {
+        size_t found = 0;
+
+        for (const auto& entity : map_items) {
+            if (entity->Value == values_count / 2) {
+                found++;
+            }
+        }
+
+        return found;
+    };
+
+    BENCHMARK("hash index equal")
+    {
+        size_t found = 0;
+
+        for (const auto& entity : hash_index.Find(values_count / 2)) {
+            if (entity->MapId == map_id) {
+                found++;
+            }
+        }
+
+        return found;
+    };
+
+    BENCHMARK("linear scan range")
+    {
+        size_t found = 0;
+
+        for (const auto& entity : map_items) {
+            if (entity->Value >= 100 && entity->Value <= 110) {
+                found++;
+            }
+        }
+
+        return found;
+    };
+
+    BENCHMARK("sorted index range")
+    {
+        size_t found = 0;
+
+        sorted_index.ForEachInRange(100, 110, [&](const IndexTestEntity* entity) {
+            if (entity->MapId == map_id) {
+                found++;
+            }
+        });
+
+        return found;
+    };
+
+    BENCHMARK("index value change")
+    {
+        auto& entity = entities[numeric_cast<size_t>(GenericUtils::Random(0, count * 2 - 1))];
+        entity.Value = GenericUtils::Random(0, values_count - 1);
+        hash_index.Update(&entity, entity.Value);
+        return hash_index.GetKeysCount();
+    };
+}
+
+FO_END_NAMESPACE();
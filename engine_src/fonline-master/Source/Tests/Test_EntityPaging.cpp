@@ -0,0 +1,423 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "DataBase.h"
+#include "EntityPaging.h"
+#include "Settings.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct PagingTestEntity
+{
+    [[nodiscard]] auto GetRefCount() const noexcept -> int32 { return RefCount; }
+    [[nodiscard]] auto IsDestroying() const noexcept -> bool { return Destroying; }
+    [[nodiscard]] auto HasTimeEvents() const noexcept -> bool { return TimeEvents; }
+    void SetInitCalled() noexcept { InitCalled = true; }
+
+    int32 RefCount {};
+    bool Destroying {};
+    bool TimeEvents {};
+    bool Indexed {};
+    bool InitCalled {};
+    int32 InitCount {};
+    ident_t Id {};
+    hstring Pid {};
+    vector<PagingTestEntity*> Children {};
+};
+
+// Minimal stand-in of entity manager paging, server itself can't run without baked resources
+// Entity data lives in storage, registry holds loaded entities, script enumeration reloads everything first
+class PagingTestWorld
+{
+public:
+    explicit PagingTestWorld(DataBase& db, HashStorage& hashes) :
+        _db {db},
+        _hashes {hashes},
+        _collection {hashes.ToHashedString("Entities")}
+    {
+    }
+
+    auto Create(ident_t id, hstring pid, ident_t owner_id, int64 value) -> PagingTestEntity*
+    {
+        AnyData::Document doc;
+        doc.Emplace("Pid", string(pid.as_str()));
+        doc.Emplace("OwnerId", numeric_cast<int64>(owner_id.underlying_value()));
+        doc.Emplace("Value", value);
+        _db.Insert(_collection, id, doc);
+
+        auto* entity = Register(id, pid, owner_id);
+        entity->InitCalled = true;
+        entity->InitCount++;
+        return entity;
+    }
+
+    void SetValue(PagingTestEntity* entity, int64 value) { _db.Update(_collection, entity->Id, "Value", value); }
+    auto GetValue(const PagingTestEntity* entity) -> int64 { return _db.Get(_collection, entity->Id)["Value"].AsInt64(); }
+    auto Find(ident_t id) -> PagingTestEntity* { return _entities.count(id) != 0 ? _entities.at(id).get() : nullptr; }
+    auto IsPagedOut(ident_t id) const -> bool { return !!_pagedOut.FindLocation(id); }
+
+    void Unload(ident_t loc_id)
+    {
+        PagedOutLocations::Entry entry;
+        unordered_set<hstring> pids;
+        vector<PagingTestEntity*> pending {Find(loc_id)};
+
+        while (!pending.empty()) {
+            auto* entity = pending.back();
+            pending.pop_back();
+            pending.insert(pending.end(), entity->Children.begin(), entity->Children.end());
+            entry.EntityIds.emplace_back(entity->Id);
+            pids.emplace(entity->Pid);
+        }
+
+        entry.Pids.assign(pids.begin(), pids.end());
+
+        for (const auto id : entry.EntityIds) {
+            _entities.erase(id);
+        }
+
+        _db.CommitChanges(false);
+        _pagedOut.Add(loc_id, std::move(entry));
+    }
+
+    auto Reload(ident_t loc_id) -> PagingTestEntity*
+    {
+        const auto entry = _pagedOut.Take(loc_id);
+
+        if (!entry.has_value()) {
+            return nullptr;
+        }
+
+        for (const auto id : entry->EntityIds) {
+            const auto doc = _db.Get(_collection, id);
+            Register(id, _hashes.ToHashedString(doc["Pid"].AsString()), ident_t {numeric_cast<ident_t::underlying_type>(doc["OwnerId"].AsInt64())});
+        }
+
+        vector<PagingTestEntity*> pending {Find(loc_id)};
+        MarkEntityTreeRestored(pending, [](PagingTestEntity* entity, vector<PagingTestEntity*>& pending_) { pending_.insert(pending_.end(), entity->Children.begin(), entity->Children.end()); });
+
+        return Find(loc_id);
+    }
+
+    // Same as script global enumerations, paged out entities are brought back before the walk
+    auto GetAll(hstring pid) -> vector<PagingTestEntity*>
+    {
+        while (const auto loc_id = _pagedOut.GetAnyLocation()) {
+            Reload(loc_id);
+        }
+
+        vector<PagingTestEntity*> result;
+
+        for (auto& entity : _entities | std::views::values) {
+            if (entity->Pid == pid) {
+                result.emplace_back(entity.get());
+            }
+        }
+
+        return result;
+    }
+
+private:
+    auto Register(ident_t id, hstring pid, ident_t owner_id) -> PagingTestEntity*
+    {
+        auto& entity = _entities[id];
+        FO_RUNTIME_ASSERT(!entity);
+
+        entity = SafeAlloc::MakeUnique<PagingTestEntity>();
+        entity->Id = id;
+        entity->Pid = pid;
+
+        if (owner_id) {
+            Find(owner_id)->Children.emplace_back(entity.get());
+        }
+
+        return entity.get();
+    }
+
+    DataBase& _db;
+    HashStorage& _hashes;
+    hstring _collection;
+    unordered_map<ident_t, unique_ptr<PagingTestEntity>> _entities {};
+    PagedOutLocations _pagedOut {};
+};
+
+static auto IsTestTreeIdle(PagingTestEntity* root) -> bool
+{
+    vector<pair<PagingTestEntity*, int32>> pending;
+    pending.emplace_back(root, 1);
+
+    const auto result = IsEntityTreeIdle(pending, [](PagingTestEntity* entity, vector<pair<PagingTestEntity*, int32>>& pending_) -> bool {
+        if (entity->Indexed) {
+            return false;
+        }
+
+        for (auto* child : entity->Children) {
+            pending_.emplace_back(child, 2);
+        }
+
+        return true;
+    });
+
+    CHECK(pending.empty());
+    return result;
+}
+
+TEST_CASE("EntityPaging")
+{
+    HashStorage hashes;
+    const auto pid_a = hashes.ToHashedString("ProtoA");
+    const auto pid_b = hashes.ToHashedString("ProtoB");
+
+    SECTION("UnloadReload")
+    {
+        PagedOutLocations paged_out;
+
+        CHECK(paged_out.IsEmpty());
+
+        paged_out.Add(ident_t {1}, {.EntityIds = {ident_t {10}, ident_t {11}, ident_t {1}}, .Pids = {pid_a, pid_b}});
+        paged_out.Add(ident_t {2}, {.EntityIds = {ident_t {20}, ident_t {2}}, .Pids = {pid_a}});
+
+        CHECK(paged_out.GetLocationsCount() == 2);
+        CHECK(paged_out.IsPagedOut(ident_t {1}));
+        CHECK(paged_out.FindLocation(ident_t {11}) == ident_t {1});
+        CHECK(paged_out.FindLocation(ident_t {20}) == ident_t {2});
+        CHECK(!paged_out.FindLocation(ident_t {30}));
+        CHECK(paged_out.FindLocationByProto(pid_b) == ident_t {1});
+
+        const auto entry = paged_out.Take(ident_t {1});
+
+        REQUIRE(entry.has_value());
+        CHECK(entry->EntityIds == vector<ident_t> {ident_t {10}, ident_t {11}, ident_t {1}});
+        CHECK(!paged_out.IsPagedOut(ident_t {1}));
+        CHECK(!paged_out.FindLocation(ident_t {10}));
+        CHECK(!paged_out.FindLocationByProto(pid_b));
+        CHECK(paged_out.FindLocationByProto(pid_a) == ident_t {2});
+        CHECK(!paged_out.Take(ident_t {1}).has_value());
+
+        // Location may be paged out again after reload
+        paged_out.Add(ident_t {1}, entry.value());
+        CHECK(paged_out.FindLocation(ident_t {10}) == ident_t {1});
+
+        CHECK(paged_out.Take(ident_t {1}).has_value());
+        CHECK(paged_out.Take(ident_t {2}).has_value());
+        CHECK(paged_out.IsEmpty());
+        CHECK(!paged_out.GetAnyLocation());
+        CHECK(!paged_out.FindLocationByProto(pid_a));
+    }
+
+    SECTION("PagingCursor")
+    {
+        const auto idle_time = timespan(std::chrono::seconds {10});
+        auto cur_time = nanotime(timespan(std::chrono::seconds {100}));
+
+        LocationPagingCursor cursor;
+
+        CHECK(cursor.IsPassFinished());
+
+        cursor.StartPass({ident_t {1}, ident_t {2}, ident_t {3}}, cur_time);
+
+        // Pass is resumed from the same place on next call
+        CHECK(cursor.TakeNext() == ident_t {1});
+        CHECK(!cursor.Update(ident_t {1}, true, cur_time, idle_time));
+        CHECK(!cursor.IsPassFinished());
+        CHECK(cursor.TakeNext() == ident_t {2});
+        CHECK(cursor.TakeNext() == ident_t {3});
+        CHECK(cursor.IsPassFinished());
+        CHECK(!cursor.TakeNext());
+
+        cur_time += std::chrono::seconds {5};
+        CHECK(!cursor.Update(ident_t {1}, true, cur_time, idle_time));
+        CHECK(!cursor.Update(ident_t {2}, false, cur_time, idle_time));
+
+        cur_time += std::chrono::seconds {5};
+        CHECK(cursor.Update(ident_t {1}, true, cur_time, idle_time));
+        CHECK(!cursor.Update(ident_t {2}, true, cur_time, idle_time));
+
+        cursor.MarkBusy(ident_t {1}, cur_time);
+        CHECK(!cursor.Update(ident_t {1}, true, cur_time, idle_time));
+
+        // Gone locations are dropped on next pass
+        cursor.StartPass({ident_t {2}}, cur_time);
+        CHECK(cursor.GetTrackedCount() == 1);
+
+        cur_time += std::chrono::seconds {5};
+        CHECK(cursor.Update(ident_t {2}, true, cur_time, idle_time));
+
+        cursor.Forget(ident_t {2});
+        CHECK(cursor.GetTrackedCount() == 0);
+    }
+
+    SECTION("RefCountGating")
+    {
+        PagingTestEntity loc {.RefCount = 1};
+        PagingTestEntity map {.RefCount = 2};
+        PagingTestEntity item {.RefCount = 2};
+        PagingTestEntity inner_item {.RefCount = 2};
+
+        loc.Children = {&map};
+        map.Children = {&item};
+        item.Children = {&inner_item};
+
+        CHECK(IsTestTreeIdle(&loc));
+
+        // Script handle adds reference
+        inner_item.RefCount++;
+        CHECK(!IsTestTreeIdle(&loc));
+        inner_item.RefCount--;
+
+        map.TimeEvents = true;
+        CHECK(!IsTestTreeIdle(&loc));
+        map.TimeEvents = false;
+
+        item.Destroying = true;
+        CHECK(!IsTestTreeIdle(&loc));
+        item.Destroying = false;
+
+        inner_item.Indexed = true;
+        CHECK(!IsTestTreeIdle(&loc));
+        inner_item.Indexed = false;
+
+        CHECK(IsTestTreeIdle(&loc));
+    }
+
+    SECTION("DeepNesting")
+    {
+        vector<PagingTestEntity> chain(100000);
+        chain.front().RefCount = 1;
+
+        for (size_t i = 1; i < chain.size(); i++) {
+            chain[i].RefCount = 2;
+            chain[i - 1].Children = {&chain[i]};
+        }
+
+        CHECK(IsTestTreeIdle(&chain.front()));
+
+        chain.back().RefCount = 3;
+        CHECK(!IsTestTreeIdle(&chain.front()));
+    }
+
+    SECTION("UnloadReloadWorld")
+    {
+        GlobalSettings settings {false};
+        auto db = ConnectToDataBase(settings, "Memory");
+        PagingTestWorld world {db, hashes};
+
+        const auto loc_pid = hashes.ToHashedString("Location");
+        const auto map_pid = hashes.ToHashedString("Map");
+        const auto npc_pid = hashes.ToHashedString("Npc");
+
+        world.Create(ident_t {1}, loc_pid, ident_t {}, 100);
+        world.Create(ident_t {2}, map_pid, ident_t {1}, 200);
+        world.Create(ident_t {3}, npc_pid, ident_t {2}, 300);
+        world.Create(ident_t {4}, npc_pid, ident_t {2}, 400);
+        world.Create(ident_t {5}, loc_pid, ident_t {}, 500);
+        db.CommitChanges(true);
+
+        world.SetValue(world.Find(ident_t {3}), 301);
+        world.Unload(ident_t {1});
+
+        CHECK(world.Find(ident_t {1}) == nullptr);
+        CHECK(world.Find(ident_t {3}) == nullptr);
+        CHECK(world.IsPagedOut(ident_t {3}));
+
+        // Default enumeration sees paged out entities
+        const auto npcs = world.GetAll(npc_pid);
+        CHECK(npcs.size() == 2);
+        CHECK(world.GetAll(loc_pid).size() == 2);
+        CHECK(!world.IsPagedOut(ident_t {3}));
+
+        auto* loc = world.Find(ident_t {1});
+        REQUIRE(loc != nullptr);
+        REQUIRE(loc->Children.size() == 1);
+
+        auto* map = loc->Children.front();
+        CHECK(map->Id == ident_t {2});
+        CHECK(map->Children.size() == 2);
+
+        auto* npc = world.Find(ident_t {3});
+        REQUIRE(npc != nullptr);
+        CHECK(world.GetValue(npc) == 301);
+        CHECK(world.GetValue(map) == 200);
+
+        // Init is not run again for restored entities
+        for (const auto* entity : {loc, map, npc, world.Find(ident_t {4})}) {
+            CHECK(entity->InitCalled);
+            CHECK(entity->InitCount == 0);
+        }
+
+        CHECK(world.Find(ident_t {5})->InitCount == 1);
+
+        // Paging out again after reload
+        world.Unload(ident_t {1});
+        CHECK(world.Reload(ident_t {1}) != nullptr);
+        CHECK(world.Reload(ident_t {1}) == nullptr);
+        CHECK(world.GetValue(world.Find(ident_t {4})) == 400);
+    }
+
+    SECTION("DataBaseRoundTrip")
+    {
+        GlobalSettings settings {false};
+        auto db = ConnectToDataBase(settings, "Memory");
+        const auto collection = hashes.ToHashedString("Items");
+        const auto id = ident_t {10};
+
+        AnyData::Document doc;
+        doc.Emplace("Count", numeric_cast<int64>(1));
+        db.Insert(collection, id, doc);
+        db.CommitChanges(true);
+
+        db.Update(collection, id, "Count", numeric_cast<int64>(5));
+        db.Update(collection, id, "Name", string("Paged"));
+
+        // Unload commits without waiting, reload must see same data before and after commit completes
+        db.CommitChanges(false);
+
+        const auto reloaded = db.Get(collection, id);
+
+        CHECK(reloaded["Count"] == AnyData::Value(numeric_cast<int64>(5)));
+        CHECK(reloaded["Name"] == AnyData::Value(string("Paged")));
+
+        db.CommitChanges(true);
+
+        CHECK(db.Get(collection, id) == reloaded);
+
+        db.Delete(collection, id);
+        db.CommitChanges(false);
+
+        CHECK(db.Get(collection, id).Empty());
+    }
+}
+
+FO_END_NAMESPACE();
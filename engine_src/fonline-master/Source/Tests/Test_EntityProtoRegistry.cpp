@@ -0,0 +1,133 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "EntityProtoRegistry.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct ProtoRegistryTestEntity
+{
+    [[nodiscard]] auto GetProtoId() const noexcept -> hstring { return Pid; }
+
+    hstring Pid {};
+    int32 Value {};
+    EntityProtoHook<ProtoRegistryTestEntity> Hook {};
+};
+
+using ProtoRegistryTest = EntityProtoRegistry<ProtoRegistryTestEntity, &ProtoRegistryTestEntity::Hook>;
+
+static auto CollectValues(ProtoRegistryTest& registry, hstring pid) -> vector<int32>
+{
+    vector<int32> values;
+
+    for (const auto* entity : registry.Get(pid)) {
+        values.emplace_back(entity->Value);
+    }
+
+    return values;
+}
+
+TEST_CASE("EntityProtoRegistry")
+{
+    HashStorage hashes;
+    const auto pid_a = hashes.ToHashedString("ProtoA");
+    const auto pid_b = hashes.ToHashedString("ProtoB");
+    const auto pid_c = hashes.ToHashedString("ProtoC");
+
+    vector<ProtoRegistryTestEntity> entities(8);
+
+    for (size_t i = 0; i < entities.size(); i++) {
+        entities[i].Pid = i % 2 == 0 ? pid_a : pid_b;
+        entities[i].Value = numeric_cast<int32>(i);
+    }
+
+    ProtoRegistryTest registry;
+
+    for (auto& entity : entities) {
+        registry.Add(&entity);
+    }
+
+    SECTION("Lookup")
+    {
+        CHECK(CollectValues(registry, pid_a) == vector<int32> {0, 2, 4, 6});
+        CHECK(CollectValues(registry, pid_b) == vector<int32> {1, 3, 5, 7});
+        CHECK(registry.Get(pid_c).empty());
+        CHECK(registry.Count(pid_a) == 4);
+        CHECK(registry.GetGroupsCount() == 2);
+    }
+
+    SECTION("SkipCount")
+    {
+        CHECK(registry.GetFirst(pid_a, 0)->Value == 0);
+        CHECK(registry.GetFirst(pid_a, 3)->Value == 6);
+        CHECK(registry.GetFirst(pid_a, 4) == nullptr);
+        CHECK(registry.GetFirst(pid_c, 0) == nullptr);
+    }
+
+    SECTION("StableOrderOnRemove")
+    {
+        registry.Remove(&entities[2]);
+        registry.Remove(&entities[0]);
+        registry.Remove(&entities[7]);
+        registry.Remove(&entities[7]);
+
+        CHECK(CollectValues(registry, pid_a) == vector<int32> {4, 6});
+        CHECK(CollectValues(registry, pid_b) == vector<int32> {1, 3, 5});
+        CHECK(!entities[2].Hook.Linked);
+
+        // Readded entity goes to the end
+        registry.Add(&entities[0]);
+        CHECK(CollectValues(registry, pid_a) == vector<int32> {4, 6, 0});
+
+        registry.Remove(&entities[4]);
+        registry.Remove(&entities[6]);
+        registry.Remove(&entities[0]);
+        CHECK(registry.Get(pid_a).empty());
+        CHECK(registry.GetGroupsCount() == 1);
+    }
+
+    SECTION("Clear")
+    {
+        registry.Clear();
+
+        CHECK(registry.GetGroupsCount() == 0);
+
+        for (const auto& entity : entities) {
+            CHECK(!entity.Hook.Linked);
+        }
+    }
+}
+
+FO_END_NAMESPACE();
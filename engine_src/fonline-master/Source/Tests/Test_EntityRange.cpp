@@ -0,0 +1,199 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "EntityRange.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct RangeTestEntity
+{
+    void AddRef() const noexcept { RefCount++; }
+    void Release() const noexcept { RefCount--; }
+    [[nodiscard]] auto GetProtoId() const noexcept -> hstring { return Pid; }
+    [[nodiscard]] auto GetProto() const noexcept -> const RangeTestEntity* { return this; }
+    [[nodiscard]] auto HasComponent(hstring::hash_t component) const noexcept -> bool { return std::ranges::find(Components, component) != Components.end(); }
+
+    mutable int32 RefCount {};
+    hstring Pid {};
+    vector<hstring::hash_t> Components {};
+};
+
+TEST_CASE("EntityRange")
+{
+    HashStorage hashes;
+    const auto pid_a = hashes.ToHashedString("ProtoA");
+    const auto pid_b = hashes.ToHashedString("ProtoB");
+    const auto comp_x = hashes.ToHashedString("CompX").as_hash();
+    const auto comp_y = hashes.ToHashedString("CompY").as_hash();
+
+    vector<RangeTestEntity> source(6);
+    source[0] = {.Pid = pid_a, .Components = {comp_x}};
+    source[1] = {.Pid = pid_a, .Components = {comp_x, comp_y}};
+    source[2] = {.Pid = pid_a};
+    source[3] = {.Pid = pid_b, .Components = {comp_x, comp_y}};
+    source[4] = {.Pid = pid_b, .Components = {comp_y}};
+    source[5] = {.Pid = pid_b};
+
+    size_t scans = 0;
+    const auto for_each = [&](const auto& func) {
+        scans++;
+
+        for (auto& entity : source) {
+            func(&entity);
+        }
+    };
+
+    EntityRangeState<RangeTestEntity> state;
+
+    SECTION("Filters")
+    {
+        CHECK_FALSE(state.IsFiltered());
+        CHECK(state.GetCount(0, for_each) == 6);
+
+        state.FilterByComponent(comp_x);
+        CHECK(state.IsFiltered());
+        CHECK(state.GetCount(0, for_each) == 3);
+
+        // Filters narrow down, never replace each other
+        state.FilterByComponent(comp_y);
+        CHECK(state.GetCount(0, for_each) == 2);
+        state.FilterByProto(pid_b);
+        CHECK(state.GetCount(0, for_each) == 1);
+
+        state.FilterByProto(pid_b);
+        state.FilterByComponent(comp_x);
+        CHECK(state.GetCount(0, for_each) == 1);
+
+        CHECK_THROWS_AS(state.FilterByProto(pid_a), ScriptException);
+        CHECK(state.GetCount(0, for_each) == 1);
+
+        state.Materialize(for_each);
+        REQUIRE(state.GetEntriesCount() == 1);
+        CHECK(state.GetEntry(0) == &source[3]);
+    }
+
+    SECTION("CountCache")
+    {
+        CHECK(state.GetCount(1, for_each) == 6);
+        CHECK(state.GetCount(1, for_each) == 6);
+        CHECK(scans == 1);
+
+        // Source changed
+        source[5].Pid = pid_a;
+        state.FilterByProto(pid_a);
+        CHECK(state.GetCount(1, for_each) == 4);
+        CHECK(scans == 2);
+
+        source[4].Pid = pid_a;
+        CHECK(state.GetCount(1, for_each) == 4);
+        CHECK(state.GetCount(2, for_each) == 5);
+        CHECK(state.GetSourceRevision() == 2);
+        CHECK(scans == 3);
+    }
+
+    SECTION("Materialization")
+    {
+        state.FilterByProto(pid_a);
+        CHECK(state.GetCount(0, for_each) == 3);
+        CHECK_FALSE(state.IsMaterialized());
+        CHECK(source[0].RefCount == 0);
+
+        state.Materialize(for_each);
+        state.Materialize(for_each);
+        CHECK(state.IsMaterialized());
+        CHECK(scans == 2);
+        CHECK(state.GetEntries() == vector<RangeTestEntity*> {&source[0], &source[1], &source[2]});
+        CHECK(source[0].RefCount == 1);
+        CHECK(source[3].RefCount == 0);
+
+        // Snapshot no longer follows source
+        source[3].Pid = pid_a;
+        CHECK(state.GetCount(5, for_each) == 3);
+        CHECK(scans == 2);
+
+        // Later filter applies to snapshot and releases dropped entries
+        state.FilterByComponent(comp_x);
+        CHECK(state.GetEntries() == vector<RangeTestEntity*> {&source[0], &source[1]});
+        CHECK(source[2].RefCount == 0);
+        CHECK(scans == 2);
+    }
+
+    SECTION("RevisionSync")
+    {
+        state.SetSourceRevision(7);
+        CHECK(state.GetCount(7, for_each) == 6);
+        CHECK(scans == 1);
+
+        // Live access after source change drops cached count instead of failing
+        state.SyncSourceRevision(7);
+        CHECK(state.GetCount(7, for_each) == 6);
+        CHECK(scans == 1);
+
+        state.SyncSourceRevision(8);
+        CHECK(state.GetSourceRevision() == 8);
+        CHECK(state.GetCount(8, for_each) == 6);
+        CHECK(scans == 2);
+    }
+
+    SECTION("GameWideRevision")
+    {
+        // Same as entity manager critters revision, bumped on every register and unregister
+        uint32 revision = 0;
+        vector<RangeTestEntity> npcs {{.Pid = pid_a}, {.Pid = pid_b}};
+
+        const auto for_each_npc = [&](const auto& func) {
+            scans++;
+
+            for (auto& entity : npcs) {
+                func(&entity);
+            }
+        };
+
+        state.FilterByProto(pid_a);
+        CHECK(state.GetCount(revision, for_each_npc) == 1);
+
+        npcs.push_back({.Pid = pid_a});
+        revision++;
+        CHECK(state.GetCount(revision, for_each_npc) == 2);
+
+        npcs.erase(npcs.begin());
+        revision++;
+        CHECK(state.GetCount(revision, for_each_npc) == 1);
+        CHECK(state.GetCount(revision, for_each_npc) == 1);
+        CHECK(scans == 3);
+    }
+}
+
+FO_END_NAMESPACE();
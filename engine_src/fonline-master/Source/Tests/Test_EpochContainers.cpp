@@ -0,0 +1,345 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct EpochTestObject
+{
+    EpochTestObject(int32 value, int32* alive_counter) :
+        Value {value},
+        AliveCounter {alive_counter}
+    {
+        (*AliveCounter)++;
+    }
+    EpochTestObject(const EpochTestObject&) = delete;
+    EpochTestObject(EpochTestObject&&) noexcept = delete;
+    auto operator=(const EpochTestObject&) = delete;
+    auto operator=(EpochTestObject&&) noexcept = delete;
+    ~EpochTestObject() { (*AliveCounter)--; }
+
+    void AddRef() const noexcept { ++RefCounter; }
+    void Release() const noexcept
+    {
+        if (--RefCounter == 0) {
+            delete this;
+        }
+    }
+
+    int32 Value;
+    int32* AliveCounter;
+    mutable int32 RefCounter {1};
+};
+
+// Owner mimics entity manager storage, registry itself doesn't own objects
+using EpochTestOwner = unordered_map<int32, refcount_ptr<EpochTestObject>>;
+
+static void AddEpochObject(epoch_map<int32, EpochTestObject>& map, EpochTestOwner& owner, int32 key, int32& alive_counter)
+{
+    auto obj = SafeAlloc::MakeRefCounted<EpochTestObject>(key, &alive_counter);
+    map.emplace(key, obj.get());
+    owner.emplace(key, std::move(obj));
+}
+
+static void DestroyEpochObject(epoch_map<int32, EpochTestObject>& map, EpochTestOwner& owner, int32 key)
+{
+    CHECK(map.erase(key));
+    owner.erase(key);
+}
+
+static void FillEpochMap(epoch_map<int32, EpochTestObject>& map, EpochTestOwner& owner, int32 count, int32& alive_counter)
+{
+    for (int32 i = 0; i < count; i++) {
+        AddEpochObject(map, owner, i, alive_counter);
+    }
+}
+
+TEST_CASE("EpochMap")
+{
+    int32 alive_counter = 0;
+
+    SECTION("BasicOperations")
+    {
+        {
+            EpochTestOwner owner;
+            epoch_map<int32, EpochTestObject> map;
+            FillEpochMap(map, owner, 10, alive_counter);
+
+            CHECK(map.size() == 10);
+            CHECK(alive_counter == 10);
+            CHECK(map.find(3)->Value == 3);
+            CHECK_FALSE(map.emplace(3, map.find(4)));
+            DestroyEpochObject(map, owner, 3);
+            CHECK_FALSE(map.erase(3));
+            CHECK(map.find(3) == nullptr);
+            CHECK(map.size() == 9);
+            CHECK(alive_counter == 9);
+
+            int32 sum = 0;
+
+            for (const auto* obj : map.iterate()) {
+                sum += obj->Value;
+            }
+
+            CHECK(sum == 45 - 3);
+
+            // Registry doesn't hold references
+            for (const auto* obj : map.iterate()) {
+                CHECK(obj->RefCounter == 2);
+                break;
+            }
+
+            CHECK(owner.at(0)->RefCounter == 1);
+        }
+
+        CHECK(alive_counter == 0);
+    }
+
+    SECTION("RemoveDuringIteration")
+    {
+        EpochTestOwner owner;
+        epoch_map<int32, EpochTestObject> map;
+        FillEpochMap(map, owner, 10, alive_counter);
+
+        vector<int32> visited;
+
+        for (auto* obj : map.iterate()) {
+            visited.emplace_back(obj->Value);
+
+            if (obj->Value == 2) {
+                // Current object is held by iteration, not yet visited one is destroyed at once
+                DestroyEpochObject(map, owner, 2);
+                DestroyEpochObject(map, owner, 7);
+                CHECK(map.find(2) == nullptr);
+                CHECK(map.removed_count() == 2);
+                CHECK(alive_counter == 9);
+                CHECK(obj->Value == 2);
+            }
+        }
+
+        CHECK(std::ranges::find(visited, 7) == visited.end());
+        CHECK(visited.size() == 9);
+        CHECK(map.removed_count() == 0);
+        CHECK(alive_counter == 8);
+        CHECK(map.size() == 8);
+    }
+
+    SECTION("AddDuringIteration")
+    {
+        EpochTestOwner owner;
+        epoch_map<int32, EpochTestObject> map;
+        FillEpochMap(map, owner, 5, alive_counter);
+
+        size_t visited = 0;
+
+        for (auto* obj : map.iterate()) {
+            const auto key = obj->Value + 100;
+            AddEpochObject(map, owner, key, alive_counter);
+            CHECK(map.find(key) == owner.at(key).get());
+            visited++;
+        }
+
+        CHECK(visited == 5);
+        CHECK(map.size() == 10);
+        CHECK(alive_counter == 10);
+    }
+
+    SECTION("ReaddDuringIteration")
+    {
+        EpochTestOwner owner;
+        epoch_map<int32, EpochTestObject> map;
+        FillEpochMap(map, owner, 3, alive_counter);
+
+        for (auto* obj : map.iterate()) {
+            if (obj->Value == 0) {
+                auto* same = map.find(1);
+                map.erase(1);
+                CHECK(map.emplace(1, same));
+            }
+        }
+
+        CHECK(map.size() == 3);
+        CHECK(map.find(1)->Value == 1);
+        CHECK(alive_counter == 3);
+    }
+
+    SECTION("OwningStorage")
+    {
+        epoch_map<int32, EpochTestObject, refcount_ptr<EpochTestObject>> map;
+
+        for (int32 i = 0; i < 5; i++) {
+            auto obj = SafeAlloc::MakeRefCounted<EpochTestObject>(i, &alive_counter);
+            map.emplace(i, obj.get());
+        }
+
+        CHECK(alive_counter == 5);
+
+        for (auto* obj : map.iterate()) {
+            if (obj->Value == 0) {
+                // Removed objects are released after iteration
+                map.erase(3);
+                CHECK(alive_counter == 5);
+            }
+        }
+
+        CHECK(alive_counter == 4);
+        map.erase(1);
+        CHECK(alive_counter == 3);
+        map.clear();
+        CHECK(alive_counter == 0);
+    }
+
+    SECTION("NestedMutationStress")
+    {
+        EpochTestOwner owner;
+        epoch_map<int32, EpochTestObject> map;
+        int32 next_key = 0;
+        uint32 seed = 12345;
+
+        // Deterministic pseudo random sequence
+        const auto next_rand = [&](int32 max_value) {
+            seed = seed * 1664525 + 1013904223;
+            return numeric_cast<int32>((seed >> 8) % numeric_cast<uint32>(max_value + 1));
+        };
+        const auto add_object = [&] {
+            AddEpochObject(map, owner, next_key, alive_counter);
+            next_key++;
+        };
+        const auto remove_random = [&] {
+            if (!owner.empty()) {
+                const auto key = next_rand(next_key - 1);
+
+                if (owner.count(key) != 0) {
+                    DestroyEpochObject(map, owner, key);
+                }
+            }
+        };
+
+        for (int32 i = 0; i < 200; i++) {
+            add_object();
+        }
+
+        for (int32 round = 0; round < 50; round++) {
+            unordered_set<int32> before;
+            unordered_set<int32> visited;
+
+            for (const auto& key : owner | std::views::keys) {
+                before.emplace(key);
+            }
+
+            for (auto* obj : map.iterate()) {
+                // Visited only once, never added in this round and never after own removal
+                CHECK(before.count(obj->Value) != 0);
+                CHECK(owner.count(obj->Value) != 0);
+                CHECK(visited.emplace(obj->Value).second);
+
+                switch (next_rand(5)) {
+                case 0:
+                    add_object();
+                    break;
+                case 1:
+                    remove_random();
+                    break;
+                case 2:
+                    DestroyEpochObject(map, owner, obj->Value);
+                    CHECK(obj->RefCounter == 1);
+                    break;
+                case 3:
+                    for (auto* nested_obj : map.iterate()) {
+                        if (next_rand(20) == 0 && nested_obj != obj) {
+                            DestroyEpochObject(map, owner, nested_obj->Value);
+                        }
+                    }
+                    CHECK(map.is_iterating());
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            CHECK_FALSE(map.is_iterating());
+            CHECK(map.removed_count() == 0);
+            CHECK(map.size() == owner.size());
+            CHECK(alive_counter == numeric_cast<int32>(owner.size()));
+
+            for (const auto& [key, obj] : owner) {
+                CHECK(map.find(key) == obj.get());
+            }
+        }
+    }
+
+    CHECK(alive_counter == 0);
+}
+
+TEST_CASE("EpochMapBenchmark", "[.benchmark]")
+{
+    constexpr int32 count = 10000;
+    int32 alive_counter = 0;
+
+    EpochTestOwner owner;
+    epoch_map<int32, EpochTestObject> map;
+    FillEpochMap(map, owner, count, alive_counter);
+
+    unordered_map<int32, raw_ptr<EpochTestObject>> raw_map;
+
+    for (auto* obj : map.iterate()) {
+        raw_map.emplace(obj->Value, obj);
+    }
+
+    BENCHMARK("copy_hold_ref")
+    {
+        int64 sum = 0;
+
+        for (const auto* obj : copy_hold_ref(raw_map)) {
+            sum += obj->Value;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("epoch_map iterate")
+    {
+        int64 sum = 0;
+
+        for (const auto* obj : map.iterate()) {
+            sum += obj->Value;
+        }
+
+        return sum;
+    };
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,153 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "HexChunkCounter.h"
+
+FO_BEGIN_NAMESPACE();
+
+TEST_CASE("HexChunkCounter")
+{
+    const msize size {100, 70};
+
+    SECTION("Chunks")
+    {
+        const HexChunkCounter counter {size};
+
+        CHECK(counter.GetSize() == size);
+        CHECK(counter.GetChunksCount() == numeric_cast<size_t>(7 * 5));
+    }
+
+    SECTION("BlockerPlacedAndRemoved")
+    {
+        HexChunkCounter counter {size};
+        const mpos blocker_hex {20, 20};
+
+        counter.Update(blocker_hex, false, true);
+
+        // Whole chunk of blocker is checked, neighbor chunks stay open
+        CHECK(!counter.IsEmpty({16, 16}));
+        CHECK(!counter.IsEmpty({31, 31}));
+        CHECK(counter.IsEmpty({15, 20}));
+        CHECK(counter.IsEmpty({32, 20}));
+        CHECK(counter.IsEmpty({20, 32}));
+        CHECK(counter.GetCount(blocker_hex) == 1);
+
+        // Recache with same state changes nothing
+        counter.Update(blocker_hex, true, true);
+        CHECK(counter.GetCount(blocker_hex) == 1);
+
+        counter.Update({17, 30}, false, true);
+        counter.Update(blocker_hex, true, false);
+        CHECK(!counter.IsEmpty(blocker_hex));
+
+        counter.Update({17, 30}, true, false);
+        CHECK(counter.IsEmpty(blocker_hex));
+        CHECK(counter.IsEmpty({17, 30}));
+    }
+
+    SECTION("ShootCheckMatchesHexLookup")
+    {
+        // Same flow as map shoot check, static blocks counted once and dynamic ones updated on recache
+        HexChunkCounter static_counter {size};
+        HexChunkCounter dynamic_counter {size};
+        vector<uint8> static_blocks(numeric_cast<size_t>(size.square()));
+        vector<uint8> dynamic_blocks(numeric_cast<size_t>(size.square()));
+
+        const auto hex_index = [&](mpos hex) { return numeric_cast<size_t>(hex.y) * numeric_cast<size_t>(size.width) + numeric_cast<size_t>(hex.x); };
+        const auto is_shootable = [&](mpos hex) {
+            if (dynamic_counter.IsEmpty(hex) && static_counter.IsEmpty(hex)) {
+                return true;
+            }
+
+            return static_blocks[hex_index(hex)] == 0 && dynamic_blocks[hex_index(hex)] == 0;
+        };
+        const auto check_all_hexes = [&] {
+            for (const auto hx : iterate_range(size.width)) {
+                for (const auto hy : iterate_range(size.height)) {
+                    const mpos hex {hx, hy};
+                    const bool expected = static_blocks[hex_index(hex)] == 0 && dynamic_blocks[hex_index(hex)] == 0;
+
+                    if (is_shootable(hex) != expected) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        };
+
+        for (int32 i = 0; i < 40; i++) {
+            const mpos hex {numeric_cast<int16>((i * 37) % size.width), numeric_cast<int16>((i * 11) % size.height)};
+
+            if (static_blocks[hex_index(hex)] == 0) {
+                static_blocks[hex_index(hex)] = 1;
+                static_counter.Add(hex);
+            }
+        }
+
+        CHECK(check_all_hexes());
+
+        for (int32 i = 0; i < 2000; i++) {
+            const mpos hex {numeric_cast<int16>((i * 53) % size.width), numeric_cast<int16>((i * 29 + i / 7) % size.height)};
+            auto& blocked = dynamic_blocks[hex_index(hex)];
+            const bool was_blocked = blocked != 0;
+
+            blocked = (i / 3) % 2 == 0 ? 1 : 0;
+            dynamic_counter.Update(hex, was_blocked, blocked != 0);
+        }
+
+        CHECK(check_all_hexes());
+
+        for (const auto hx : iterate_range(size.width)) {
+            for (const auto hy : iterate_range(size.height)) {
+                const mpos hex {hx, hy};
+                auto& blocked = dynamic_blocks[hex_index(hex)];
+
+                dynamic_counter.Update(hex, blocked != 0, false);
+                blocked = 0;
+            }
+        }
+
+        CHECK(check_all_hexes());
+
+        for (const auto hx : iterate_range(size.width)) {
+            for (const auto hy : iterate_range(size.height)) {
+                CHECK(dynamic_counter.IsEmpty({hx, hy}));
+            }
+        }
+    }
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,182 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "HexSpatialIndex.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct SpatialTestEntity
+{
+    int32 Value {};
+    mpos Hex {};
+};
+
+static auto CollectInRadius(HexSpatialIndex<SpatialTestEntity>& index, mpos hex, int32 radius) -> vector<int32>
+{
+    vector<int32> values;
+    index.ForEachInRadius(hex, radius, [&](SpatialTestEntity* entity, mpos entity_hex) {
+        CHECK(entity->Hex == entity_hex);
+        values.emplace_back(entity->Value);
+    });
+    std::ranges::sort(values);
+    return values;
+}
+
+static auto BruteForceInRadius(const vector<SpatialTestEntity>& entities, mpos hex, int32 radius) -> vector<int32>
+{
+    vector<int32> values;
+
+    for (const auto& entity : entities) {
+        if (GeometryHelper::GetDistance(hex, entity.Hex) <= radius) {
+            values.emplace_back(entity.Value);
+        }
+    }
+
+    std::ranges::sort(values);
+    return values;
+}
+
+TEST_CASE("HexSpatialIndex")
+{
+    const msize size {100, 70};
+
+    vector<SpatialTestEntity> entities(500);
+
+    for (size_t i = 0; i < entities.size(); i++) {
+        entities[i].Value = numeric_cast<int32>(i);
+        entities[i].Hex = mpos(numeric_cast<int16>(GenericUtils::Random(0, size.width - 1)), numeric_cast<int16>(GenericUtils::Random(0, size.height - 1)));
+    }
+
+    HexSpatialIndex<SpatialTestEntity> index {size};
+
+    for (auto& entity : entities) {
+        index.Add(&entity, entity.Hex);
+    }
+
+    CHECK(index.GetEntitiesCount() == entities.size());
+    CHECK(index.GetChunksCount() == size_t {7 * 5});
+
+    SECTION("RadiusMatchesBruteForce")
+    {
+        for (int32 i = 0; i < 50; i++) {
+            const auto hex = mpos(numeric_cast<int16>(GenericUtils::Random(0, size.width - 1)), numeric_cast<int16>(GenericUtils::Random(0, size.height - 1)));
+            const auto radius = GenericUtils::Random(0, 40);
+            CHECK(CollectInRadius(index, hex, radius) == BruteForceInRadius(entities, hex, radius));
+        }
+    }
+
+    SECTION("RectClampedToGrid")
+    {
+        size_t count = 0;
+        index.ForEachInRect(-10, -10, size.width + 10, size.height + 10, [&](SpatialTestEntity*, mpos) { count++; });
+        CHECK(count == entities.size());
+
+        count = 0;
+        index.ForEachInRect(size.width, 0, size.width + 10, size.height, [&](SpatialTestEntity*, mpos) { count++; });
+        CHECK(count == 0);
+    }
+
+    SECTION("MoveAndRemove")
+    {
+        for (size_t i = 0; i < entities.size(); i += 3) {
+            const auto new_hex = mpos(numeric_cast<int16>((entities[i].Hex.x + 17) % size.width), numeric_cast<int16>((entities[i].Hex.y + 23) % size.height));
+            index.Move(&entities[i], entities[i].Hex, new_hex);
+            entities[i].Hex = new_hex;
+        }
+
+        CHECK(index.GetEntitiesCount() == entities.size());
+        CHECK(CollectInRadius(index, mpos(50, 35), 20) == BruteForceInRadius(entities, mpos(50, 35), 20));
+
+        for (auto& entity : entities) {
+            index.Remove(&entity, entity.Hex);
+        }
+
+        CHECK(index.GetEntitiesCount() == 0);
+        CHECK(CollectInRadius(index, mpos(50, 35), 100).empty());
+    }
+
+    SECTION("SameEntityOnSeveralHexes")
+    {
+        SpatialTestEntity multihex {.Value = -1, .Hex = mpos(10, 10)};
+        index.Add(&multihex, mpos(10, 10));
+        index.Add(&multihex, mpos(11, 10));
+
+        index.Remove(&multihex, mpos(11, 10));
+        CHECK(index.GetEntitiesCount() == entities.size() + 1);
+
+        index.Clear();
+        CHECK(index.GetEntitiesCount() == 0);
+    }
+}
+
+TEST_CASE("HexSpatialIndexBenchmark", "[.benchmark]")
+{
+    const msize size {400, 400};
+
+    vector<SpatialTestEntity> entities(20000);
+
+    for (size_t i = 0; i < entities.size(); i++) {
+        entities[i].Value = numeric_cast<int32>(i);
+        entities[i].Hex = mpos(numeric_cast<int16>(GenericUtils::Random(0, size.width - 1)), numeric_cast<int16>(GenericUtils::Random(0, size.height - 1)));
+    }
+
+    HexSpatialIndex<SpatialTestEntity> index {size};
+
+    for (auto& entity : entities) {
+        index.Add(&entity, entity.Hex);
+    }
+
+    BENCHMARK("RadiusQuery")
+    {
+        int64 sum = 0;
+        index.ForEachInRadius(mpos(200, 200), 20, [&](SpatialTestEntity* entity, mpos) { sum += entity->Value; });
+        return sum;
+    };
+
+    BENCHMARK("FullScan")
+    {
+        int64 sum = 0;
+
+        for (const auto& entity : entities) {
+            if (GeometryHelper::GetDistance(mpos(200, 200), entity.Hex) <= 20) {
+                sum += entity.Value;
+            }
+        }
+
+        return sum;
+    };
+}
+
+FO_END_NAMESPACE();
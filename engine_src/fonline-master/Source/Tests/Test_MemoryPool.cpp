@@ -0,0 +1,248 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct PlainAllocation
+{
+};
+
+template<bool Pooled>
+struct ChurnTestObject final : std::conditional_t<Pooled, PooledAllocation<ChurnTestObject<true>>, PlainAllocation>
+{
+    explicit ChurnTestObject(int32 value) noexcept :
+        Value {value}
+    {
+    }
+
+    void AddRef() const noexcept { ++RefCounter; }
+    void Release() const noexcept
+    {
+        if (--RefCounter == 0) {
+            delete this;
+        }
+    }
+
+    int32 Value;
+    array<uint8, 200> Payload {};
+    mutable int32 RefCounter {1};
+};
+
+using PooledChurnObject = ChurnTestObject<true>;
+using PlainChurnObject = ChurnTestObject<false>;
+
+// Random create and destroy, like loot and crafting items churn
+template<typename T>
+static auto RunChurn(int32 operations, int32 max_alive) -> size_t
+{
+    vector<refcount_ptr<T>> alive;
+    size_t peak_alive = 0;
+
+    for (int32 i = 0; i < operations; i++) {
+        if (!alive.empty() && (numeric_cast<int32>(alive.size()) >= max_alive || GenericUtils::Random(0, 1) == 0)) {
+            const auto index = numeric_cast<size_t>(GenericUtils::Random(0, numeric_cast<int32>(alive.size()) - 1));
+            std::swap(alive[index], alive.back());
+            alive.pop_back();
+        }
+        else {
+            alive.emplace_back(SafeAlloc::MakeRefCounted<T>(i));
+            peak_alive = std::max(peak_alive, alive.size());
+        }
+    }
+
+    return peak_alive;
+}
+
+TEST_CASE("MemoryPool")
+{
+    SECTION("ReuseFreedBlocks")
+    {
+        MemoryPool pool {48, 8};
+
+        vector<void*> blocks;
+
+        for (int32 i = 0; i < 8; i++) {
+            blocks.emplace_back(pool.Allocate());
+            CHECK(reinterpret_cast<uintptr_t>(blocks.back()) % alignof(std::max_align_t) == 0);
+        }
+
+        CHECK(pool.GetSlabsCount() == 1);
+        CHECK(pool.GetUsedBlocks() == 8);
+        CHECK(set<void*>(blocks.begin(), blocks.end()).size() == 8);
+
+        for (auto* block : blocks) {
+            pool.Free(block);
+        }
+
+        CHECK(pool.GetUsedBlocks() == 0);
+
+        for (auto*& block : blocks) {
+            block = pool.Allocate();
+        }
+
+        CHECK(pool.GetSlabsCount() == 1);
+
+        blocks.emplace_back(pool.Allocate());
+        CHECK(pool.GetSlabsCount() == 2);
+        CHECK(pool.GetReservedBlocks() == 16);
+
+        for (auto* block : blocks) {
+            pool.Free(block);
+        }
+    }
+
+    SECTION("BlockSizeAlignment")
+    {
+        CHECK(MemoryPool(1).GetBlockSize() == alignof(std::max_align_t));
+        CHECK(MemoryPool(alignof(std::max_align_t) + 1).GetBlockSize() == alignof(std::max_align_t) * 2);
+        CHECK(&MemoryPool::GetForSize(1) == &MemoryPool::GetForSize(alignof(std::max_align_t)));
+        CHECK(&MemoryPool::GetForSize(1) != &MemoryPool::GetForSize(alignof(std::max_align_t) + 1));
+    }
+
+    SECTION("PooledObjectChurn")
+    {
+        auto& pool = PooledChurnObject::GetMemoryPool();
+        const auto used_before = pool.GetUsedBlocks();
+
+        const auto peak_alive = RunChurn<PooledChurnObject>(20000, 500);
+
+        CHECK(pool.GetUsedBlocks() == used_before);
+        CHECK(pool.GetSlabsCount() <= (peak_alive + MemoryPool::DEFAULT_BLOCKS_PER_SLAB - 1) / MemoryPool::DEFAULT_BLOCKS_PER_SLAB + 1);
+    }
+
+    SECTION("PooledObjectAlive")
+    {
+        auto& pool = PooledChurnObject::GetMemoryPool();
+        const auto used_before = pool.GetUsedBlocks();
+
+        {
+            auto obj = SafeAlloc::MakeRefCounted<PooledChurnObject>(42);
+            CHECK(obj->Value == 42);
+            CHECK(pool.GetUsedBlocks() == used_before + 1);
+        }
+
+        CHECK(pool.GetUsedBlocks() == used_before);
+    }
+}
+
+TEST_CASE("MemoryCategories")
+{
+    constexpr auto category = MemoryCategory::DataBase;
+
+    SECTION("TaggedContainer")
+    {
+        const auto bytes_before = GetMemoryCategoryBytes(category);
+
+        {
+            tagged_vector<int64, category> vec;
+            vec.reserve(100);
+            CHECK(GetMemoryCategoryBytes(category) == bytes_before + 100 * sizeof(int64));
+
+            tagged_unordered_set<int32, category> set;
+            set.emplace(1);
+            CHECK(GetMemoryCategoryBytes(category) > bytes_before + 100 * sizeof(int64));
+        }
+
+        CHECK(GetMemoryCategoryBytes(category) == bytes_before);
+    }
+
+    SECTION("TaggedMemorySize")
+    {
+        const auto bytes_before = GetMemoryCategoryBytes(category);
+
+        {
+            TaggedMemorySize<category> size1;
+            size1.Add(300);
+            size1.Sub(100);
+            CHECK(GetMemoryCategoryBytes(category) == bytes_before + 200);
+
+            TaggedMemorySize<category> size2 = std::move(size1);
+            CHECK(size1.Get() == 0); // NOLINT(bugprone-use-after-move)
+            CHECK(size2.Get() == 200);
+            CHECK(GetMemoryCategoryBytes(category) == bytes_before + 200);
+        }
+
+        CHECK(GetMemoryCategoryBytes(category) == bytes_before);
+    }
+
+    SECTION("CategoryPool")
+    {
+        const auto bytes_before = GetMemoryCategoryBytes(category);
+
+        {
+            MemoryPool pool {64, 4, category};
+            auto* block = pool.Allocate();
+            CHECK(GetMemoryCategoryBytes(category) >= bytes_before + 64 * 4);
+            pool.Free(block);
+        }
+
+        CHECK(GetMemoryCategoryBytes(category) == bytes_before);
+    }
+}
+
+TEST_CASE("MemoryPoolBenchmark", "[.benchmark]")
+{
+#if FO_LINUX
+    const auto get_resident_kb = []() -> int64 {
+        std::ifstream statm("/proc/self/statm");
+        int64 size = 0;
+        int64 resident = 0;
+        statm >> size >> resident;
+        return resident * 4;
+    };
+
+    const auto rss_before = get_resident_kb();
+    ignore_unused(RunChurn<PooledChurnObject>(200000, 20000));
+    const auto rss_pooled = get_resident_kb();
+    ignore_unused(RunChurn<PlainChurnObject>(200000, 20000));
+    const auto rss_plain = get_resident_kb();
+
+    WARN(strex("Churn RSS growth: pooled {} KB, plain {} KB, pool slabs {}", rss_pooled - rss_before, rss_plain - rss_pooled, PooledChurnObject::GetMemoryPool().GetSlabsCount()).str());
+#endif
+
+    BENCHMARK("pooled churn")
+    {
+        return RunChurn<PooledChurnObject>(10000, 1000);
+    };
+
+    BENCHMARK("plain churn")
+    {
+        return RunChurn<PlainChurnObject>(10000, 1000);
+    };
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,429 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "PathFinding.h"
+
+FO_BEGIN_NAMESPACE();
+
+struct PathTestMap
+{
+    enum class Terrain : uint8
+    {
+        Free,
+        Wall,
+        Gag,
+    };
+
+    explicit PathTestMap(msize size) :
+        Size {size},
+        Hexes(size.square()),
+        Critters(size.square())
+    {
+    }
+
+    [[nodiscard]] auto At(mpos hex) -> Terrain& { return Hexes[numeric_cast<size_t>(hex.y) * numeric_cast<size_t>(Size.width) + numeric_cast<size_t>(hex.x)]; }
+    [[nodiscard]] auto HasCritter(mpos hex) const -> bool { return Critters[numeric_cast<size_t>(hex.y) * numeric_cast<size_t>(Size.width) + numeric_cast<size_t>(hex.x)] != 0; }
+    void SetCritter(mpos hex, bool set) { Critters[numeric_cast<size_t>(hex.y) * numeric_cast<size_t>(Size.width) + numeric_cast<size_t>(hex.x)] = set ? 1 : 0; }
+
+    // Same classification order as map manager uses for real maps
+    [[nodiscard]] auto GetHexType(mpos hex) -> PathHexType
+    {
+        if (At(hex) == Terrain::Free && !HasCritter(hex)) {
+            return PathHexType::Free;
+        }
+        if (At(hex) == Terrain::Gag) {
+            return PathHexType::Gag;
+        }
+        if (HasCritter(hex)) {
+            return PathHexType::Critter;
+        }
+
+        return PathHexType::Blocked;
+    }
+
+    [[nodiscard]] auto GetTerrainHexType(mpos hex) -> PathHexType
+    {
+        if (At(hex) == Terrain::Free) {
+            return PathHexType::Free;
+        }
+        if (At(hex) == Terrain::Gag) {
+            return PathHexType::Gag;
+        }
+
+        return PathHexType::Blocked;
+    }
+
+    msize Size;
+    vector<Terrain> Hexes;
+    vector<uint8> Critters;
+};
+
+static auto BuildTestFlowField(PathTestMap& map, mpos target_hex, int32 cut, mpos from_hex, int32 max_len) -> PathFlowField
+{
+    const auto from_dist = GeometryHelper::GetDistance(from_hex, target_hex);
+
+    PathFlowField flow_field;
+    flow_field.TargetHex = target_hex;
+    flow_field.Cut = cut;
+    flow_field.Radius = std::min(from_dist + std::max(from_dist, 10), max_len);
+
+    PathFinding::BuildFlowField(flow_field, map.Size, max_len, [&](mpos hex) { return map.GetTerrainHexType(hex); });
+
+    return flow_field;
+}
+
+static auto IsPathCovered(const PathFlowField& flow_field, msize map_size, mpos from_hex, const vector<uint8>& raw_steps) -> bool
+{
+    auto hex = from_hex;
+
+    for (const auto dir : raw_steps) {
+        GeometryHelper::MoveHexByDir(hex, dir, map_size);
+
+        if (!flow_field.IsCovered(hex)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static auto CheckWalkedPath(PathTestMap& map, mpos from_hex, const vector<uint8>& raw_steps, mpos to_hex) -> bool
+{
+    auto hex = from_hex;
+
+    for (const auto dir : raw_steps) {
+        if (!GeometryHelper::MoveHexByDir(hex, dir, map.Size)) {
+            return false;
+        }
+        if (map.GetHexType(hex) != PathHexType::Free) {
+            return false;
+        }
+    }
+
+    return hex == to_hex;
+}
+
+// Every area of fresh labels lies within single area of checked labels, also checked back if exact is set
+static auto CheckRegionsPartition(PathRegions& checked, PathRegions& fresh, msize size, bool exact) -> bool
+{
+    unordered_map<uint32, uint32> fresh_to_checked;
+    unordered_map<uint32, uint32> checked_to_fresh;
+
+    for (const auto hx : iterate_range(size.width)) {
+        for (const auto hy : iterate_range(size.height)) {
+            const mpos hex {hx, hy};
+            const auto checked_label = checked.GetLabel(hex);
+            const auto fresh_label = fresh.GetLabel(hex);
+
+            if ((checked_label == 0) != (fresh_label == 0)) {
+                return false;
+            }
+            if (fresh_label == 0) {
+                continue;
+            }
+
+            if (fresh_to_checked.emplace(fresh_label, checked_label).first->second != checked_label) {
+                return false;
+            }
+            if (exact && checked_to_fresh.emplace(checked_label, fresh_label).first->second != fresh_label) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static auto CountRegionsHexes(PathRegions& regions, msize size) -> int32
+{
+    unordered_set<uint32> labels;
+    int32 count = 0;
+
+    for (const auto hx : iterate_range(size.width)) {
+        for (const auto hy : iterate_range(size.height)) {
+            if (const auto label = regions.GetLabel({hx, hy}); label != 0 && labels.emplace(label).second) {
+                count += regions.GetRegionSize(label);
+            }
+        }
+    }
+
+    return count;
+}
+
+TEST_CASE("PathRegions")
+{
+    const msize size {40, 40};
+    vector<uint8> solid(size.square());
+
+    uint32 rnd = 777;
+    const auto next_rand = [&rnd](int32 max_value) {
+        rnd = rnd * 1103515245 + 12345;
+        return numeric_cast<int32>((rnd >> 16) % numeric_cast<uint32>(max_value));
+    };
+
+    const auto hex_index = [&](mpos hex) { return numeric_cast<size_t>(hex.y) * numeric_cast<size_t>(size.width) + numeric_cast<size_t>(hex.x); };
+
+    for (auto& hex_solid : solid) {
+        hex_solid = next_rand(100) < 35 ? 1 : 0;
+    }
+
+    for (const int32 multihex : {0, 1}) {
+        const auto hexes_around = GeometryHelper::HexesInRadius(multihex);
+        const auto is_passable = [&](mpos hex) {
+            for (int32 i = 0; i < hexes_around; i++) {
+                if (auto check_hex = hex; GeometryHelper::MoveHexAroundAway(check_hex, i, size) && solid[hex_index(check_hex)] != 0) {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+        const auto count_passable = [&] {
+            int32 count = 0;
+
+            for (const auto hx : iterate_range(size.width)) {
+                for (const auto hy : iterate_range(size.height)) {
+                    count += is_passable({hx, hy}) ? 1 : 0;
+                }
+            }
+
+            return count;
+        };
+
+        PathRegions regions;
+        regions.Relabel(size, is_passable);
+        CHECK(regions.GetPendingSplits() == 0);
+        CHECK(CountRegionsHexes(regions, size) == count_passable());
+
+        // Opening hexes only merges areas, labels stay exact
+        for (int32 i = 0; i < 150; i++) {
+            const mpos hex {numeric_cast<int16>(next_rand(size.width)), numeric_cast<int16>(next_rand(size.height))};
+
+            if (solid[hex_index(hex)] != 0) {
+                solid[hex_index(hex)] = 0;
+                regions.Update(hex, multihex, is_passable);
+            }
+        }
+
+        PathRegions fresh;
+        fresh.Relabel(size, is_passable);
+
+        CHECK(regions.GetPendingSplits() == 0);
+        CHECK(CheckRegionsPartition(regions, fresh, size, true));
+        CHECK(CountRegionsHexes(regions, size) == count_passable());
+
+        // Closing hexes keeps areas joined, so no target is rejected falsely
+        for (int32 i = 0; i < 300; i++) {
+            const mpos hex {numeric_cast<int16>(next_rand(size.width)), numeric_cast<int16>(next_rand(size.height))};
+            solid[hex_index(hex)] = solid[hex_index(hex)] != 0 ? 0 : 1;
+            regions.Update(hex, multihex, is_passable);
+        }
+
+        fresh.Relabel(size, is_passable);
+
+        CHECK(regions.GetPendingSplits() != 0);
+        CHECK(CheckRegionsPartition(regions, fresh, size, false));
+        CHECK(CountRegionsHexes(regions, size) == count_passable());
+
+        regions.Relabel(size, is_passable);
+        CHECK(regions.GetPendingSplits() == 0);
+        CHECK(CheckRegionsPartition(regions, fresh, size, true));
+    }
+}
+
+TEST_CASE("PathFinding")
+{
+    constexpr int32 max_len = 100;
+    PathTestMap map {msize {60, 60}};
+
+    // Two long walls with gaps and some scattered blocks
+    for (int16 y = 0; y < 45; y++) {
+        map.At({15, y}) = PathTestMap::Terrain::Wall;
+    }
+    for (int16 y = 15; y < 60; y++) {
+        map.At({35, y}) = PathTestMap::Terrain::Wall;
+    }
+
+    uint32 rnd = 12345;
+    const auto next_rand = [&rnd](int32 max_value) {
+        rnd = rnd * 1103515245 + 12345;
+        return numeric_cast<int32>((rnd >> 16) % numeric_cast<uint32>(max_value));
+    };
+
+    for (int32 i = 0; i < 300; i++) {
+        const mpos hex {numeric_cast<int16>(next_rand(60)), numeric_cast<int16>(next_rand(60))};
+
+        if (hex.x != 15 && hex.x != 35) {
+            map.At(hex) = PathTestMap::Terrain::Wall;
+        }
+    }
+
+    const auto random_free_hex = [&] {
+        while (true) {
+            const mpos hex {numeric_cast<int16>(next_rand(60)), numeric_cast<int16>(next_rand(60))};
+
+            if (map.At(hex) == PathTestMap::Terrain::Free) {
+                return hex;
+            }
+        }
+    };
+
+    SECTION("SameLengthAsGridSearch")
+    {
+        vector<int16> grid;
+        size_t compared = 0;
+
+        for (int32 i = 0; i < 200; i++) {
+            const auto from_hex = random_free_hex();
+            const auto target_hex = random_free_hex();
+            const auto cut = next_rand(3);
+
+            if (GeometryHelper::CheckDist(from_hex, target_hex, cut)) {
+                continue;
+            }
+
+            auto grid_to_hex = target_hex;
+            vector<uint8> grid_steps;
+            const auto grid_result = PathFinding::SearchGrid(map.Size, from_hex, grid_to_hex, cut, max_len, grid, grid_steps, [&](mpos hex) { return map.GetHexType(hex); });
+
+            auto flow_field = BuildTestFlowField(map, target_hex, cut, from_hex, max_len);
+            auto flow_to_hex = target_hex;
+            vector<uint8> flow_steps;
+            const auto flow_ok = PathFinding::WalkFlowField(flow_field, map.Size, from_hex, max_len, flow_steps, flow_to_hex, [&](mpos hex) { return map.GetHexType(hex); });
+
+            CHECK_FALSE(flow_field.HasGagHexes);
+
+            // Field covers only part of map, so it may miss long detours found by grid
+            if (flow_ok) {
+                REQUIRE(grid_result == PathSearchResult::Ok);
+                CHECK(flow_steps.size() >= grid_steps.size());
+
+                if (IsPathCovered(flow_field, map.Size, from_hex, grid_steps)) {
+                    CHECK(flow_steps.size() == grid_steps.size());
+                }
+
+                CHECK(CheckWalkedPath(map, from_hex, flow_steps, flow_to_hex));
+                CHECK(GeometryHelper::CheckDist(flow_to_hex, target_hex, cut));
+                compared++;
+            }
+            else if (grid_result == PathSearchResult::Ok) {
+                CHECK_FALSE((flow_field.IsCovered(from_hex) && flow_field.GetCell(from_hex) > 0));
+            }
+        }
+
+        CHECK(compared > 100);
+    }
+
+    SECTION("CrittersOnWay")
+    {
+        vector<int16> grid;
+
+        for (int32 i = 0; i < 100; i++) {
+            map.SetCritter(random_free_hex(), true);
+        }
+
+        for (int32 i = 0; i < 100; i++) {
+            const auto from_hex = random_free_hex();
+            const auto target_hex = random_free_hex();
+
+            if (map.HasCritter(from_hex) || GeometryHelper::CheckDist(from_hex, target_hex, 1)) {
+                continue;
+            }
+
+            // Field is built without critters and only walks around them
+            auto flow_field = BuildTestFlowField(map, target_hex, 1, from_hex, max_len);
+            auto flow_to_hex = target_hex;
+            vector<uint8> flow_steps;
+
+            if (PathFinding::WalkFlowField(flow_field, map.Size, from_hex, max_len, flow_steps, flow_to_hex, [&](mpos hex) { return map.GetHexType(hex); })) {
+                CHECK(CheckWalkedPath(map, from_hex, flow_steps, flow_to_hex));
+
+                auto grid_to_hex = target_hex;
+                vector<uint8> grid_steps;
+                REQUIRE(PathFinding::SearchGrid(map.Size, from_hex, grid_to_hex, 1, max_len, grid, grid_steps, [&](mpos hex) { return map.GetHexType(hex); }) == PathSearchResult::Ok);
+                CHECK(flow_steps.size() >= grid_steps.size());
+            }
+        }
+    }
+
+    SECTION("ClosedRoomWithDoor")
+    {
+        // Room closed by walls with single gag hex in wall, open area around it
+        for (int16 x = 36; x < 60; x++) {
+            for (int16 y = 20; y < 60; y++) {
+                map.At({x, y}) = PathTestMap::Terrain::Free;
+            }
+        }
+
+        for (int16 x = 40; x <= 50; x++) {
+            map.At({x, 40}) = PathTestMap::Terrain::Wall;
+            map.At({x, 50}) = PathTestMap::Terrain::Wall;
+        }
+        for (int16 y = 40; y <= 50; y++) {
+            map.At({40, y}) = PathTestMap::Terrain::Wall;
+            map.At({50, y}) = PathTestMap::Terrain::Wall;
+        }
+        map.At({45, 40}) = PathTestMap::Terrain::Gag;
+
+        const mpos from_hex {45, 30};
+        const mpos target_hex {45, 45};
+        vector<int16> grid;
+
+        // Grid search goes through door
+        auto grid_to_hex = target_hex;
+        vector<uint8> grid_steps;
+        CHECK(PathFinding::SearchGrid(map.Size, from_hex, grid_to_hex, 0, max_len, grid, grid_steps, [&](mpos hex) { return map.GetHexType(hex); }) == PathSearchResult::Ok);
+        CHECK(grid_to_hex == target_hex);
+
+        // Field has no way through door and reports it for fallback to grid search
+        auto flow_field = BuildTestFlowField(map, target_hex, 0, from_hex, max_len);
+        auto flow_to_hex = target_hex;
+        vector<uint8> flow_steps;
+        CHECK(flow_field.HasGagHexes);
+        CHECK_FALSE(PathFinding::WalkFlowField(flow_field, map.Size, from_hex, max_len, flow_steps, flow_to_hex, [&](mpos hex) { return map.GetHexType(hex); }));
+
+        // Without door both agree there is no way
+        map.At({45, 40}) = PathTestMap::Terrain::Wall;
+
+        grid_to_hex = target_hex;
+        CHECK(PathFinding::SearchGrid(map.Size, from_hex, grid_to_hex, 0, max_len, grid, grid_steps, [&](mpos hex) { return map.GetTerrainHexType(hex); }) == PathSearchResult::NoWay);
+
+        flow_field = BuildTestFlowField(map, target_hex, 0, from_hex, max_len);
+        CHECK_FALSE(flow_field.HasGagHexes);
+        CHECK_FALSE(PathFinding::WalkFlowField(flow_field, map.Size, from_hex, max_len, flow_steps, flow_to_hex, [&](mpos hex) { return map.GetHexType(hex); }));
+    }
+}
+
+FO_END_NAMESPACE();
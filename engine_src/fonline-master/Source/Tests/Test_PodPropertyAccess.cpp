@@ -0,0 +1,269 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "EngineBase.h"
+#include "Entity.h"
+#include "Properties.h"
+
+FO_BEGIN_NAMESPACE();
+
+class PodAccessTestEntity final : public Entity
+{
+public:
+    explicit PodAccessTestEntity(const PropertyRegistrator* registrator) noexcept :
+        Entity(registrator, nullptr)
+    {
+    }
+    ~PodAccessTestEntity() override = default;
+
+    [[nodiscard]] auto GetName() const noexcept -> string_view override { return "PodAccessTest"; }
+};
+
+struct PodAccessTestData
+{
+    PodAccessTestData() :
+        Data {PropertiesRelationType::ServerRelative, [] { }}
+    {
+        Data.RegisterEnumGroup("PodAccessTestEnum", Data.ResolveBaseType("uint8"), {{"None", 0}, {"Max", 255}});
+        Data.RegisterEnumGroup("PodAccessTestWideEnum", Data.ResolveBaseType("int32"), {{"Negative", -5}, {"Positive", 100000}});
+
+        auto* registrator = Data.RegisterEntityType("PodAccessTest", false, false);
+        registrator->RegisterProperty({"Flag", "Server", "bool", "Mutable"});
+        registrator->RegisterProperty({"Small", "Server", "int8", "Mutable"});
+        registrator->RegisterProperty({"Count", "Server", "uint16", "Mutable"});
+        registrator->RegisterProperty({"Big", "Server", "int64", "Mutable"});
+        registrator->RegisterProperty({"Ratio", "Server", "float32", "Mutable"});
+        registrator->RegisterProperty({"Kind", "Server", "PodAccessTestEnum", "Mutable"});
+        registrator->RegisterProperty({"WideKind", "Server", "PodAccessTestWideEnum", "Mutable"});
+        registrator->RegisterProperty({"Name", "Server", "string", "Mutable"});
+
+        Registrator = registrator;
+    }
+
+    [[nodiscard]] auto Prop(string_view name) const -> const Property*
+    {
+        const auto* prop = Registrator->FindProperty(name);
+        FO_RUNTIME_ASSERT(prop);
+        return prop;
+    }
+
+    EngineData Data;
+    raw_ptr<const PropertyRegistrator> Registrator {};
+};
+
+// Same as script generic path, raw data is copied into zero filled script value
+template<typename TScript>
+static auto GetGeneric(const Properties& props, const Property* prop) -> TScript
+{
+    const auto raw_data = props.GetRawData(prop);
+    FO_RUNTIME_ASSERT(raw_data.size() <= sizeof(TScript));
+
+    TScript value {};
+    MemCopy(&value, raw_data.data(), raw_data.size());
+    return value;
+}
+
+template<typename TScript>
+static void SetGeneric(Properties& props, const Property* prop, TScript value)
+{
+    PropertyRawData prop_data;
+    prop_data.Pass(&value, prop->GetBaseSize());
+    props.SetValue(prop, prop_data);
+}
+
+template<typename TScript>
+static auto GetTyped(const Properties& props, const Property* prop) -> TScript
+{
+    const auto value = ResolvePodPropertyAccess(prop, [&]<typename TAccess>(TAccess) -> optional<TScript> {
+        if constexpr (std::same_as<typename TAccess::ScriptType, TScript>) {
+            return TAccess::Get(props, prop);
+        }
+        else {
+            return std::nullopt;
+        }
+    });
+
+    FO_RUNTIME_ASSERT(value.has_value() && value->has_value());
+    return value->value();
+}
+
+template<typename TScript>
+static void SetTyped(Properties& props, const Property* prop, TScript value)
+{
+    const auto done = ResolvePodPropertyAccess(prop, [&]<typename TAccess>(TAccess) -> bool {
+        if constexpr (std::same_as<typename TAccess::ScriptType, TScript>) {
+            TAccess::Set(props, prop, value);
+            return true;
+        }
+        else {
+            return false;
+        }
+    });
+
+    FO_RUNTIME_ASSERT(done.value_or(false));
+}
+
+template<typename TScript>
+static void CheckSameAccess(PodAccessTestEntity& typed_entity, PodAccessTestEntity& generic_entity, const Property* prop, TScript value)
+{
+    SetTyped<TScript>(typed_entity.GetPropertiesForEdit(), prop, value);
+    SetGeneric<TScript>(generic_entity.GetPropertiesForEdit(), prop, value);
+
+    CHECK(GetTyped<TScript>(typed_entity.GetProperties(), prop) == value);
+    CHECK(GetTyped<TScript>(typed_entity.GetProperties(), prop) == GetGeneric<TScript>(generic_entity.GetProperties(), prop));
+    CHECK(GetGeneric<TScript>(typed_entity.GetProperties(), prop) == GetTyped<TScript>(generic_entity.GetProperties(), prop));
+}
+
+TEST_CASE("PodPropertyAccess")
+{
+    PodAccessTestData data;
+    PodAccessTestEntity typed_entity {data.Registrator.get()};
+    PodAccessTestEntity generic_entity {data.Registrator.get()};
+
+    SECTION("Resolve")
+    {
+        const auto script_size = [](const Property* prop) { return ResolvePodPropertyAccess(prop, []<typename TAccess>(TAccess) { return sizeof(typename TAccess::ScriptType); }); };
+
+        CHECK(script_size(data.Prop("Flag")) == sizeof(bool));
+        CHECK(script_size(data.Prop("Count")) == sizeof(uint16));
+        CHECK(script_size(data.Prop("Big")) == sizeof(int64));
+        CHECK(script_size(data.Prop("Kind")) == sizeof(int32));
+        CHECK(!script_size(data.Prop("Name")).has_value());
+    }
+
+    SECTION("SameAsGeneric")
+    {
+        CheckSameAccess<bool>(typed_entity, generic_entity, data.Prop("Flag"), true);
+        CheckSameAccess<int8>(typed_entity, generic_entity, data.Prop("Small"), -100);
+        CheckSameAccess<uint16>(typed_entity, generic_entity, data.Prop("Count"), 65000);
+        CheckSameAccess<int64>(typed_entity, generic_entity, data.Prop("Big"), -(int64 {1} << 40));
+        CheckSameAccess<float32>(typed_entity, generic_entity, data.Prop("Ratio"), 0.25f);
+        CheckSameAccess<int32>(typed_entity, generic_entity, data.Prop("WideKind"), -5);
+    }
+
+    SECTION("EnumZeroExtension")
+    {
+        const auto* prop = data.Prop("Kind");
+
+        // One byte enum above 127 must not come back sign extended
+        CheckSameAccess<int32>(typed_entity, generic_entity, prop, 200);
+        CHECK(GetTyped<int32>(typed_entity.GetProperties(), prop) == 200);
+        CheckSameAccess<int32>(typed_entity, generic_entity, prop, 255);
+        CheckSameAccess<int32>(typed_entity, generic_entity, prop, 0);
+    }
+
+    SECTION("SettersFire")
+    {
+        const auto* prop = data.Prop("Count");
+        vector<pair<const Entity*, int32>> setter_calls;
+        vector<const Entity*> post_setter_calls;
+
+        prop->AddSetter([&](Entity* entity, const Property*, PropertyRawData& prop_data) {
+            // Setter may adjust value before it is stored
+            setter_calls.emplace_back(entity, prop_data.GetAs<uint16>());
+            prop_data.SetAs<uint16>(numeric_cast<uint16>(prop_data.GetAs<uint16>() + 1));
+        });
+        prop->AddPostSetter([&](Entity* entity, const Property*) { post_setter_calls.emplace_back(entity); });
+
+        CheckSameAccess<uint16>(typed_entity, generic_entity, prop, 0);
+        CHECK(setter_calls.empty());
+        CHECK(post_setter_calls.empty());
+
+        SetTyped<uint16>(typed_entity.GetPropertiesForEdit(), prop, 10);
+        SetGeneric<uint16>(generic_entity.GetPropertiesForEdit(), prop, 10);
+
+        CHECK(setter_calls == vector<pair<const Entity*, int32>> {{&typed_entity, 10}, {&generic_entity, 10}});
+        CHECK(post_setter_calls == vector<const Entity*> {&typed_entity, &generic_entity});
+        CHECK(GetTyped<uint16>(typed_entity.GetProperties(), prop) == 11);
+        CHECK(GetGeneric<uint16>(generic_entity.GetProperties(), prop) == 11);
+
+        // Same value is not set again
+        SetTyped<uint16>(typed_entity.GetPropertiesForEdit(), prop, 11);
+        SetGeneric<uint16>(generic_entity.GetPropertiesForEdit(), prop, 11);
+
+        CHECK(setter_calls.size() == 2);
+        CHECK(post_setter_calls.size() == 2);
+    }
+}
+
+TEST_CASE("PodPropertyAccessBenchmark", "[.benchmark]")
+{
+    PodAccessTestData data;
+    PodAccessTestEntity entity {data.Registrator.get()};
+    auto& props = entity.GetPropertiesForEdit();
+    const auto* prop = data.Prop("Big");
+
+    BENCHMARK("generic get")
+    {
+        int64 sum = 0;
+
+        for (int32 i = 0; i < 1000; i++) {
+            sum += GetGeneric<int64>(props, prop);
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("typed get")
+    {
+        int64 sum = 0;
+
+        for (int32 i = 0; i < 1000; i++) {
+            sum += PodPropertyAccess<int64>::Get(props, prop);
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("generic set")
+    {
+        for (int32 i = 0; i < 1000; i++) {
+            SetGeneric<int64>(props, prop, i);
+        }
+
+        return props.GetValueFast<int64>(prop);
+    };
+
+    BENCHMARK("typed set")
+    {
+        for (int32 i = 0; i < 1000; i++) {
+            PodPropertyAccess<int64>::Set(props, prop, i);
+        }
+
+        return props.GetValueFast<int64>(prop);
+    };
+}
+
+FO_END_NAMESPACE();
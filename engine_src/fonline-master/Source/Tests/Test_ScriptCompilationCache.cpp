@@ -0,0 +1,237 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "ScriptCompilationCache.h"
+
+FO_BEGIN_NAMESPACE();
+
+TEST_CASE("ScriptCompilationCache")
+{
+    const auto root = strex(std::filesystem::temp_directory_path().generic_string()).combine_path("FOnlineScriptCompilationCacheTest").str();
+    const auto scripts_dir = strex(root).combine_path("Scripts").str();
+    const auto cache_dir = strex(root).combine_path("ScriptCache").str();
+    const auto include_path = strex(root).combine_path("Include.fosh").str();
+    const auto base_time = std::filesystem::file_time_type::clock::now() - std::chrono::hours {1};
+
+    DiskFileSystem::DeleteDir(root);
+    REQUIRE(DiskFileSystem::MakeDirTree(scripts_dir));
+
+    const auto write_file = [&](const string& path, string_view content, int32 time_offset) {
+        REQUIRE(DiskFileSystem::WriteFile(path, content));
+        std::filesystem::last_write_time(std::filesystem::path(path), base_time + std::chrono::seconds {time_offset});
+    };
+
+    const auto source_a = strex(scripts_dir).combine_path("A.fos").str();
+    const auto source_b = strex(scripts_dir).combine_path("B.fos").str();
+    write_file(source_a, "void A() {}", 0);
+    write_file(source_b, "void B() {}", 0);
+    write_file(include_path, "// Shared", 0);
+
+    // Stand-in for script compiler, output depends on sources and include content only
+    size_t compilations = 0;
+
+    const auto compile = [&](const vector<File>& sources, vector<string>& included_files) -> vector<uint8> {
+        compilations++;
+
+        vector<string> parts;
+
+        for (const auto& source : sources) {
+            parts.emplace_back(strex("{}={}", source.GetPath(), source.GetStr()));
+        }
+
+        std::ranges::sort(parts);
+        parts.emplace_back(DiskFileSystem::ReadFile(include_path).value_or(""));
+        included_files = {include_path, include_path};
+
+        string output;
+
+        for (const auto& part : parts) {
+            output += part;
+            output += ';';
+        }
+
+        return {output.begin(), output.end()};
+    };
+
+    struct BakeResult
+    {
+        ScriptCompilationCache::TargetState State {};
+        size_t HashedFiles {};
+        vector<uint8> Output {};
+    };
+
+    const auto bake = [&](string_view build_hash, const vector<string>& targets) -> vector<BakeResult> {
+        FileSystem input_files;
+        input_files.AddDirSource(scripts_dir, true);
+
+        vector<FileHeader> sources;
+
+        for (const auto& file_header : input_files.GetAllFiles()) {
+            sources.emplace_back(file_header.Copy());
+        }
+
+        ScriptCompilationCache cache {cache_dir, build_hash, std::move(sources)};
+        vector<BakeResult> results;
+
+        for (const auto& target : targets) {
+            auto& result = results.emplace_back();
+            result.State = cache.CheckTarget(target);
+
+            if (result.State.IsValid) {
+                result.Output = cache.LoadTargetData(target).value();
+            }
+            else {
+                vector<string> included_files;
+                result.Output = compile(cache.GetSourceFiles(), included_files);
+                cache.StoreTarget(target, result.Output, included_files);
+            }
+        }
+
+        for (auto& result : results) {
+            result.HashedFiles = cache.GetHashedFilesCount();
+        }
+
+        return results;
+    };
+
+    const auto bake_one = [&](string_view build_hash = "Build1") -> BakeResult { return bake(build_hash, {"Pack.fos-bin-server"}).front(); };
+
+    const auto first = bake_one();
+    CHECK(!first.State.HasCache);
+    CHECK(compilations == 1);
+
+    SECTION("Unchanged")
+    {
+        // Sizes and write times match, nothing is hashed
+        const auto second = bake_one();
+        CHECK(second.State.IsValid);
+        CHECK(second.HashedFiles == 0);
+        CHECK(second.Output == first.Output);
+        CHECK(compilations == 1);
+    }
+
+    SECTION("TouchedWithoutChanges")
+    {
+        write_file(source_a, "void A() {}", 10);
+        write_file(include_path, "// Shared", 20);
+
+        const auto second = bake_one();
+        CHECK(second.State.IsValid);
+        CHECK(second.State.InputWriteTime == numeric_cast<uint64>((base_time + std::chrono::seconds {20}).time_since_epoch().count()));
+        CHECK(second.HashedFiles == 3);
+        CHECK(second.Output == first.Output);
+        CHECK(compilations == 1);
+
+        // Fresh stamps are kept after content check
+        const auto third = bake_one();
+        CHECK(third.State.IsValid);
+        CHECK(third.HashedFiles == 0);
+    }
+
+    SECTION("SourceChanged")
+    {
+        write_file(source_a, "void A() { B(); }", 10);
+
+        const auto second = bake_one();
+        CHECK(second.State.HasCache);
+        CHECK(!second.State.IsValid);
+        CHECK(compilations == 2);
+        CHECK(second.Output != first.Output);
+    }
+
+    SECTION("IncludeChanged")
+    {
+        // Include got older content from checkout, its write time is not newer than output
+        write_file(include_path, "// Shared and changed", -10);
+
+        const auto second = bake_one();
+        CHECK(second.State.HasCache);
+        CHECK(!second.State.IsValid);
+        CHECK(compilations == 2);
+        CHECK(second.Output != first.Output);
+        CHECK(bake_one().State.IsValid);
+    }
+
+    SECTION("SourceRemoved")
+    {
+        REQUIRE(DiskFileSystem::DeleteFile(source_b));
+
+        const auto second = bake_one();
+        CHECK(!second.State.IsValid);
+        CHECK(compilations == 2);
+    }
+
+    SECTION("BuildChanged")
+    {
+        CHECK(!bake_one("Build2").State.IsValid);
+        CHECK(compilations == 2);
+    }
+
+    SECTION("HashedOnceForAllTargets")
+    {
+        bake("Build1", {"Pack.fos-bin-client", "Pack.fos-bin-mapper"});
+        CHECK(compilations == 3);
+
+        write_file(source_b, "void B() {}", 10);
+
+        const auto results = bake("Build1", {"Pack.fos-bin-server", "Pack.fos-bin-client", "Pack.fos-bin-mapper"});
+
+        for (const auto& result : results) {
+            CHECK(result.State.IsValid);
+            CHECK(result.HashedFiles == 3);
+        }
+
+        CHECK(compilations == 3);
+    }
+
+    SECTION("DeterministicOutput")
+    {
+        const auto manifest = DiskFileSystem::ReadFile(strex(cache_dir).combine_path("Pack.fos-bin-server.deps"));
+        REQUIRE(manifest.has_value());
+
+        // Clean rebuild from same inputs gives same output and same manifest
+        REQUIRE(DiskFileSystem::DeleteDir(cache_dir));
+
+        const auto second = bake_one();
+        CHECK(!second.State.HasCache);
+        CHECK(second.Output == first.Output);
+        CHECK(DiskFileSystem::ReadFile(strex(cache_dir).combine_path("Pack.fos-bin-server.deps")) == manifest);
+        CHECK(compilations == 2);
+    }
+
+    DiskFileSystem::DeleteDir(root);
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,342 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+#include "ScriptCoroutineScheduler.h"
+
+FO_BEGIN_NAMESPACE();
+
+TEST_CASE("ScriptCoroutineScheduler")
+{
+    using Scheduler = ScriptCoroutineScheduler;
+
+    // Synthetic clock and fake coroutine handles
+    nanotime cur_time = nanotime(timespan(std::chrono::seconds {100}));
+    const auto advance = [&](int32 ms) { cur_time += timespan(std::chrono::milliseconds {ms}); };
+    const auto after = [&](int32 ms) { return cur_time + timespan(std::chrono::milliseconds {ms}); };
+
+    array<int32, 8> storage {};
+    const auto co = [&](size_t index) -> Scheduler::Coroutine { return &storage[index]; };
+
+    HashStorage hashes;
+    const auto event_a = hashes.ToHashedString("EventA");
+    const auto event_b = hashes.ToHashedString("EventB");
+
+    Scheduler scheduler;
+    vector<Scheduler::Wakeup> wakeups;
+
+    const auto collect = [&] {
+        wakeups.clear();
+        scheduler.CollectWakeups(cur_time, wakeups);
+        return wakeups.size();
+    };
+
+    SECTION("DeadlineOrder")
+    {
+        scheduler.SuspendUntil(co(0), after(30));
+        scheduler.SuspendUntil(co(1), after(10));
+        scheduler.SuspendUntil(co(2), after(20));
+        scheduler.SuspendUntil(co(3), after(10));
+
+        CHECK(scheduler.GetSuspendedCount() == 4);
+        CHECK(collect() == 0);
+        CHECK_FALSE(scheduler.HasPendingWakeups(cur_time));
+
+        advance(20);
+        REQUIRE(collect() == 3);
+        CHECK(wakeups[0].Co == co(1));
+        CHECK(wakeups[1].Co == co(3));
+        CHECK(wakeups[2].Co == co(2));
+        CHECK(wakeups[0].Reason == Scheduler::WakeReason::Timeout);
+        CHECK(scheduler.GetSuspendedCount() == 1);
+        CHECK_FALSE(scheduler.IsSuspended(co(1)));
+        CHECK(scheduler.IsSuspended(co(0)));
+
+        advance(100);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Co == co(0));
+        CHECK(scheduler.GetSuspendedCount() == 0);
+    }
+
+    SECTION("EventWakeup")
+    {
+        scheduler.SuspendOnEvent(co(0), event_a, std::nullopt);
+        scheduler.SuspendOnEvent(co(1), event_a, after(50));
+        scheduler.SuspendOnEvent(co(2), event_b, std::nullopt);
+
+        CHECK(scheduler.GetEventWaitersCount(event_a) == 2);
+        CHECK(scheduler.NotifyEvent(event_a) == 2);
+        CHECK(scheduler.NotifyEvent(event_a) == 0);
+        CHECK(scheduler.GetEventWaitersCount(event_a) == 0);
+        CHECK(scheduler.HasPendingWakeups(cur_time));
+
+        REQUIRE(collect() == 2);
+        CHECK(wakeups[0].Co == co(0));
+        CHECK(wakeups[1].Co == co(1));
+        CHECK(wakeups[1].Reason == Scheduler::WakeReason::Event);
+
+        // Stale deadline of event woken coroutine must be ignored
+        advance(100);
+        CHECK(collect() == 0);
+        CHECK(scheduler.IsSuspended(co(2)));
+    }
+
+    SECTION("EventTimeout")
+    {
+        scheduler.SuspendOnEvent(co(0), event_a, after(10));
+
+        advance(10);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Reason == Scheduler::WakeReason::Timeout);
+        CHECK(scheduler.GetEventWaitersCount(event_a) == 0);
+        CHECK(scheduler.NotifyEvent(event_a) == 0);
+    }
+
+    SECTION("Cancel")
+    {
+        scheduler.SuspendUntil(co(0), after(10));
+        scheduler.SuspendOnEvent(co(1), event_a, after(10));
+        scheduler.SuspendOnEvent(co(2), event_b, std::nullopt);
+        CHECK(scheduler.NotifyEvent(event_b) == 1);
+
+        scheduler.Cancel(co(0));
+        scheduler.Cancel(co(1));
+        scheduler.Cancel(co(2));
+
+        CHECK(scheduler.GetSuspendedCount() == 0);
+        CHECK(scheduler.GetEventWaitersCount(event_a) == 0);
+
+        advance(50);
+        CHECK(collect() == 0);
+    }
+
+    SECTION("ResuspendAfterWakeup")
+    {
+        scheduler.SuspendUntil(co(0), after(10));
+        scheduler.Cancel(co(0));
+        scheduler.SuspendUntil(co(0), after(30));
+
+        // Old heap entry shares coroutine but not generation
+        advance(10);
+        CHECK(collect() == 0);
+
+        advance(20);
+        REQUIRE(collect() == 1);
+
+        scheduler.SuspendUntil(co(0), after(10));
+        CHECK(scheduler.IsSuspended(co(0)));
+    }
+
+    SECTION("OwnerDestroyed")
+    {
+        const int32 owner = 0;
+        const int32 other_owner = 0;
+
+        // Endless event wait of bound coroutine would stay forever without owner cancel
+        scheduler.SuspendOnEvent(co(0), event_a, std::nullopt, &owner);
+        scheduler.SuspendUntil(co(1), after(10), &owner);
+        scheduler.SuspendOnEvent(co(2), event_a, std::nullopt, &other_owner);
+        scheduler.SuspendOnEvent(co(3), event_b, std::nullopt);
+        CHECK(scheduler.GetOwnerWaitsCount(&owner) == 2);
+
+        CHECK(scheduler.CancelOwner(&owner) == 2);
+        CHECK(scheduler.CancelOwner(&owner) == 0);
+        CHECK(scheduler.GetOwnerWaitsCount(&owner) == 0);
+        CHECK(scheduler.GetEventWaitersCount(event_a) == 1);
+
+        REQUIRE(collect() == 2);
+        CHECK(wakeups[0].Reason == Scheduler::WakeReason::OwnerDestroyed);
+        CHECK(wakeups[1].Reason == Scheduler::WakeReason::OwnerDestroyed);
+        CHECK(scheduler.GetSuspendedCount() == 2);
+
+        advance(20);
+        CHECK(collect() == 0);
+
+        // Finished waits leave owner list
+        scheduler.SuspendUntil(co(0), after(10), &owner);
+        advance(10);
+        CHECK(collect() == 1);
+        CHECK(scheduler.GetOwnerWaitsCount(&owner) == 0);
+    }
+
+    SECTION("TargetEvents")
+    {
+        const int32 target = 0;
+        const int32 other_target = 0;
+
+        scheduler.SuspendOnEvent(co(0), event_a, std::nullopt, nullptr, &target);
+        scheduler.SuspendOnEvent(co(1), event_b, after(10), nullptr, &target);
+        scheduler.SuspendOnEvent(co(2), event_a, std::nullopt, nullptr, &other_target);
+        scheduler.SuspendOnEvent(co(3), event_a, std::nullopt);
+
+        CHECK(scheduler.GetEventWaitersCount(event_a) == 1);
+        CHECK(scheduler.GetEventWaitersCount(event_a, &target) == 1);
+        CHECK(scheduler.GetTargetWaitersCount(&target) == 2);
+
+        CHECK(scheduler.NotifyEvent(event_a, &target) == 1);
+        CHECK(scheduler.GetTargetWaitersCount(&target) == 1);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Co == co(0));
+
+        // Destroyed target wakes all its waiters whatever event they wait
+        CHECK(scheduler.NotifyTarget(&target) == 1);
+        CHECK(scheduler.NotifyTarget(&target) == 0);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Co == co(1));
+        CHECK(wakeups[0].Reason == Scheduler::WakeReason::Event);
+
+        CHECK(scheduler.IsSuspended(co(2)));
+        CHECK(scheduler.IsSuspended(co(3)));
+        CHECK(scheduler.NotifyEvent(event_a) == 1);
+    }
+
+    SECTION("CompactDeadlines")
+    {
+        vector<int32> many(Scheduler::MIN_DEADLINES_TO_COMPACT * 4);
+
+        for (auto& entry : many) {
+            scheduler.SuspendOnEvent(&entry, event_a, after(1000));
+        }
+
+        scheduler.SuspendUntil(co(0), after(10));
+        CHECK(scheduler.GetDeadlinesCount() == many.size() + 1);
+
+        // Woken event waits leave stale heap entries, which are dropped once they outnumber live ones
+        CHECK(scheduler.NotifyEvent(event_a) == many.size());
+        CHECK(scheduler.GetDeadlinesCount() == 1);
+        CHECK(collect() == many.size());
+
+        advance(10);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Co == co(0));
+
+        // Few stale entries are kept until popped
+        scheduler.SuspendOnEvent(co(1), event_b, after(10));
+        scheduler.SuspendUntil(co(2), after(20));
+        CHECK(scheduler.NotifyEvent(event_b) == 1);
+        CHECK(scheduler.GetDeadlinesCount() == 2);
+        CHECK(collect() == 1);
+
+        advance(20);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Co == co(2));
+        CHECK(scheduler.GetDeadlinesCount() == 0);
+    }
+
+    SECTION("UnloadedTarget")
+    {
+        const int32 target = 0;
+        const int32 reloaded_target = 0;
+        const int32 owner = 0;
+        const Scheduler::ParkKey target_id = 100;
+
+        // Script of live owner waits for events of entity that gets paged out
+        scheduler.SuspendOnEvent(co(0), event_a, std::nullopt, &owner, &target);
+        scheduler.SuspendOnEvent(co(1), event_b, after(10), nullptr, &target);
+
+        CHECK(scheduler.ParkTarget(&target, target_id) == 2);
+        CHECK(scheduler.GetParkedWaitersCount(target_id) == 2);
+        CHECK(scheduler.GetTargetWaitersCount(&target) == 0);
+        CHECK(scheduler.NotifyTarget(&target) == 0);
+        CHECK(scheduler.NotifyEvent(event_a, &target) == 0);
+        CHECK(scheduler.NotifyEvent(event_a) == 0);
+        CHECK(scheduler.GetSuspendedCount() == 2);
+
+        // Deadlines keep running while target is away
+        advance(10);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Co == co(1));
+        CHECK(wakeups[0].Reason == Scheduler::WakeReason::Timeout);
+        CHECK(scheduler.GetParkedWaitersCount(target_id) == 1);
+
+        // Reloaded entity is new object
+        CHECK(scheduler.UnparkTarget(target_id, &reloaded_target) == 1);
+        CHECK(scheduler.UnparkTarget(target_id, &reloaded_target) == 0);
+        CHECK(scheduler.GetTargetWaitersCount(&reloaded_target) == 1);
+        CHECK(scheduler.NotifyEvent(event_a, &reloaded_target) == 1);
+        REQUIRE(collect() == 1);
+        CHECK(wakeups[0].Co == co(0));
+        CHECK(wakeups[0].Reason == Scheduler::WakeReason::Event);
+
+        // Parked waits still belong to their owners
+        scheduler.SuspendOnEvent(co(2), event_a, std::nullopt, &owner, &reloaded_target);
+        scheduler.ParkTarget(&reloaded_target, target_id);
+        CHECK(scheduler.CancelOwner(&owner) == 1);
+        CHECK(scheduler.GetParkedWaitersCount(target_id) == 0);
+        CHECK(scheduler.GetSuspendedCount() == 0);
+    }
+
+    SECTION("Clear")
+    {
+        scheduler.SuspendUntil(co(0), after(10));
+        scheduler.SuspendOnEvent(co(1), event_a, std::nullopt);
+        scheduler.Clear();
+
+        CHECK(scheduler.GetSuspendedCount() == 0);
+        CHECK(scheduler.NotifyEvent(event_a) == 0);
+        advance(20);
+        CHECK(collect() == 0);
+    }
+}
+
+TEST_CASE("ScriptCoroutineSchedulerBenchmark", "[.benchmark]")
+{
+    using Scheduler = ScriptCoroutineScheduler;
+
+    constexpr size_t sleepers = 10000;
+
+    nanotime cur_time = nanotime(timespan(std::chrono::seconds {100}));
+    vector<int32> storage(sleepers + 1);
+    Scheduler scheduler;
+    vector<Scheduler::Wakeup> wakeups;
+
+    // Many long sleepers, one short yielder woken every tick
+    for (size_t i = 0; i < sleepers; i++) {
+        scheduler.SuspendUntil(&storage[i], cur_time + timespan(std::chrono::hours {1}));
+    }
+
+    BENCHMARK("TickWithManySleepers")
+    {
+        scheduler.SuspendUntil(&storage[sleepers], cur_time);
+        wakeups.clear();
+        scheduler.CollectWakeups(cur_time, wakeups);
+        cur_time += timespan(std::chrono::milliseconds {1});
+        return wakeups.size();
+    };
+}
+
+FO_END_NAMESPACE();
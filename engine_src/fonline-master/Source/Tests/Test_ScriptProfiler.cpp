@@ -0,0 +1,132 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+#include "ScriptProfiler.h"
+
+FO_BEGIN_NAMESPACE();
+
+TEST_CASE("ScriptProfiler")
+{
+    const string func_names[] = {"void Main()", "void Update()", "void Think()"};
+    const void* main_func = &func_names[0];
+    const void* update_func = &func_names[1];
+    const void* think_func = &func_names[2];
+    const auto resolve_name = [](const void* func) -> string { return *static_cast<const string*>(func); };
+
+    SECTION("SelfAndTotal")
+    {
+        ScriptProfiler profiler;
+        const void* stack1[] = {main_func, update_func, think_func};
+        const void* stack2[] = {main_func, update_func};
+        profiler.AddSample(stack1, 3, resolve_name);
+        profiler.AddSample(stack2, 1, resolve_name);
+
+        CHECK(profiler.GetSamplesCount() == 4);
+
+        const auto stats = profiler.GetFuncStats();
+        REQUIRE(stats.size() == 3);
+        CHECK(stats[0].Name == "void Main()");
+        CHECK(stats[0].SelfSamples == 0);
+        CHECK(stats[0].TotalSamples == 4);
+        CHECK(stats[1].SelfSamples == 1);
+        CHECK(stats[1].TotalSamples == 4);
+        CHECK(stats[2].SelfSamples == 3);
+        CHECK(stats[2].TotalSamples == 3);
+    }
+
+    SECTION("RecursionCountedOnce")
+    {
+        ScriptProfiler profiler;
+        const void* stack[] = {main_func, think_func, think_func, think_func};
+        profiler.AddSample(stack, 1, resolve_name);
+
+        const auto stats = profiler.GetFuncStats();
+        REQUIRE(stats.size() == 2);
+        CHECK(stats[1].SelfSamples == 1);
+        CHECK(stats[1].TotalSamples == 1);
+    }
+
+    SECTION("FoldedStacks")
+    {
+        ScriptProfiler profiler;
+        const void* stack1[] = {main_func, update_func};
+        const void* stack2[] = {main_func, update_func, think_func};
+        profiler.AddSample(stack1, 2, resolve_name);
+        profiler.AddSample(stack2, 5, resolve_name);
+        profiler.AddSample(stack1, 1, resolve_name);
+
+        CHECK(profiler.GetFoldedStacks() == "void Main();void Update() 3\nvoid Main();void Update();void Think() 5\n");
+
+        const auto top = profiler.GetTopFunctions(1);
+        CHECK(top.find("void Think()") != string::npos);
+        CHECK(top.find("void Update()") == string::npos);
+
+        profiler.Reset();
+        CHECK(profiler.GetSamplesCount() == 0);
+        CHECK(profiler.GetFoldedStacks().empty());
+    }
+
+    SECTION("DumpPath")
+    {
+        const auto in_dump_dir = [](string_view file_name) { return strex(ScriptProfiler::DUMP_DIR).combine_path(file_name).str(); };
+
+        CHECK(ScriptProfiler::MakeDumpPath("") == in_dump_dir("ScriptProfile.folded"));
+        CHECK(ScriptProfiler::MakeDumpPath("Run_1") == in_dump_dir("Run_1.folded"));
+        CHECK(ScriptProfiler::MakeDumpPath("run-2.folded") == in_dump_dir("run-2.folded"));
+
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath("../Server").has_value());
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath("..").has_value());
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath(".hidden").has_value());
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath("dir/name").has_value());
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath("dir\\name").has_value());
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath("C:name").has_value());
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath("/etc/passwd").has_value());
+        CHECK_FALSE(ScriptProfiler::MakeDumpPath(string(ScriptProfiler::MAX_DUMP_NAME_LENGTH + 1, 'a')).has_value());
+    }
+
+    SECTION("NoPendingSamplesWhenStopped")
+    {
+        ScriptProfiler profiler;
+        CHECK_FALSE(profiler.IsEnabled());
+        profiler.BeginExecution();
+        CHECK(profiler.ConsumePendingSamples() == 0);
+        profiler.EndExecution();
+    }
+}
+
+FO_END_NAMESPACE();
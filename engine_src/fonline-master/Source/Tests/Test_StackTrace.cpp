@@ -0,0 +1,255 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE();
+
+static constexpr SourceLocationData TestLocA {nullptr, "TestFuncA", "TestFile.cpp", 1};
+static constexpr SourceLocationData TestLocB {nullptr, "TestFuncB", "TestFile.cpp", 2};
+
+// Default out of line push and pop with bounds checks
+struct CheckedTraceMode
+{
+    static void Push(const SourceLocationData& loc) noexcept { PushStackTrace(loc); }
+    static void Pop() noexcept { PopStackTrace(); }
+};
+
+struct CompactTraceMode
+{
+    static void Push(const SourceLocationData& loc) noexcept { PushStackTraceCompact(loc); }
+    static void Pop() noexcept { PopStackTraceCompact(); }
+};
+
+struct NoTraceMode
+{
+    static void Push(const SourceLocationData& loc) noexcept { (void)loc; }
+    static void Pop() noexcept { }
+};
+
+template<typename Mode>
+struct TestTraceEntry
+{
+    explicit TestTraceEntry(const SourceLocationData& loc) noexcept { Mode::Push(loc); }
+    ~TestTraceEntry() noexcept { Mode::Pop(); }
+
+    TestTraceEntry(const TestTraceEntry&) = delete;
+    TestTraceEntry(TestTraceEntry&&) noexcept = delete;
+    auto operator=(const TestTraceEntry&) -> TestTraceEntry& = delete;
+    auto operator=(TestTraceEntry&&) noexcept -> TestTraceEntry& = delete;
+};
+
+struct TestLoopEntity
+{
+    int32 Hp {};
+    int32 Ap {};
+    uint32 Flags {};
+};
+
+// Mimics per tick entity processing with tiny traced accessors
+template<typename Mode>
+static auto GetTestEntityHp(const TestLoopEntity& entity) noexcept -> int32
+{
+    static constexpr SourceLocationData loc {nullptr, __FUNCTION__, __FILE__, static_cast<uint32_t>(__LINE__)};
+    TestTraceEntry<Mode> entry {loc};
+    return entity.Hp;
+}
+
+template<typename Mode>
+static auto IsTestEntityActive(const TestLoopEntity& entity) noexcept -> bool
+{
+    static constexpr SourceLocationData loc {nullptr, __FUNCTION__, __FILE__, static_cast<uint32_t>(__LINE__)};
+    TestTraceEntry<Mode> entry {loc};
+    return (entity.Flags & 1) != 0;
+}
+
+template<typename Mode>
+static void ProcessTestEntity(TestLoopEntity& entity) noexcept
+{
+    static constexpr SourceLocationData loc {nullptr, __FUNCTION__, __FILE__, static_cast<uint32_t>(__LINE__)};
+    TestTraceEntry<Mode> entry {loc};
+
+    if (IsTestEntityActive<Mode>(entity) && GetTestEntityHp<Mode>(entity) > 0) {
+        entity.Ap = std::min(entity.Ap + 1, 100);
+    }
+}
+
+template<typename Mode>
+static auto RunTestServerLoop(vector<TestLoopEntity>& entities, int32 ticks) noexcept -> int64
+{
+    static constexpr SourceLocationData loc {nullptr, __FUNCTION__, __FILE__, static_cast<uint32_t>(__LINE__)};
+    TestTraceEntry<Mode> entry {loc};
+
+    int64 result = 0;
+
+    for (int32 tick = 0; tick < ticks; tick++) {
+        for (auto& entity : entities) {
+            ProcessTestEntity<Mode>(entity);
+        }
+    }
+
+    for (const auto& entity : entities) {
+        result += entity.Ap;
+    }
+
+    return result;
+}
+
+// Goes deeper than max size and returns below it, stored entries must stay intact
+template<typename Mode>
+static void CheckTestOverflowAndReturn(size_t base_count)
+{
+    constexpr size_t overflow = 16;
+    const auto pushed = STACK_TRACE_MAX_SIZE - base_count + overflow;
+    vector<SourceLocationData> locs;
+
+    for (size_t i = 0; i < pushed; i++) {
+        locs.emplace_back(SourceLocationData {nullptr, "TestFuncDeep", "TestFile.cpp", numeric_cast<uint32_t>(i)});
+    }
+
+    for (const auto& loc : locs) {
+        Mode::Push(loc);
+    }
+
+    const auto& st = GetStackTrace();
+    CHECK(st.CallsCount == base_count + pushed);
+    CHECK(st.GetStoredCount() == STACK_TRACE_MAX_SIZE);
+    CHECK(GetStackTraceEntry(0) == nullptr);
+    CHECK(GetStackTraceEntry(overflow) == &locs[pushed - overflow - 1]);
+    CHECK(st.GetStoredEntry(0) == &locs[pushed - overflow - 1]);
+    CHECK(FormatStackTrace(st).find(strex("...and {} more entries", overflow).str()) != string::npos);
+
+    for (size_t i = 0; i < overflow * 2; i++) {
+        Mode::Pop();
+    }
+
+    const auto remaining = pushed - overflow * 2;
+    REQUIRE(st.CallsCount == base_count + remaining);
+
+    size_t mismatches = 0;
+
+    for (size_t deep = 0; deep < remaining; deep++) {
+        mismatches += GetStackTraceEntry(deep) != &locs[remaining - 1 - deep] || st.GetStoredEntry(deep) != &locs[remaining - 1 - deep] ? 1 : 0;
+    }
+
+    CHECK(mismatches == 0);
+    CHECK(FormatStackTrace(st).find("more entries") == string::npos);
+
+    for (size_t i = 0; i < remaining; i++) {
+        Mode::Pop();
+    }
+
+    CHECK(st.CallsCount == base_count);
+}
+
+TEST_CASE("StackTrace")
+{
+    const auto base_count = GetStackTrace().CallsCount;
+
+    SECTION("PushPop")
+    {
+        PushStackTrace(TestLocA);
+        PushStackTrace(TestLocB);
+
+        CHECK(GetStackTraceEntry(0) == &TestLocB);
+        CHECK(GetStackTraceEntry(1) == &TestLocA);
+
+        PopStackTrace();
+
+        CHECK(GetStackTraceEntry(0) == &TestLocA);
+
+        PopStackTrace();
+
+        CHECK(GetStackTrace().CallsCount == base_count);
+    }
+
+    SECTION("OverflowAndReturn")
+    {
+        REQUIRE(base_count < STACK_TRACE_MAX_SIZE);
+
+        CheckTestOverflowAndReturn<CheckedTraceMode>(base_count);
+        CheckTestOverflowAndReturn<CompactTraceMode>(base_count);
+    }
+
+    SECTION("CompactMatchesChecked")
+    {
+        PushStackTraceCompact(TestLocA);
+        PushStackTrace(TestLocB);
+
+        CHECK(GetStackTraceEntry(0) == &TestLocB);
+        CHECK(GetStackTraceEntry(1) == &TestLocA);
+
+        PopStackTraceCompact();
+        PopStackTrace();
+
+        CHECK(GetStackTrace().CallsCount == base_count);
+    }
+
+    SECTION("ServerLoopModesAreEquivalent")
+    {
+        vector<TestLoopEntity> entities_checked(64, TestLoopEntity {.Hp = 10, .Flags = 1});
+        vector<TestLoopEntity> entities_compact = entities_checked;
+
+        CHECK(RunTestServerLoop<CheckedTraceMode>(entities_checked, 3) == RunTestServerLoop<CompactTraceMode>(entities_compact, 3));
+        CHECK(GetStackTrace().CallsCount == base_count);
+    }
+}
+
+TEST_CASE("StackTraceBenchmark", "[.benchmark]")
+{
+    vector<TestLoopEntity> entities;
+
+    for (int32 i = 0; i < 10000; i++) {
+        entities.emplace_back(TestLoopEntity {.Hp = i % 7, .Ap = 0, .Flags = numeric_cast<uint32>(i % 3)});
+    }
+
+    BENCHMARK("server loop without stack trace")
+    {
+        return RunTestServerLoop<NoTraceMode>(entities, 10);
+    };
+
+    BENCHMARK("server loop with bounds checked stack trace")
+    {
+        return RunTestServerLoop<CheckedTraceMode>(entities, 10);
+    };
+
+    BENCHMARK("server loop with compact stack trace")
+    {
+        return RunTestServerLoop<CompactTraceMode>(entities, 10);
+    };
+}
+
+FO_END_NAMESPACE();
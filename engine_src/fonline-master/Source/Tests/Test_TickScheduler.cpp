@@ -0,0 +1,195 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "TickScheduler.h"
+
+FO_BEGIN_NAMESPACE();
+
+TEST_CASE("TickScheduler")
+{
+    // Synthetic clock, jobs consume time by advancing it
+    nanotime cur_time = nanotime(timespan(std::chrono::seconds {100}));
+    const auto consume = [&](int32 ms) { cur_time += timespan(std::chrono::milliseconds {ms}); };
+
+    TickScheduler scheduler([&] { return cur_time; });
+
+    SECTION("PriorityOrder")
+    {
+        string order;
+
+        scheduler.AddJob({.Name = "C", .Priority = 30}, [&] { order += "C"; });
+        scheduler.AddJob({.Name = "A", .Priority = 10}, [&] { order += "A"; });
+        scheduler.AddJob({.Name = "B1", .Priority = 20}, [&] { order += "B1"; });
+        scheduler.AddJob({.Name = "B2", .Priority = 20}, [&] { order += "B2"; });
+
+        scheduler.RunTick();
+
+        CHECK(order == "AB1B2C");
+        CHECK(scheduler.GetJobsCount() == 4);
+        CHECK(scheduler.GetTicksCount() == 1);
+    }
+
+    SECTION("PeriodicJob")
+    {
+        size_t runs = 0;
+
+        scheduler.AddJob({.Name = "Commit", .Period = std::chrono::milliseconds {100}}, [&] { runs++; });
+
+        for (int32 i = 0; i < 50; i++) {
+            scheduler.RunTick();
+            consume(10);
+        }
+
+        CHECK(runs == 5);
+    }
+
+    SECTION("DeferUnderBurst")
+    {
+        scheduler.SetTickBudget(std::chrono::milliseconds {10});
+        scheduler.SetMaxDeferTicks(3);
+
+        int32 burst_ticks = 0;
+        size_t deferrable_runs = 0;
+
+        scheduler.AddJob({.Name = "Critical", .Priority = 0}, [&] {
+            if (burst_ticks > 0) {
+                burst_ticks--;
+                consume(15);
+            }
+            else {
+                consume(1);
+            }
+        });
+        scheduler.AddJob({.Name = "Deferrable", .Priority = 10, .Deferrable = true}, [&] {
+            deferrable_runs++;
+            consume(5);
+        });
+
+        scheduler.RunTick();
+        CHECK(deferrable_runs == 1);
+
+        // Two burst ticks postpone deferrable work, then it catches up
+        burst_ticks = 2;
+        scheduler.RunTick();
+        scheduler.RunTick();
+        CHECK(deferrable_runs == 1);
+        CHECK(scheduler.GetJobStats("Deferrable").DeferCount == 2);
+
+        scheduler.RunTick();
+        CHECK(deferrable_runs == 2);
+
+        // Long burst can't postpone work longer than max defer ticks
+        burst_ticks = 10;
+
+        for (int32 i = 0; i < 10; i++) {
+            scheduler.RunTick();
+        }
+
+        CHECK(deferrable_runs == 2 + 10 / 4);
+        CHECK(scheduler.GetJobStats("Critical").RunCount == 13);
+    }
+
+    SECTION("OverrunReports")
+    {
+        vector<pair<string, size_t>> reports;
+
+        scheduler.SetOverrunHandler([&](string_view name, timespan duration, timespan max_slice, size_t overruns) {
+            CHECK(duration > max_slice);
+            reports.emplace_back(name, overruns);
+        }, std::chrono::milliseconds {100});
+
+        scheduler.AddJob({.Name = "Heavy", .MaxSlice = std::chrono::milliseconds {5}}, [&] { consume(20); });
+        scheduler.AddJob({.Name = "Light", .MaxSlice = std::chrono::milliseconds {5}}, [&] { consume(1); });
+
+        for (int32 i = 0; i < 10; i++) {
+            scheduler.RunTick();
+        }
+
+        // Heavy job overruns every tick, ticks take 21ms so reports come every 5th tick
+        CHECK(scheduler.GetJobStats("Heavy").OverrunCount == 10);
+        CHECK(scheduler.GetJobStats("Light").OverrunCount == 0);
+        CHECK(scheduler.GetJobStats("Heavy").MaxTime == timespan(std::chrono::milliseconds {20}));
+        REQUIRE(reports.size() == 2);
+        CHECK(reports[0] == pair<string, size_t> {"Heavy", 1});
+        CHECK(reports[1] == pair<string, size_t> {"Heavy", 5});
+        CHECK_FALSE(scheduler.GetStatsInfo().empty());
+    }
+
+    SECTION("SyntheticLoad")
+    {
+        // Critical jobs with random load spikes, deferrable jobs must never starve
+        constexpr int32 max_defer_ticks = 5;
+        scheduler.SetTickBudget(std::chrono::milliseconds {20});
+        scheduler.SetMaxDeferTicks(max_defer_ticks);
+
+        constexpr size_t deferrable_count = 3;
+        size_t critical_runs = 0;
+        int32 max_deferred_in_row = 0;
+        vector<size_t> last_run_tick(deferrable_count);
+        size_t tick = 0;
+
+        scheduler.AddJob({.Name = "Players", .Priority = 0}, [&] {
+            critical_runs++;
+            consume(GenericUtils::Random(0, 10) == 0 ? GenericUtils::Random(20, 60) : GenericUtils::Random(1, 5));
+        });
+        scheduler.AddJob({.Name = "Critters", .Priority = 1}, [&] { consume(GenericUtils::Random(1, 8)); });
+
+        for (size_t i = 0; i < deferrable_count; i++) {
+            scheduler.AddJob({.Name = strex("Deferrable{}", i), .Priority = 10 + numeric_cast<int32>(i), .Deferrable = true}, [&, i] {
+                const auto in_row = numeric_cast<int32>(tick - last_run_tick[i]) - 1;
+                max_deferred_in_row = std::max(max_deferred_in_row, in_row);
+                last_run_tick[i] = tick;
+                consume(GenericUtils::Random(1, 4));
+            });
+        }
+
+        constexpr size_t ticks_count = 1000;
+
+        for (tick = 1; tick <= ticks_count; tick++) {
+            scheduler.RunTick();
+        }
+
+        CHECK(critical_runs == ticks_count);
+        CHECK(max_deferred_in_row <= max_defer_ticks);
+
+        for (size_t i = 0; i < deferrable_count; i++) {
+            const auto& stats = scheduler.GetJobStats(strex("Deferrable{}", i));
+            CHECK(stats.RunCount + stats.DeferCount == ticks_count);
+            CHECK(stats.DeferCount != 0);
+        }
+    }
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,141 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "TwoDimensionalGrid.h"
+
+FO_BEGIN_NAMESPACE();
+
+TEST_CASE("TwoDimensionalGrid")
+{
+    SECTION("DynamicMatchesStatic")
+    {
+        StaticTwoDimensionalGrid<int32, ipos32, isize32> static_grid {{50, 40}};
+        DynamicTwoDimensionalGrid<int32, ipos32, isize32> dynamic_grid {{50, 40}};
+
+        for (int32 i = 0; i < 500; i++) {
+            const auto pos = ipos32 {GenericUtils::Random(0, 49), GenericUtils::Random(0, 39)};
+            const auto value = GenericUtils::Random(1, 1000);
+            static_grid.GetCellForWriting(pos) = value;
+            dynamic_grid.GetCellForWriting(pos) = value;
+        }
+
+        for (int32 y = 0; y < 40; y++) {
+            for (int32 x = 0; x < 50; x++) {
+                CHECK(dynamic_grid.GetCellForReading({x, y}) == static_grid.GetCellForReading({x, y}));
+            }
+        }
+    }
+
+    SECTION("PagesAllocatedOnWrite")
+    {
+        DynamicTwoDimensionalGrid<int32, ipos32, isize32> grid {{100, 100}};
+        CHECK(grid.GetAllocatedPagesCount() == 0);
+
+        CHECK(grid.GetCellForReading({99, 99}) == 0);
+        CHECK(grid.GetAllocatedPagesCount() == 0);
+
+        grid.GetCellForWriting({0, 0}) = 1;
+        grid.GetCellForWriting({15, 15}) = 2;
+        CHECK(grid.GetAllocatedPagesCount() == 1);
+
+        grid.GetCellForWriting({16, 0}) = 3;
+        CHECK(grid.GetAllocatedPagesCount() == 2);
+
+        grid.Preallocate();
+        CHECK(grid.GetAllocatedPagesCount() == 7 * 7);
+        CHECK(grid.GetCellForReading({15, 15}) == 2);
+    }
+
+    SECTION("Resize")
+    {
+        DynamicTwoDimensionalGrid<int32, ipos32, isize32> grid {{40, 40}};
+        grid.GetCellForWriting({5, 5}) = 1;
+        grid.GetCellForWriting({35, 5}) = 2;
+        grid.GetCellForWriting({5, 35}) = 3;
+
+        grid.Resize({20, 60});
+        CHECK(grid.GetSize() == isize32 {20, 60});
+        CHECK(grid.GetCellForReading({5, 5}) == 1);
+        CHECK(grid.GetCellForReading({5, 35}) == 3);
+        CHECK(grid.GetCellForReading({19, 5}) == 0);
+
+        grid.Resize({40, 40});
+        CHECK(grid.GetCellForReading({5, 5}) == 1);
+        CHECK(grid.GetCellForReading({35, 5}) == 0);
+    }
+}
+
+TEST_CASE("TwoDimensionalGridBenchmark", "[.benchmark]")
+{
+    constexpr int32 side = 256;
+
+    StaticTwoDimensionalGrid<int32, ipos32, isize32> static_grid {{side, side}};
+    DynamicTwoDimensionalGrid<int32, ipos32, isize32> dynamic_grid {{side, side}};
+
+    for (int32 y = 0; y < side; y += 3) {
+        for (int32 x = 0; x < side; x += 3) {
+            static_grid.GetCellForWriting({x, y}) = x + y;
+            dynamic_grid.GetCellForWriting({x, y}) = x + y;
+        }
+    }
+
+    BENCHMARK("StaticRead")
+    {
+        int64 sum = 0;
+
+        for (int32 y = 0; y < side; y++) {
+            for (int32 x = 0; x < side; x++) {
+                sum += static_grid.GetCellForReading({x, y});
+            }
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("DynamicRead")
+    {
+        int64 sum = 0;
+
+        for (int32 y = 0; y < side; y++) {
+            for (int32 x = 0; x < side; x++) {
+                sum += dynamic_grid.GetCellForReading({x, y});
+            }
+        }
+
+        return sum;
+    };
+}
+
+FO_END_NAMESPACE();
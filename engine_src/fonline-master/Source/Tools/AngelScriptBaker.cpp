@@ -36,12 +36,14 @@
 #if FO_ANGELSCRIPT_SCRIPTING
 
 #include "Application.h"
+#include "ScriptCompilationCache.h"
+#include "Version-Include.h"
 
 FO_BEGIN_NAMESPACE();
 
-extern vector<uint8> Init_AngelScriptCompiler_ServerScriptSystem(const vector<File>&);
-extern vector<uint8> Init_AngelScriptCompiler_ClientScriptSystem(const vector<File>&);
-extern vector<uint8> Init_AngelScriptCompiler_MapperScriptSystem(const vector<File>&);
+extern vector<uint8> Init_AngelScriptCompiler_ServerScriptSystem(const vector<File>&, vector<string>*);
+extern vector<uint8> Init_AngelScriptCompiler_ClientScriptSystem(const vector<File>&, vector<string>*);
+extern vector<uint8> Init_AngelScriptCompiler_MapperScriptSystem(const vector<File>&, vector<string>*);
 
 unordered_set<string> CompilerPassedMessages;
 
@@ -65,8 +67,7 @@ void AngelScriptBaker::BakeFiles(const FileCollection& files, string_view target
     }
 
     // Collect files
-    vector<File> filtered_files;
-    uint64 max_write_time = 0;
+    vector<FileHeader> script_files;
 
     for (const auto& file_header : files) {
         const string ext = strex(file_header.GetPath()).get_file_extension();
@@ -75,41 +76,72 @@ void AngelScriptBaker::BakeFiles(const FileCollection& files, string_view target
             continue;
         }
 
-        max_write_time = std::max(max_write_time, file_header.GetWriteTime());
-        filtered_files.emplace_back(File::Load(file_header));
+        script_files.emplace_back(file_header.Copy());
     }
 
-    if (filtered_files.empty()) {
+    if (script_files.empty()) {
         return;
     }
 
-    const bool bake_server = !_bakeChecker || _bakeChecker(_resPackName + ".fos-bin-server", max_write_time);
-    const bool bake_client = !_bakeChecker || _bakeChecker(_resPackName + ".fos-bin-client", max_write_time);
-    const bool bake_mapper = !_bakeChecker || _bakeChecker(_resPackName + ".fos-bin-mapper", max_write_time);
+    ScriptCompilationCache cache {strex(_settings->BakeOutput).combine_path("ScriptCache"), FO_BUILD_HASH, std::move(script_files)};
 
-    if (!bake_server && !bake_client && !bake_mapper) {
+    struct CompilationTarget
+    {
+        string Ext {};
+        vector<uint8> (*Compile)(const vector<File>&, vector<string>*) {};
+        string OutputName {};
+        bool UseCache {};
+        bool Bake {};
+    };
+
+    CompilationTarget targets[] = {
+        {.Ext = "fos-bin-server", .Compile = &Init_AngelScriptCompiler_ServerScriptSystem},
+        {.Ext = "fos-bin-client", .Compile = &Init_AngelScriptCompiler_ClientScriptSystem},
+        {.Ext = "fos-bin-mapper", .Compile = &Init_AngelScriptCompiler_MapperScriptSystem},
+    };
+
+    bool bake_any = false;
+
+    for (auto& target : targets) {
+        target.OutputName = _resPackName + "." + target.Ext;
+
+        const auto state = cache.CheckTarget(target.OutputName);
+        const auto outdated = !_bakeChecker || _bakeChecker(target.OutputName, state.InputWriteTime);
+
+        // Removed or renamed files and changed includes are not visible by write times of sources
+        const auto inputs_changed = state.HasCache && !state.IsValid;
+
+        target.UseCache = state.IsValid;
+        target.Bake = outdated || inputs_changed;
+        bake_any |= target.Bake;
+    }
+
+    if (!bake_any) {
         return;
     }
 
     // Process files
     vector<std::future<void>> file_bakings;
 
-    if (bake_server) {
-        file_bakings.emplace_back(std::async(GetAsyncMode(), [&] {
-            auto data = Init_AngelScriptCompiler_ServerScriptSystem(filtered_files);
-            _writeData(_resPackName + ".fos-bin-server", data);
-        }));
-    }
-    if (bake_client) {
-        file_bakings.emplace_back(std::async(GetAsyncMode(), [&] {
-            auto data = Init_AngelScriptCompiler_ClientScriptSystem(filtered_files);
-            _writeData(_resPackName + ".fos-bin-client", data);
-        }));
-    }
-    if (bake_mapper) {
+    for (auto& target : targets) {
+        if (!target.Bake) {
+            continue;
+        }
+
         file_bakings.emplace_back(std::async(GetAsyncMode(), [&] {
-            auto data = Init_AngelScriptCompiler_MapperScriptSystem(filtered_files);
-            _writeData(_resPackName + ".fos-bin-mapper", data);
+            // Inputs are the same as for cached result, only refresh output
+            if (target.UseCache) {
+                if (const auto cached_data = cache.LoadTargetData(target.OutputName); cached_data.has_value()) {
+                    _writeData(target.OutputName, cached_data.value());
+                    return;
+                }
+            }
+
+            vector<string> included_files;
+            const auto data = target.Compile(cache.GetSourceFiles(), &included_files);
+            _writeData(target.OutputName, data);
+
+            cache.StoreTarget(target.OutputName, data, included_files);
         }));
     }
 
@@ -0,0 +1,307 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "ScriptCompilationCache.h"
+
+FO_BEGIN_NAMESPACE();
+
+ScriptCompilationCache::ScriptCompilationCache(string_view cache_dir, string_view build_hash, vector<FileHeader> sources) :
+    _cacheDir {cache_dir},
+    _buildHash {build_hash},
+    _sourceHeaders {std::move(sources)}
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _sourceStamps.reserve(_sourceHeaders.size());
+    _sourceHashes.resize(_sourceHeaders.size());
+
+    for (const auto& header : _sourceHeaders) {
+        _sourceStamps.emplace_back(InputStamp {.Path = header.GetPath(), .Size = header.GetSize(), .WriteTime = header.GetWriteTime()});
+        _sourcesWriteTime = std::max(_sourcesWriteTime, header.GetWriteTime());
+    }
+
+    // Order of sources in collection doesn't matter for comparison
+    std::ranges::sort(_sourceStamps, [](const InputStamp& a, const InputStamp& b) { return a.Path < b.Path; });
+}
+
+auto ScriptCompilationCache::GetSourceFiles() -> const vector<File>&
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::scoped_lock locker(_locker);
+
+    LoadSourceFiles();
+    return _sourceFiles;
+}
+
+void ScriptCompilationCache::LoadSourceFiles()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_sourceFilesLoaded) {
+        return;
+    }
+
+    _sourceFiles.reserve(_sourceHeaders.size());
+
+    for (const auto& header : _sourceHeaders) {
+        _sourceFiles.emplace_back(File::Load(header));
+    }
+
+    _sourceFilesLoaded = true;
+}
+
+auto ScriptCompilationCache::CheckTarget(string_view target) -> TargetState
+{
+    FO_STACK_TRACE_ENTRY();
+
+    TargetState state;
+    state.InputWriteTime = _sourcesWriteTime;
+
+    const auto manifest = LoadManifest(target);
+
+    if (!manifest.has_value() || !DiskFileSystem::IsExists(GetDataPath(target))) {
+        return state;
+    }
+
+    state.HasCache = true;
+
+    vector<InputStamp> includes;
+    includes.reserve(manifest->Includes.size());
+
+    for (const auto& include : manifest->Includes) {
+        includes.emplace_back(GetIncludeStamp(include.Path));
+        state.InputWriteTime = std::max(state.InputWriteTime, includes.back().WriteTime);
+    }
+
+    if (manifest->BuildHash != _buildHash) {
+        return state;
+    }
+
+    if (manifest->Sources == _sourceStamps && manifest->Includes == includes) {
+        state.IsValid = true;
+        return state;
+    }
+
+    // Touched or moved files may still have same content
+    const auto input_hash = EvaluateInputHash(includes);
+
+    if (input_hash == manifest->InputHash) {
+        state.IsValid = true;
+        StoreManifest(target, Manifest {.InputHash = input_hash, .BuildHash = _buildHash, .Sources = _sourceStamps, .Includes = std::move(includes)});
+    }
+
+    return state;
+}
+
+auto ScriptCompilationCache::LoadTargetData(string_view target) const -> optional<vector<uint8>>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto data = DiskFileSystem::ReadFile(GetDataPath(target));
+
+    if (!data.has_value()) {
+        return std::nullopt;
+    }
+
+    return vector<uint8>(data->begin(), data->end());
+}
+
+void ScriptCompilationCache::StoreTarget(string_view target, span<const uint8> data, const vector<string>& included_files)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto data_path = GetDataPath(target);
+
+    if (!DiskFileSystem::MakeDirTree(strex(data_path).extract_dir())) {
+        WriteLog("Unable to create script cache dir for {}", data_path);
+        return;
+    }
+
+    vector<InputStamp> includes;
+    includes.reserve(included_files.size());
+
+    for (const auto& included_file : included_files) {
+        includes.emplace_back(GetIncludeStamp(included_file));
+    }
+
+    std::ranges::sort(includes, [](const InputStamp& a, const InputStamp& b) { return a.Path < b.Path; });
+    const auto duplicates = std::ranges::unique(includes, [](const InputStamp& a, const InputStamp& b) { return a.Path == b.Path; });
+    includes.erase(duplicates.begin(), duplicates.end());
+
+    auto input_hash = EvaluateInputHash(includes);
+
+    // Manifest goes last, it validates data file
+    DiskFileSystem::DeleteFile(data_path + ".deps");
+
+    if (!DiskFileSystem::WriteFile(data_path, data)) {
+        WriteLog("Unable to write script cache {}", data_path);
+        return;
+    }
+
+    StoreManifest(target, Manifest {.InputHash = std::move(input_hash), .BuildHash = _buildHash, .Sources = _sourceStamps, .Includes = std::move(includes)});
+}
+
+auto ScriptCompilationCache::GetIncludeStamp(const string& path) -> InputStamp
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto file = DiskFileSystem::OpenFile(path, false);
+
+    if (!file) {
+        return InputStamp {.Path = path};
+    }
+
+    return InputStamp {.Path = path, .Size = file.GetSize(), .WriteTime = DiskFileSystem::GetWriteTime(path)};
+}
+
+auto ScriptCompilationCache::GetDataPath(string_view target) const -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return strex(_cacheDir).combine_path(target);
+}
+
+auto ScriptCompilationCache::LoadManifest(string_view target) const -> optional<Manifest>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto content = DiskFileSystem::ReadFile(GetDataPath(target) + ".deps");
+
+    if (!content.has_value()) {
+        return std::nullopt;
+    }
+
+    const auto lines = strex(*content).split('\n');
+
+    if (lines.size() < 2) {
+        return std::nullopt;
+    }
+
+    Manifest manifest;
+    manifest.InputHash = lines[0];
+    manifest.BuildHash = lines[1];
+
+    for (size_t i = 2; i < lines.size(); i++) {
+        const auto fields = strex(lines[i]).split('\t');
+
+        if (fields.size() != 4 || (fields[0] != "s" && fields[0] != "i") || !strex(fields[1]).is_number() || !strex(fields[2]).is_number()) {
+            return std::nullopt;
+        }
+
+        auto& stamps = fields[0] == "s" ? manifest.Sources : manifest.Includes;
+        stamps.emplace_back(InputStamp {.Path = fields[3], .Size = numeric_cast<size_t>(strex(fields[1]).to_int64()), .WriteTime = numeric_cast<uint64>(strex(fields[2]).to_int64())});
+    }
+
+    return manifest;
+}
+
+void ScriptCompilationCache::StoreManifest(string_view target, const Manifest& manifest) const
+{
+    FO_STACK_TRACE_ENTRY();
+
+    string content = strex("{}\n{}", manifest.InputHash, manifest.BuildHash);
+
+    for (const auto& stamp : manifest.Sources) {
+        content += strex("\ns\t{}\t{}\t{}", stamp.Size, stamp.WriteTime, stamp.Path);
+    }
+    for (const auto& stamp : manifest.Includes) {
+        content += strex("\ni\t{}\t{}\t{}", stamp.Size, stamp.WriteTime, stamp.Path);
+    }
+
+    if (!DiskFileSystem::WriteFile(GetDataPath(target) + ".deps", content)) {
+        WriteLog("Unable to write script cache manifest for {}", target);
+    }
+}
+
+// Hash of everything that affects compilation result: engine build, script sources and their nested includes
+auto ScriptCompilationCache::EvaluateInputHash(const vector<InputStamp>& includes) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::scoped_lock locker(_locker);
+
+    vector<string> entries;
+    entries.reserve(_sourceHeaders.size() + includes.size());
+
+    for (size_t i = 0; i < _sourceHeaders.size(); i++) {
+        entries.emplace_back(strex("{}:{}", _sourceHeaders[i].GetPath(), GetSourceHash(i)));
+    }
+    for (const auto& include : includes) {
+        entries.emplace_back(strex("{}:{}", include.Path, GetIncludeHash(include.Path)));
+    }
+
+    std::ranges::sort(entries);
+
+    string key = _buildHash;
+
+    for (const auto& entry : entries) {
+        key += '\n';
+        key += entry;
+    }
+
+    return strex("{:016x}", Hashing::MurmurHash2_64(key.data(), key.size()));
+}
+
+auto ScriptCompilationCache::GetSourceHash(size_t index) -> uint64
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_sourceHashes[index].has_value()) {
+        LoadSourceFiles();
+
+        const auto& file = _sourceFiles[index];
+        _sourceHashes[index] = Hashing::MurmurHash2_64(file.GetBuf(), file.GetSize());
+        ++_hashedFiles;
+    }
+
+    return _sourceHashes[index].value();
+}
+
+auto ScriptCompilationCache::GetIncludeHash(const string& path) -> uint64
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (const auto it = _includeHashes.find(path); it != _includeHashes.end()) {
+        return it->second;
+    }
+
+    const auto content = DiskFileSystem::ReadFile(path);
+    const auto hash = content.has_value() ? Hashing::MurmurHash2_64(content->data(), content->size()) : 0;
+    ++_hashedFiles;
+
+    _includeHashes.emplace(path, hash);
+    return hash;
+}
+
+FO_END_NAMESPACE();
@@ -0,0 +1,109 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2025, Anton Tsvetinskiy aka cvet <cvet@tut.by>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "FileSystem.h"
+
+FO_BEGIN_NAMESPACE();
+
+// Compilation results of script targets kept between baker runs together with inputs they were made from
+// Inputs are script sources and files included by them, sizes and write times are compared first
+// and content hashes are evaluated only on mismatch, each file is hashed once for all targets
+class ScriptCompilationCache final
+{
+public:
+    struct TargetState
+    {
+        bool HasCache {};
+        bool IsValid {};
+        uint64 InputWriteTime {};
+    };
+
+    ScriptCompilationCache(string_view cache_dir, string_view build_hash, vector<FileHeader> sources);
+    ScriptCompilationCache(const ScriptCompilationCache&) = delete;
+    ScriptCompilationCache(ScriptCompilationCache&&) noexcept = delete;
+    auto operator=(const ScriptCompilationCache&) = delete;
+    auto operator=(ScriptCompilationCache&&) noexcept = delete;
+    ~ScriptCompilationCache() = default;
+
+    [[nodiscard]] auto GetSourceFiles() -> const vector<File>&;
+    [[nodiscard]] auto GetHashedFilesCount() const noexcept -> size_t { return _hashedFiles; }
+    [[nodiscard]] auto CheckTarget(string_view target) -> TargetState;
+    [[nodiscard]] auto LoadTargetData(string_view target) const -> optional<vector<uint8>>;
+
+    void StoreTarget(string_view target, span<const uint8> data, const vector<string>& included_files);
+
+private:
+    struct InputStamp
+    {
+        auto operator==(const InputStamp& other) const noexcept -> bool = default;
+
+        string Path {};
+        size_t Size {};
+        uint64 WriteTime {};
+    };
+
+    struct Manifest
+    {
+        string InputHash {};
+        string BuildHash {};
+        vector<InputStamp> Sources {};
+        vector<InputStamp> Includes {};
+    };
+
+    [[nodiscard]] static auto GetIncludeStamp(const string& path) -> InputStamp;
+    [[nodiscard]] auto GetDataPath(string_view target) const -> string;
+    [[nodiscard]] auto LoadManifest(string_view target) const -> optional<Manifest>;
+    [[nodiscard]] auto EvaluateInputHash(const vector<InputStamp>& includes) -> string;
+    [[nodiscard]] auto GetSourceHash(size_t index) -> uint64;
+    [[nodiscard]] auto GetIncludeHash(const string& path) -> uint64;
+    void StoreManifest(string_view target, const Manifest& manifest) const;
+    void LoadSourceFiles();
+
+    string _cacheDir;
+    string _buildHash;
+    vector<FileHeader> _sourceHeaders;
+    vector<InputStamp> _sourceStamps {};
+    uint64 _sourcesWriteTime {};
+    vector<File> _sourceFiles {};
+    bool _sourceFilesLoaded {};
+    vector<optional<uint64>> _sourceHashes {};
+    unordered_map<string, uint64> _includeHashes {};
+    std::atomic_size_t _hashedFiles {};
+    std::mutex _locker {};
+};
+
+FO_END_NAMESPACE();
@@ -46,6 +46,9 @@
 #include "as_datatype.h"
 #include "as_atomic.h"
 
+// (FOnline Patch)
+struct ASFunctionExtendedData;
+
 BEGIN_AS_NAMESPACE
 
 class asCScriptEngine;
@@ -115,6 +118,9 @@ void RegisterScriptFunction(asCScriptEngine *engine);
 class asCScriptFunction : public asIScriptFunction
 {
 public:
+	// (FOnline Patch)
+	ASFunctionExtendedData* Ext {};
+
 	// From asIScriptFunction
 	asIScriptEngine     *GetEngine() const;
 